@@ -0,0 +1,524 @@
+/* ***************************************************************************
+ * @file		VSTDActor.cpp
+ * @brief		軽量アクター(M:N実行)用 Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "VSTDActor.hpp"
+
+namespace VSTD
+{
+	/* ***********************************************************************
+	 *
+	 * Actor
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		Actorのコンストラクタ
+	 * @param[in]	owner：実行するスケジューラを指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Actor::Actor(ActorScheduler * owner)
+	{
+		stub.data	= NULL;
+		stub.next.store(NULL , std::memory_order_relaxed);
+		head.store(&stub , std::memory_order_relaxed);
+		tail			= &stub;
+		state.store(ACTOR_IDLE , std::memory_order_relaxed);
+		running.store(false , std::memory_order_relaxed);
+		scheduler	= owner;
+		nextReady	= NULL;
+	}
+	/**
+	 * @brief		Actorのデストラクタ
+	 * @note		未処理のメッセージの要素を破棄します。データは解放されません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Actor::~Actor(void)
+	{
+		ActorNode_t * node;
+		while ((node = pop()) != NULL)
+		{
+			delete node;
+		}
+	}
+	/**
+	 * @brief		onFunction
+	 * 				ラッピング用仮想ファンクション
+	 * @note		送信されたメッセージ毎に呼び出されます。
+	 * 				既定ではThreadFunctionとして実行し、自動解放が指定された
+	 * 				ThreadFunctionは処理完了後に破棄します。
+	 * 				falseを返却した場合はアクターを停止し、以降のメッセージは
+	 * 				受け付けません。
+	 * @param[in]	Data：送信されたデータ
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Actor::onFunction(void * Data)
+	{
+		bool retVal;
+		try
+		{
+			ThreadFunction *Func = (ThreadFunction *)Data;
+			/* 実行中に再度送信された場合はメールボックスにある為、完了とせず破棄もしない */
+			retVal = Func->execute();
+			return retVal;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setFunction
+	 * 				メッセージの送信
+	 * @note		メールボックスにデータを追加し、待機中の場合は
+	 * 				スケジューラの実行待ちに登録します。ロックは使用しません。
+	 * @param[in]	Data：送信するデータを指定
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(NULLが指定された、停止している)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Actor::setFunction(void * Data)
+	{
+		try
+		{
+			if (!Data || state.load(std::memory_order_acquire) == ACTOR_STOPPED)
+			{
+				return false;
+			}
+			ActorNode_t * node = new ActorNode_t;
+			node->data = Data;
+			push(node);
+			/* *******************************************************************
+			 * 待機中の場合は実行待ちに登録し、実行中の場合は送信された事を示す
+			 * *******************************************************************/
+			int current = state.load(std::memory_order_acquire);
+			while (true)
+			{
+				if (current == ACTOR_IDLE)
+				{
+					if (state.compare_exchange_weak(current , ACTOR_SCHEDULED , std::memory_order_acq_rel))
+					{
+						scheduler->schedule(this);
+						break;
+					}
+					continue;
+				}
+				if (current == ACTOR_SCHEDULED)
+				{
+					if (state.compare_exchange_weak(current , ACTOR_SCHEDULED | ACTOR_STATE_PENDING , std::memory_order_acq_rel))
+					{
+						break;
+					}
+					continue;
+				}
+				/* 通知済み、又は停止済み */
+				break;
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setFunction
+	 * 				ThreadFunctionの送信
+	 * @param[in]	Func：送信するThreadFunctionを指定
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Actor::setFunction(ThreadFunction * Func)
+	{
+		if (!Func) return false;
+		Func->setStatus(THFUNC_STATE_WAITING);
+		return setFunction((void *)Func);
+	}
+	/**
+	 * @brief		getState
+	 * 				実行状態の取得
+	 * @return	実行状態を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ActorState_t Actor::getState()
+	{
+		return (ActorState_t)(state.load(std::memory_order_acquire) & ~ACTOR_STATE_PENDING);
+	}
+	/**
+	 * @brief		isIdle
+	 * 				待機中かの取得
+	 * @note		trueの場合、ワーカーはアクターを参照していない為破棄出来ます。
+	 * @return	実行待ちでも実行中でもない場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Actor::isIdle()
+	{
+		return (state.load(std::memory_order_acquire) & ~ACTOR_STATE_PENDING) != ACTOR_SCHEDULED
+			&& !running.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		push
+	 * 				メールボックスへの追加
+	 * @note		複数のスレッドから同時に呼び出す事が出来ます。
+	 * @param[in]	node：追加する要素
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Actor::push(ActorNode_t * node)
+	{
+		node->next.store(NULL , std::memory_order_relaxed);
+		ActorNode_t * prev = head.exchange(node , std::memory_order_acq_rel);
+		prev->next.store(node , std::memory_order_release);
+	}
+	/**
+	 * @brief		pop
+	 * 				メールボックスからの取り出し
+	 * @note		実行中のワーカーからのみ呼び出されます。
+	 * 				送信者が追加の途中である場合は空でなくてもNULLを返却します。
+	 * @return	取り出した要素を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ActorNode_t * Actor::pop()
+	{
+		ActorNode_t * first = tail;
+		ActorNode_t * next  = first->next.load(std::memory_order_acquire);
+		/* 番兵を読み飛ばす */
+		if (first == &stub)
+		{
+			if (!next) return NULL;
+			tail	= next;
+			first	= next;
+			next	= next->next.load(std::memory_order_acquire);
+		}
+		if (next)
+		{
+			tail = next;
+			return first;
+		}
+		/* 送信者が追加の途中 */
+		if (first != head.load(std::memory_order_acquire))
+		{
+			return NULL;
+		}
+		/* 最後の要素を取り出す為に番兵を追加 */
+		push(&stub);
+		next = first->next.load(std::memory_order_acquire);
+		if (next)
+		{
+			tail = next;
+			return first;
+		}
+		return NULL;
+	}
+	/**
+	 * @brief		empty
+	 * 				メールボックスが空かの確認
+	 * @note		送信者が追加の途中である場合は空ではありません。
+	 * @return	空の場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Actor::empty()
+	{
+		return tail == &stub && head.load(std::memory_order_seq_cst) == &stub;
+	}
+	/**
+	 * @brief		run
+	 * 				メッセージの処理
+	 * @param[in]	batch：処理する最大数
+	 * @param[out]	stopped：onFunctionがfalseを返却した場合にtrueを格納
+	 * @return	処理した数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int Actor::run(unsigned int batch , bool * stopped)
+	{
+		unsigned int	num = 0;
+		ActorNode_t *	node;
+		*stopped = false;
+		while (num < batch && (node = pop()) != NULL)
+		{
+			void * Data = node->data;
+			delete node;
+			num++;
+			if (!onFunction(Data))
+			{
+				state.store(ACTOR_STOPPED , std::memory_order_release);
+				*stopped = true;
+				break;
+			}
+		}
+		return num;
+	}
+	/* ***********************************************************************
+	 *
+	 * ActorWorker
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		ActorWorkerのコンストラクタ
+	 * @param[in]	owner：所属するスケジューラを指定します。
+	 * @param[in]	size：スタックサイズを指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ActorWorker::ActorWorker(ActorScheduler * owner , int size)
+		: ThreadCall(size) , scheduler(owner) , idle(true)
+	{
+	}
+	/**
+	 * @brief		ActorWorkerのデストラクタ
+	 * @note		派生クラスの破棄前にスレッドを停止します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ActorWorker::~ActorWorker(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		onFunction
+	 * 				実行待ちのアクターの実行
+	 * @note		実行待ちが空になるまでアクターを取り出して実行します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ActorWorker::onFunction()
+	{
+		Actor * actor;
+		try
+		{
+			while ((actor = scheduler->take(this)) != NULL)
+			{
+				scheduler->run(actor);
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * ActorScheduler
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		ActorSchedulerのコンストラクタ
+	 * @param[in]	threads：ワーカー数を指定します。
+	 * @param[in]	batchSize：1回の実行で処理するメッセージの最大数を指定します。
+	 * @param[in]	stackSize：ワーカーのスタックサイズ(byte)。0の場合は既定値
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ActorScheduler::ActorScheduler(unsigned int threads , unsigned int batchSize , int stackSize)
+	{
+		if (threads < 1) threads = 1;
+		if (threads > MAX_ACTOR_WORKER) threads = MAX_ACTOR_WORKER;
+		memset(workers , 0 , sizeof(workers));
+		workerCount	= 0;
+		batch			= batchSize > 0 ? batchSize : 1;
+		readyHead		= NULL;
+		readyTail		= NULL;
+		readyCount	= 0;
+		turns			= 0;
+		processed		= 0;
+		stopping		= false;
+		for (unsigned int i = 0 ; i < threads ; i++)
+		{
+			workers[workerCount++] = new ActorWorker(this , stackSize);
+		}
+	}
+	/**
+	 * @brief		ActorSchedulerのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ActorScheduler::~ActorScheduler(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		stop
+	 * 				スケジューラの停止
+	 * @note		全てのワーカーを停止します。実行待ちのアクターは実行されません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ActorScheduler::stop()
+	{
+		ActorWorker *	stopped[MAX_ACTOR_WORKER];
+		unsigned int	num;
+		try
+		{
+			mutex.lock();
+			if (stopping)
+			{
+				mutex.unlock();
+				return;
+			}
+			stopping = true;
+			num = workerCount;
+			memcpy(stopped , workers , sizeof(ActorWorker *) * num);
+			workerCount = 0;
+			mutex.unlock();
+			for (unsigned int i = 0 ; i < num ; i++)
+			{
+				delete stopped[i];
+			}
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getStat
+	 * 				統計情報の取得
+	 * @param[out]	stat：統計情報を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ActorScheduler::getStat(ActorSchedulerStat_t * stat)
+	{
+		mutex.lock();
+		stat->workers		= workerCount;
+		stat->ready		= readyCount;
+		stat->turns		= turns;
+		stat->processed	= processed.load(std::memory_order_relaxed);
+		mutex.unlock();
+	}
+	/**
+	 * @brief		schedule
+	 * 				実行待ちへの登録
+	 * @note		実行待ちの末尾に追加し、待機中のワーカーが存在する場合は
+	 * 				シグナルを送信します。
+	 * @param[in]	actor：登録するアクター
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ActorScheduler::schedule(Actor * actor)
+	{
+		ActorWorker * target = NULL;
+		mutex.lock();
+		if (stopping)
+		{
+			mutex.unlock();
+			return;
+		}
+		actor->nextReady = NULL;
+		if (readyTail)
+		{
+			readyTail->nextReady = actor;
+		}
+		else
+		{
+			readyHead = actor;
+		}
+		readyTail = actor;
+		readyCount++;
+		/* 待機中のワーカーを一つ起床 */
+		for (unsigned int i = 0 ; i < workerCount ; i++)
+		{
+			if (workers[i]->idle)
+			{
+				workers[i]->idle = false;
+				target = workers[i];
+				break;
+			}
+		}
+		mutex.unlock();
+		if (target)
+		{
+			target->setFunction();
+		}
+	}
+	/**
+	 * @brief		take
+	 * 				実行待ちの取り出し
+	 * @note		実行待ちが空の場合はワーカーを待機中として記録します。
+	 * @param[in]	worker：呼び出し元のワーカー
+	 * @return	取り出したアクターを返却します。空の場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Actor * ActorScheduler::take(ActorWorker * worker)
+	{
+		Actor * actor;
+		mutex.lock();
+		actor = readyHead;
+		if (!actor || stopping)
+		{
+			worker->idle = true;
+			mutex.unlock();
+			return NULL;
+		}
+		readyHead = actor->nextReady;
+		if (!readyHead) readyTail = NULL;
+		readyCount--;
+		turns++;
+		worker->idle = false;
+		/* 取り出したワーカーのみが実行中として記録 */
+		actor->running.store(true , std::memory_order_relaxed);
+		mutex.unlock();
+		return actor;
+	}
+	/**
+	 * @brief		run
+	 * 				アクターの実行
+	 * @note		batch件までメッセージを処理し、残りがある場合は
+	 * 				実行待ちの末尾へ戻します。空の場合は待機中としますが、
+	 * 				実行中に送信されたメッセージが存在する場合は待機中とせずに
+	 * 				再登録します。
+	 * 				待機中への変更、又は停止時のrunningの解除が
+	 * 				アクターへの最後の参照となります。
+	 * @param[in]	actor：実行するアクター
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ActorScheduler::run(Actor * actor)
+	{
+		bool	stopped;
+		/* 以降に送信されたメッセージのみを通知として扱う */
+		actor->state.fetch_and(~ACTOR_STATE_PENDING , std::memory_order_acq_rel);
+		processed.fetch_add(actor->run(batch , &stopped) , std::memory_order_relaxed);
+		if (stopped)
+		{
+			actor->running.store(false , std::memory_order_release);
+			return;
+		}
+		/* 実行待ちのまま戻す為、他のワーカーより先に解除する */
+		actor->running.store(false , std::memory_order_release);
+		if (actor->empty())
+		{
+			/* *******************************************************************
+			 * 確認後に送信されていない場合のみ待機中とする。
+			 * 待機中とした時点で破棄される可能性がある為、以降は参照しない
+			 * *******************************************************************/
+			int expected = ACTOR_SCHEDULED;
+			if (actor->state.compare_exchange_strong(expected , ACTOR_IDLE , std::memory_order_acq_rel))
+			{
+				return;
+			}
+		}
+		schedule(actor);
+	}
+}
@@ -0,0 +1,209 @@
+/* ***************************************************************************
+ * @file		VSTDActor.hpp
+ * @brief		軽量アクター(M:N実行)用 Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDACTOR_HPP_
+#define VSTDACTOR_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief スケジューラに登録可能なワーカーの最大数 */
+	#define MAX_ACTOR_WORKER 256
+	/** @brief 実行中に送信されたメッセージが存在する事を示すフラグ(ACTOR_SCHEDULEDに付加) */
+	#define ACTOR_STATE_PENDING 0x40000000
+	class Actor;
+	class ActorScheduler;
+	/**
+	 * @brief		アクターの実行状態を定義している列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief メールボックスが空であり、実行待ちに登録されていません */
+		ACTOR_IDLE,
+		/** @brief 実行待ちに登録されているか、実行中です */
+		ACTOR_SCHEDULED,
+		/** @brief onFunctionがfalseを返却した為、停止しています */
+		ACTOR_STOPPED
+	} ActorState_t;
+	/**
+	 * @brief		メールボックスの要素
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct ActorNode
+	{
+		/** @brief 送信されたデータ */
+		void *						data;
+		/** @brief 次の要素 */
+		std::atomic<struct ActorNode *>	next;
+	} ActorNode_t;
+	/**
+	 * @brief		スケジューラの統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief ワーカー数 */
+		unsigned int		workers;
+		/** @brief 実行待ちのアクター数 */
+		unsigned long		ready;
+		/** @brief アクターが実行された総回数 */
+		unsigned long		turns;
+		/** @brief 処理されたメッセージの総数 */
+		unsigned long		processed;
+	} ActorSchedulerStat_t;
+	/**
+	 * @brief	Actor
+	 * @note	ThreadCallと同様に継承して仮想メソッド[onFunction]をラッピングし、
+	 * 			setFunctionにてメッセージを送信する事で使用します。
+	 * 			ThreadCallと異なりスレッドを持たず、メッセージが存在する間のみ
+	 * 			ActorSchedulerのワーカー上で実行されます。
+	 * 			同一アクターのonFunctionが並行して実行される事はありません。
+	 * 			メールボックスはロックフリー(複数送信者・単一受信者)であり、
+	 * 			待機中のアクターはスレッド・スタック・条件変数を使用しません。
+	 * 			破棄する場合はisIdleがtrueとなってから破棄してください。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class Actor
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief メールボックスの末尾(送信者が追加) */
+			std::atomic<ActorNode_t *>	head;
+			/** @brief メールボックスの先頭(実行中のワーカーのみ参照) */
+			ActorNode_t *				tail;
+			/** @brief メールボックスの番兵 */
+			ActorNode_t					stub;
+			/**
+			 * @brief 実行状態
+			 * 		  実行中に送信された場合はACTOR_STATE_PENDINGが付加されます。
+			 */
+			std::atomic<int>			state;
+			/** @brief ワーカーにて実行中か */
+			std::atomic<bool>			running;
+			/** @brief 実行するスケジューラ */
+			ActorScheduler *			scheduler;
+			/** @brief 実行待ちの次のアクター(スケジューラのミューテックスにて保護) */
+			Actor *						nextReady;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			void			push(ActorNode_t * node);
+			ActorNode_t *	pop();
+			bool			empty();
+			unsigned int	run(unsigned int batch , bool * stopped);
+			friend class ActorScheduler;
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			Actor(ActorScheduler * owner);
+			virtual ~Actor(void);
+			/* ***************************************************************
+			 * 仮想メソッド
+			 * ***************************************************************/
+			virtual bool	onFunction(void * Data);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			bool			setFunction(void * Data);
+			bool			setFunction(ThreadFunction * Func);
+			ActorState_t	getState();
+			bool			isIdle();
+	};
+	/**
+	 * @brief	ActorWorker
+	 * @note	ActorSchedulerのワーカー。シグナル受信時に実行待ちのアクターを
+	 * 			取り出して実行します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class ActorWorker : public ThreadCall
+	{
+		private:
+			/** @brief 所属するスケジューラ */
+			ActorScheduler *	scheduler;
+		public:
+			/** @brief 待機中か。スケジューラのミューテックスにて保護 */
+			bool				idle;
+			ActorWorker(ActorScheduler * owner , int size);
+			virtual ~ActorWorker(void);
+			virtual bool	onFunction();
+			using ThreadCall::onFunction;
+	};
+	/**
+	 * @brief	ActorScheduler
+	 * @note	少数のActorWorkerにて多数のアクターを実行します。
+	 * 			メッセージが送信されたアクターのみ実行待ちとなり、
+	 * 			1回の実行で処理するメッセージはbatch件までです。
+	 * 			残りがある場合は実行待ちの末尾へ戻される為、
+	 * 			メッセージの多いアクターが他のアクターを妨げる事はありません。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class ActorScheduler
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief ワーカー */
+			ActorWorker *		workers[MAX_ACTOR_WORKER];
+			/** @brief ワーカー数 */
+			unsigned int		workerCount;
+			/** @brief 1回の実行で処理するメッセージの最大数 */
+			unsigned int		batch;
+			/** @brief 実行待ちの先頭 */
+			Actor *				readyHead;
+			/** @brief 実行待ちの末尾 */
+			Actor *				readyTail;
+			/** @brief 実行待ちの数 */
+			unsigned long		readyCount;
+			/** @brief アクターが実行された総回数 */
+			unsigned long		turns;
+			/** @brief 処理されたメッセージの総数 */
+			std::atomic<unsigned long>	processed;
+			/** @brief 停止中か */
+			bool				stopping;
+			/** @brief 実行待ち保護用ミューテックス */
+			Mutex				mutex;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			void	schedule(Actor * actor);
+			Actor *	take(ActorWorker * worker);
+			void	run(Actor * actor);
+			friend class Actor;
+			friend class ActorWorker;
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			ActorScheduler(unsigned int threads = 4 , unsigned int batchSize = 64 , int stackSize = 0);
+			virtual ~ActorScheduler(void);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			void	stop();
+			void	getStat(ActorSchedulerStat_t * stat);
+	};
+}
+#endif /*VSTDACTOR_HPP_*/
@@ -0,0 +1,568 @@
+/* ***************************************************************************
+ * @file		VSTDAsyncIO.cpp
+ * @brief		非同期ファイル入出力(io_uring)用 Class
+ * @see		VSTDThreadCall.hpp / VSTDThreadPool.hpp / <linux/io_uring.h>
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "VSTDAsyncIO.hpp"
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <stdint.h>
+
+namespace VSTD
+{
+	/* ***********************************************************************
+	 *
+	 * AsyncIOReaper / AsyncIOFallback
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		Function
+	 * 				完了の受信
+	 * @note		eventfdを読み捨て、CQリングに格納された完了を受信します。
+	 * @return	監視を継続する為、常にtrueを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIOReaper::Function()
+	{
+		uint64_t value;
+		while (::read(getFd() , &value , sizeof(value)) > 0);
+		io->reap();
+		return true;
+	}
+	/**
+	 * @brief		Function
+	 * 				ブロッキングの入出力の実行
+	 * @return	常にtrueを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIOFallback::Function()
+	{
+		ssize_t result = 0;
+		switch (req->op)
+		{
+		case AIO_OP_READ:
+			result = pread(req->fd , req->buf , req->len , req->offset);
+			break;
+		case AIO_OP_WRITE:
+			result = pwrite(req->fd , req->buf , req->len , req->offset);
+			break;
+		case AIO_OP_FSYNC:
+			result = ::fsync(req->fd);
+			break;
+		}
+		if (result < 0)
+		{
+			result = -errno;
+		}
+		req->owner->complete(req , result);
+		return true;
+	}
+	/* ***********************************************************************
+	 *
+	 * コンストラクタ/デストラクタ
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		AsyncIOのコンストラクタ
+	 * @note		io_uringを作成し、完了受信用スレッドを開始します。
+	 * 				io_uringが使用出来ない場合は代替スレッドプールを作成します。
+	 * @param[in]	entries：SQリングの要素数を指定します。0の場合は代替スレッドプールを使用
+	 * @param[in]	fallback：代替スレッドプールの伸縮設定を指定します。NULLの場合は既定値
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	AsyncIO::AsyncIO(unsigned int entries , const ThreadPoolConfig_t * fallback)
+	{
+		ringFd			= -1;
+		eventFd			= -1;
+		sqRing			= MAP_FAILED;
+		sqRingSize		= 0;
+		cqRing			= MAP_FAILED;
+		cqRingSize		= 0;
+		sqes				= (struct io_uring_sqe *)MAP_FAILED;
+		sqesSize			= 0;
+		sqEntries			= 0;
+		cqEntries			= 0;
+		unsubmitted		= 0;
+		inflight			= 0;
+		submitted			= 0;
+		completed			= 0;
+		enters			= 0;
+		rejected			= 0;
+		reaperFunction	= NULL;
+		pool				= NULL;
+		/* 完了の積み上げ先が未指定の場合にも使用する */
+		reaper			= new ThreadCall();
+		reaper->setThreadType(TH_TYP_REACTOR);
+		if (entries > 0 && setup(entries))
+		{
+			reaperFunction = new AsyncIOReaper(this);
+			if (reaper->addWatch(eventFd , EPOLLIN , reaperFunction))
+			{
+				return;
+			}
+			delete reaperFunction;
+			reaperFunction = NULL;
+		}
+		teardown();
+		pool = new ThreadPool(fallback);
+	}
+	/**
+	 * @brief		AsyncIOのデストラクタ
+	 * @note		処理中の要求が全て完了するまで待機します。
+	 * 				破棄中に発生した例外は標準エラー出力へ出力し送出しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	AsyncIO::~AsyncIO(void)
+	{
+		try
+		{
+			submit();
+			while (inflight.load(std::memory_order_acquire) > 0)
+			{
+				Sleep(1);
+			}
+			delete pool;
+			if (reaperFunction)
+			{
+				reaper->removeWatch(eventFd);
+			}
+			delete reaper;
+			delete reaperFunction;
+			teardown();
+		}
+		catch(...)
+		{
+			/* デストラクタからは送出出来ない為、出力のみ行う */
+			fprintf(stderr , "[AsyncIO]:破棄中に例外が発生しました。\n");
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * パブリックメソッド
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		read
+	 * 				非同期読み込み
+	 * @param[in]	fd：読み込むファイルディスクリプタを指定します。
+	 * @param[out]	buf：読み込み先のバッファを指定します。
+	 * @param[in]	len：読み込むbyte数を指定します。
+	 * @param[in]	offset：ファイル内の位置を指定します。
+	 * @param[in]	handler：完了時に実行するAsyncIOFunctionを指定します。
+	 * @param[in]	target：handlerを積み上げるThreadCallを指定します。
+	 * 				NULLの場合は完了受信用スレッドにて実行します。
+	 * @param[in]	flush：falseの場合はsubmitまで送信しません。
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(処理中の上限超過)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::read(
+					int					fd
+				,	void *				buf
+				,	size_t				len
+				,	off_t				offset
+				,	AsyncIOFunction *	handler
+				,	ThreadCall *			target
+				,	bool				flush
+					)
+	{
+		return request(AIO_OP_READ , fd , buf , len , offset , handler , target , flush);
+	}
+	/**
+	 * @brief		write
+	 * 				非同期書き込み
+	 * @note		短い書き込みとなった場合も、処理したbyte数のまま完了します。
+	 * @param[in]	fd：書き込むファイルディスクリプタを指定します。
+	 * @param[in]	buf：書き込むデータを指定します。
+	 * @param[in]	len：書き込むbyte数を指定します。
+	 * @param[in]	offset：ファイル内の位置を指定します。
+	 * @param[in]	handler：完了時に実行するAsyncIOFunctionを指定します。
+	 * @param[in]	target：handlerを積み上げるThreadCallを指定します。
+	 * @param[in]	flush：falseの場合はsubmitまで送信しません。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::write(
+					int					fd
+				,	const void *		buf
+				,	size_t				len
+				,	off_t				offset
+				,	AsyncIOFunction *	handler
+				,	ThreadCall *			target
+				,	bool				flush
+					)
+	{
+		return request(AIO_OP_WRITE , fd , (void *)buf , len , offset , handler , target , flush);
+	}
+	/**
+	 * @brief		fsync
+	 * 				非同期同期
+	 * @note		io_uring使用時は先に送信された要求の完了後に実行されます。
+	 * 				代替スレッドプールでは順序は保証されない為、
+	 * 				書き込みの完了を待ってから要求してください。
+	 * @param[in]	fd：同期するファイルディスクリプタを指定します。
+	 * @param[in]	handler：完了時に実行するAsyncIOFunctionを指定します。
+	 * @param[in]	target：handlerを積み上げるThreadCallを指定します。
+	 * @param[in]	flush：falseの場合はsubmitまで送信しません。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::fsync(
+					int					fd
+				,	AsyncIOFunction *	handler
+				,	ThreadCall *			target
+				,	bool				flush
+					)
+	{
+		return request(AIO_OP_FSYNC , fd , NULL , 0 , 0 , handler , target , flush);
+	}
+	/**
+	 * @brief		submit
+	 * 				送信待ちの要求の送信
+	 * @note		flushにfalseを指定して積み上げた要求を
+	 * 				1回のio_uring_enterにてまとめて送信します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::submit()
+	{
+		bool result;
+		try
+		{
+			mutex.lock();
+			result = enter();
+			mutex.unlock();
+			return result;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		isUring
+	 * 				io_uringを使用しているかの取得
+	 * @return	io_uringを使用している場合はtrue、代替スレッドプールの場合はfalse
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::isUring()
+	{
+		return ringFd >= 0;
+	}
+	/**
+	 * @brief		getStat
+	 * 				統計情報の取得
+	 * @param[out]	stat：統計情報を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void AsyncIO::getStat(AsyncIOStat_t * stat)
+	{
+		mutex.lock();
+		stat->uring		= ringFd >= 0;
+		stat->inflight	= inflight.load(std::memory_order_relaxed);
+		stat->submitted	= submitted;
+		stat->completed	= completed.load(std::memory_order_relaxed);
+		stat->enters		= enters;
+		stat->rejected	= rejected;
+		mutex.unlock();
+	}
+	/**
+	 * @brief		reap
+	 * 				完了の受信
+	 * @note		CQリングに格納された完了を全て取り出し、
+	 * 				AsyncIOFunctionを積み上げます。完了受信用スレッドから呼び出されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void AsyncIO::reap()
+	{
+		unsigned int head = *cqHead;
+		while (head != __atomic_load_n(cqTail , __ATOMIC_ACQUIRE))
+		{
+			struct io_uring_cqe * cqe = &cqes[head & *cqMask];
+			AsyncIORequest_t * req = (AsyncIORequest_t *)(uintptr_t)cqe->user_data;
+			ssize_t result = cqe->res;
+			head++;
+			/* CQEを解放してから完了処理を行う */
+			__atomic_store_n(cqHead , head , __ATOMIC_RELEASE);
+			complete(req , result);
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * プライベートメソッド
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		setup
+	 * 				io_uringの作成
+	 * @note		io_uring_setupにてリングを作成し、SQ/CQリングとSQEを
+	 * 				マッピングして完了通知用のeventfdを登録します。
+	 * @param[in]	entries：SQリングの要素数を指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::setup(unsigned int entries)
+	{
+		struct io_uring_params params;
+		memset(&params , 0 , sizeof(params));
+		ringFd = (int)syscall(__NR_io_uring_setup , entries , &params);
+		if (ringFd < 0)
+		{
+			ringFd = -1;
+			return false;
+		}
+		sqRingSize	= params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+		cqRingSize	= params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+		sqesSize		= params.sq_entries * sizeof(struct io_uring_sqe);
+		/* SQ/CQリングを1回でマッピング出来る場合 */
+		if (params.features & IORING_FEAT_SINGLE_MMAP)
+		{
+			if (cqRingSize > sqRingSize) sqRingSize = cqRingSize;
+			cqRingSize = sqRingSize;
+		}
+		sqRing = mmap(NULL , sqRingSize , PROT_READ | PROT_WRITE
+					, MAP_SHARED | MAP_POPULATE , ringFd , IORING_OFF_SQ_RING);
+		if (sqRing == MAP_FAILED) return false;
+		if (params.features & IORING_FEAT_SINGLE_MMAP)
+		{
+			cqRing = sqRing;
+		}
+		else
+		{
+			cqRing = mmap(NULL , cqRingSize , PROT_READ | PROT_WRITE
+						, MAP_SHARED | MAP_POPULATE , ringFd , IORING_OFF_CQ_RING);
+			if (cqRing == MAP_FAILED) return false;
+		}
+		sqes = (struct io_uring_sqe *)mmap(NULL , sqesSize , PROT_READ | PROT_WRITE
+					, MAP_SHARED | MAP_POPULATE , ringFd , IORING_OFF_SQES);
+		if (sqes == MAP_FAILED) return false;
+		sqHead	= (unsigned int *)((char *)sqRing + params.sq_off.head);
+		sqTail	= (unsigned int *)((char *)sqRing + params.sq_off.tail);
+		sqMask	= (unsigned int *)((char *)sqRing + params.sq_off.ring_mask);
+		sqArray	= (unsigned int *)((char *)sqRing + params.sq_off.array);
+		cqHead	= (unsigned int *)((char *)cqRing + params.cq_off.head);
+		cqTail	= (unsigned int *)((char *)cqRing + params.cq_off.tail);
+		cqMask	= (unsigned int *)((char *)cqRing + params.cq_off.ring_mask);
+		cqes		= (struct io_uring_cqe *)((char *)cqRing + params.cq_off.cqes);
+		sqEntries	= params.sq_entries;
+		cqEntries	= params.cq_entries;
+		/* 完了通知用のeventfdを登録 */
+		eventFd = eventfd(0 , EFD_NONBLOCK | EFD_CLOEXEC);
+		if (eventFd < 0) return false;
+		if (syscall(__NR_io_uring_register , ringFd , IORING_REGISTER_EVENTFD , &eventFd , 1) != 0)
+		{
+			return false;
+		}
+		return true;
+	}
+	/**
+	 * @brief		teardown
+	 * 				io_uringの破棄
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void AsyncIO::teardown()
+	{
+		if (sqes != MAP_FAILED) munmap(sqes , sqesSize);
+		if (cqRing != MAP_FAILED && cqRing != sqRing) munmap(cqRing , cqRingSize);
+		if (sqRing != MAP_FAILED) munmap(sqRing , sqRingSize);
+		if (eventFd >= 0) close(eventFd);
+		if (ringFd >= 0) close(ringFd);
+		sqes		= (struct io_uring_sqe *)MAP_FAILED;
+		cqRing	= MAP_FAILED;
+		sqRing	= MAP_FAILED;
+		eventFd	= -1;
+		ringFd	= -1;
+	}
+	/**
+	 * @brief		request
+	 * 				要求の積み上げ
+	 * @note		io_uring使用時はSQEを作成しSQリングへ追加します。
+	 * 				SQリングが満杯の場合は送信待ちを送信してから追加します。
+	 * 				CQリングの溢れを防止する為、処理中の数はCQリングの要素数までです。
+	 * 				flush指定時にio_uring_enterが失敗した場合も要求はSQリングに
+	 * 				追加済みで次回の送信時に送信される為、成功を返却します。
+	 * 				失敗を返却した場合はhandlerのステータスは元に戻され、
+	 * 				buf・handlerが参照される事はありません。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::request(
+					AsyncIOOp_t			op
+				,	int					fd
+				,	void *				buf
+				,	size_t				len
+				,	off_t				offset
+				,	AsyncIOFunction *	handler
+				,	ThreadCall *			target
+				,	bool				flush
+					)
+	{
+		try
+		{
+			if (!handler) return false;
+			AsyncIORequest_t * req = new AsyncIORequest_t;
+			req->op		= op;
+			req->fd		= fd;
+			req->buf		= buf;
+			req->len		= len;
+			req->offset	= offset;
+			req->handler	= handler;
+			req->target	= target ? target : reaper;
+			req->owner	= this;
+			functionstatus_t previous = handler->getStatus();
+			handler->setStatus(THFUNC_STATE_WAITING);
+			/* ***************************************************************
+			 * io_uringが使用出来ない場合は代替スレッドプールにて実行
+			 * ***************************************************************/
+			if (ringFd < 0)
+			{
+				inflight.fetch_add(1 , std::memory_order_relaxed);
+				AsyncIOFallback * task = new AsyncIOFallback(req);
+				if (!pool->setFunction(task))
+				{
+					inflight.fetch_sub(1 , std::memory_order_relaxed);
+					mutex.lock();
+					rejected++;
+					mutex.unlock();
+					delete task;
+					delete req;
+					handler->setStatus(previous);
+					return false;
+				}
+				mutex.lock();
+				submitted++;
+				mutex.unlock();
+				return true;
+			}
+			/* ***************************************************************
+			 * SQEを作成してSQリングへ追加
+			 * ***************************************************************/
+			mutex.lock();
+			if (inflight.load(std::memory_order_relaxed) >= cqEntries)
+			{
+				rejected++;
+				mutex.unlock();
+				delete req;
+				handler->setStatus(previous);
+				return false;
+			}
+			unsigned int tail = *sqTail;
+			if (tail - __atomic_load_n(sqHead , __ATOMIC_ACQUIRE) >= sqEntries)
+			{
+				enter();
+				if (tail - __atomic_load_n(sqHead , __ATOMIC_ACQUIRE) >= sqEntries)
+				{
+					rejected++;
+					mutex.unlock();
+					delete req;
+					handler->setStatus(previous);
+					return false;
+				}
+			}
+			unsigned int index = tail & *sqMask;
+			struct io_uring_sqe * sqe = &sqes[index];
+			memset(sqe , 0 , sizeof(*sqe));
+			sqe->fd			= fd;
+			sqe->user_data	= (uint64_t)(uintptr_t)req;
+			switch (op)
+			{
+			case AIO_OP_READ:
+				sqe->opcode	= IORING_OP_READ;
+				sqe->addr		= (uint64_t)(uintptr_t)buf;
+				sqe->len		= (uint32_t)len;
+				sqe->off		= (uint64_t)offset;
+				break;
+			case AIO_OP_WRITE:
+				sqe->opcode	= IORING_OP_WRITE;
+				sqe->addr		= (uint64_t)(uintptr_t)buf;
+				sqe->len		= (uint32_t)len;
+				sqe->off		= (uint64_t)offset;
+				break;
+			case AIO_OP_FSYNC:
+				sqe->opcode	= IORING_OP_FSYNC;
+				/* 先に送信された要求の完了後に実行 */
+				sqe->flags	= IOSQE_IO_DRAIN;
+				break;
+			}
+			sqArray[index] = index;
+			__atomic_store_n(sqTail , tail + 1 , __ATOMIC_RELEASE);
+			unsubmitted++;
+			submitted++;
+			inflight.fetch_add(1 , std::memory_order_relaxed);
+			/* 送信に失敗した場合も次回の送信時に再送される為、失敗とはしない */
+			if (flush) enter();
+			mutex.unlock();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		enter
+	 * 				送信待ちの要求をio_uring_enterにて送信
+	 * @note		ミューテックスを取得した状態で呼び出してください。
+	 * 				送信出来なかった要求は次回の送信まで保持されます。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool AsyncIO::enter()
+	{
+		if (ringFd < 0 || unsubmitted == 0) return true;
+		int result = (int)syscall(__NR_io_uring_enter , ringFd , unsubmitted , 0 , 0 , NULL , 0);
+		enters++;
+		if (result < 0) return false;
+		unsubmitted -= result;
+		return true;
+	}
+	/**
+	 * @brief		complete
+	 * 				要求の完了
+	 * @note		AsyncIOFunctionに結果を設定し、指定されたThreadCallへ
+	 * 				積み上げます。積み上げに失敗した場合はその場で実行します。
+	 * @param[in]	req：完了した要求
+	 * @param[in]	result：処理したbyte数。失敗した場合は-errno
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void AsyncIO::complete(AsyncIORequest_t * req , ssize_t result)
+	{
+		AsyncIOFunction *	handler	= req->handler;
+		ThreadCall *		target	= req->target;
+		handler->op		= req->op;
+		handler->result	= result;
+		delete req;
+		completed.fetch_add(1 , std::memory_order_relaxed);
+		/* 積み上げられない場合はこのスレッドにて実行 */
+		if (!target->setFunction(handler))
+		{
+			handler->execute();
+		}
+		inflight.fetch_sub(1 , std::memory_order_release);
+	}
+}
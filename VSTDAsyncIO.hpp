@@ -0,0 +1,269 @@
+/* ***************************************************************************
+ * @file		VSTDAsyncIO.hpp
+ * @brief		非同期ファイル入出力(io_uring)用 Class
+ * @see		VSTDThreadCall.hpp / VSTDThreadPool.hpp / <linux/io_uring.h>
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDASYNCIO_HPP_
+#define VSTDASYNCIO_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <sys/types.h>
+#include <linux/io_uring.h>
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+#include "VSTDThreadPool.hpp"
+
+namespace VSTD
+{
+	/**
+	 * @brief		非同期入出力の種別を定義している列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief 読み込み(pread) */
+		AIO_OP_READ,
+		/** @brief 書き込み(pwrite) */
+		AIO_OP_WRITE,
+		/** @brief 同期(fsync) */
+		AIO_OP_FSYNC
+	} AsyncIOOp_t;
+	class AsyncIO;
+	/**
+	 * @brief		AsyncIOFunction
+	 * @note		非同期入出力の完了時に、指定されたThreadCallの待ち行列へ
+	 * 				積み上げられるThreadFunctionです。
+	 * 				Function内にてgetResultにより結果を取得します。
+	 * 				自動解放を指定した場合は実行後に破棄されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class AsyncIOFunction : public ThreadFunction
+	{
+	private:
+		/** @brief 入出力の種別 */
+		AsyncIOOp_t	op;
+		/** @brief 処理したbyte数。失敗した場合は-errno */
+		ssize_t		result;
+		friend class AsyncIO;
+	public:
+		AsyncIOFunction() : op(AIO_OP_READ) , result(0) {}
+		virtual ~AsyncIOFunction() {}
+		/** @brief 入出力の種別を取得します。 */
+		AsyncIOOp_t getOp() { return op; }
+		/** @brief 処理したbyte数を取得します。失敗した場合は-errnoを返却します。 */
+		ssize_t getResult() { return result; }
+	};
+	/**
+	 * @brief		AsyncIOReaper
+	 * @note		eventfdの通知を受けてio_uringの完了を受信します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class AsyncIOReaper : public ReactorFunction
+	{
+	private:
+		/** @brief 所属するAsyncIO */
+		AsyncIO *	io;
+	public:
+		AsyncIOReaper(AsyncIO * owner) : io(owner) {}
+		bool Function();
+	};
+	/**
+	 * @brief		非同期入出力の要求
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 入出力の種別 */
+		AsyncIOOp_t			op;
+		/** @brief ファイルディスクリプタ */
+		int					fd;
+		/** @brief 入出力用バッファ */
+		void *				buf;
+		/** @brief バッファの長さ */
+		size_t				len;
+		/** @brief ファイル内の位置 */
+		off_t				offset;
+		/** @brief 完了時に実行するAsyncIOFunction */
+		AsyncIOFunction *	handler;
+		/** @brief 完了時に積み上げるThreadCall */
+		ThreadCall *			target;
+		/** @brief 所属するAsyncIO */
+		AsyncIO *			owner;
+	} AsyncIORequest_t;
+	/**
+	 * @brief		AsyncIOFallback
+	 * @note		io_uringが使用出来ない場合にThreadPoolにて
+	 * 				ブロッキングの入出力を実行するThreadFunctionです。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class AsyncIOFallback : public ThreadFunction
+	{
+	private:
+		/** @brief 実行する要求 */
+		AsyncIORequest_t *	req;
+	public:
+		AsyncIOFallback(AsyncIORequest_t * request) : req(request)
+		{
+			setAutoRelease(true);
+		}
+		bool Function();
+	};
+	/**
+	 * @brief		非同期入出力の統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief io_uringを使用しているか */
+		bool				uring;
+		/** @brief 処理中の数 */
+		unsigned int		inflight;
+		/** @brief 要求された総数 */
+		unsigned long		submitted;
+		/** @brief 完了した総数 */
+		unsigned long		completed;
+		/** @brief io_uring_enterの呼び出し回数 */
+		unsigned long		enters;
+		/** @brief 処理中の上限超過により拒否された総数 */
+		unsigned long		rejected;
+	} AsyncIOStat_t;
+	/**
+	 * @brief	AsyncIO
+	 * @note	read/write/fsyncをio_uringにて非同期に処理し、完了時に
+	 * 			AsyncIOFunctionを指定されたThreadCallへ積み上げます。
+	 * 			flushにfalseを指定した要求は送信待ちとなり、submitにて
+	 * 			まとめて1回のio_uring_enterで送信されます。
+	 * 			完了の受信はTH_TYP_REACTORのThreadCallにてeventfdを監視して行います。
+	 * 			io_uringが使用出来ない場合は、ThreadPoolにて
+	 * 			pread/pwrite/fsyncを実行します。
+	 * 			処理中のバッファは完了まで解放しないでください。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class AsyncIO
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief io_uringのファイルディスクリプタ。未使用の場合は-1 */
+			int							ringFd;
+			/** @brief 完了通知用のeventfd */
+			int							eventFd;
+			/** @brief SQリングの領域 */
+			void *						sqRing;
+			/** @brief SQリングの領域サイズ */
+			size_t						sqRingSize;
+			/** @brief CQリングの領域 */
+			void *						cqRing;
+			/** @brief CQリングの領域サイズ */
+			size_t						cqRingSize;
+			/** @brief SQEの領域 */
+			struct io_uring_sqe *		sqes;
+			/** @brief SQEの領域サイズ */
+			size_t						sqesSize;
+			/** @brief SQリングの各領域 */
+			unsigned int *				sqHead;
+			unsigned int *				sqTail;
+			unsigned int *				sqMask;
+			unsigned int *				sqArray;
+			/** @brief SQリングの要素数 */
+			unsigned int				sqEntries;
+			/** @brief CQリングの各領域 */
+			unsigned int *				cqHead;
+			unsigned int *				cqTail;
+			unsigned int *				cqMask;
+			struct io_uring_cqe *		cqes;
+			/** @brief CQリングの要素数(処理中の上限) */
+			unsigned int				cqEntries;
+			/** @brief 送信待ちの数 */
+			unsigned int				unsubmitted;
+			/** @brief 処理中の数 */
+			std::atomic<unsigned int>	inflight;
+			/** @brief 要求された総数 */
+			unsigned long				submitted;
+			/** @brief 完了した総数 */
+			std::atomic<unsigned long>	completed;
+			/** @brief io_uring_enterの呼び出し回数 */
+			unsigned long				enters;
+			/** @brief 処理中の上限超過により拒否された総数 */
+			unsigned long				rejected;
+			/** @brief 完了受信用スレッド */
+			ThreadCall *				reaper;
+			/** @brief 完了受信用ReactorFunction */
+			AsyncIOReaper *				reaperFunction;
+			/** @brief io_uringが使用出来ない場合の代替スレッドプール */
+			ThreadPool *				pool;
+			/** @brief SQリング保護用ミューテックス */
+			Mutex						mutex;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			bool	setup(unsigned int entries);
+			void	teardown();
+			bool	request(
+						AsyncIOOp_t			op
+					,	int					fd
+					,	void *				buf
+					,	size_t				len
+					,	off_t				offset
+					,	AsyncIOFunction *	handler
+					,	ThreadCall *			target
+					,	bool				flush
+						);
+			bool	enter();
+			void	complete(AsyncIORequest_t * req , ssize_t result);
+			friend class AsyncIOFallback;
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			AsyncIO(unsigned int entries = 256 , const ThreadPoolConfig_t * fallback = NULL);
+			virtual ~AsyncIO(void);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			bool	read(
+						int					fd
+					,	void *				buf
+					,	size_t				len
+					,	off_t				offset
+					,	AsyncIOFunction *	handler
+					,	ThreadCall *			target = NULL
+					,	bool				flush = true
+						);
+			bool	write(
+						int					fd
+					,	const void *		buf
+					,	size_t				len
+					,	off_t				offset
+					,	AsyncIOFunction *	handler
+					,	ThreadCall *			target = NULL
+					,	bool				flush = true
+						);
+			bool	fsync(
+						int					fd
+					,	AsyncIOFunction *	handler
+					,	ThreadCall *			target = NULL
+					,	bool				flush = true
+						);
+			bool	submit();
+			bool	isUring();
+			void	getStat(AsyncIOStat_t * stat);
+			void	reap();
+	};
+}
+#endif /*VSTDASYNCIO_HPP_*/
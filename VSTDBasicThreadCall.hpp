@@ -0,0 +1,679 @@
+/* ***************************************************************************
+ * @file		VSTDBasicThreadCall.hpp
+ * @brief		ポリシー指定によるスレッド呼び出し用 Class テンプレート
+ * @see		VSTDThreadCall.hpp / VSTDFutex.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 停止時に未実行の要素を待ち行列へ戻す様に修正
+ * ***************************************************************************/
+#ifndef VSTDBASICTHREADCALL_HPP_
+#define VSTDBASICTHREADCALL_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <new>
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief 一度のロックで待ち行列から取り出す最大数 */
+	#define BASIC_DRAIN 32
+	/** @brief SpinWaitPolicyにてsched_yieldするまでの試行回数 */
+	#define BASIC_SPIN 256
+	/* ***************************************************************************
+	 * ロックポリシー
+	 * lock/unlockを持ち、待ち行列の操作を保護します。
+	 * ***************************************************************************/
+	/**
+	 * @brief		MutexLockPolicy
+	 * @note		Mutexにて保護します。ThreadCallと同等です。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class MutexLockPolicy
+	{
+		private:
+			/** @brief ミューテックス */
+			Mutex	mutex;
+		public:
+			void lock()
+			{
+				mutex.lock();
+			}
+			void unlock()
+			{
+				mutex.unlock();
+			}
+	};
+	/**
+	 * @brief		SpinLockPolicy
+	 * @note		atomicのフラグにて保護します。保持時間が短く、
+	 * 				生産者が少ない場合にシステムコールを回避します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class SpinLockPolicy
+	{
+		private:
+			/** @brief 取得中か */
+			std::atomic<bool>	locked;
+		public:
+			SpinLockPolicy(void) : locked(false) {}
+			void lock()
+			{
+				unsigned int spin = 0;
+				while (locked.exchange(true , std::memory_order_acquire))
+				{
+					while (locked.load(std::memory_order_relaxed))
+					{
+						if (++spin % BASIC_SPIN == 0)
+						{
+							sched_yield();
+						}
+					}
+				}
+			}
+			void unlock()
+			{
+				locked.store(false , std::memory_order_release);
+			}
+	};
+	/**
+	 * @brief		NullLockPolicy
+	 * @note		保護しません。単一の生産者からのみ積み上げ、
+	 * 				待ち行列ポリシーが単一生産者・単一消費者に対応している場合に使用します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class NullLockPolicy
+	{
+		public:
+			void lock()
+			{
+			}
+			void unlock()
+			{
+			}
+	};
+	/* ***************************************************************************
+	 * 待ち行列ポリシー
+	 * value_type、push/pushFront/pop/size/capacityを持ちます。
+	 * pushFrontは取り出した要素を次に取り出される位置へ戻します。
+	 * ロックポリシーにて保護されます。
+	 * ***************************************************************************/
+	/**
+	 * @brief		FifoQueuePolicy
+	 * @note		容量固定のリングにより先入れ先出しで取り出します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	template <class T , size_t Depth>
+	class FifoQueuePolicy
+	{
+		private:
+			/** @brief 要素 */
+			T		items[Depth];
+			/** @brief 先頭位置 */
+			size_t	head;
+			/** @brief 要素数 */
+			size_t	count;
+		public:
+			typedef T value_type;
+			FifoQueuePolicy(void) : head(0) , count(0) {}
+			bool push(const T & item)
+			{
+				if (count >= Depth) return false;
+				items[(head + count) % Depth] = item;
+				count++;
+				return true;
+			}
+			bool pushFront(const T & item)
+			{
+				if (count >= Depth) return false;
+				head = (head + Depth - 1) % Depth;
+				items[head] = item;
+				count++;
+				return true;
+			}
+			bool pop(T & item)
+			{
+				if (count == 0) return false;
+				item = items[head];
+				head = (head + 1) % Depth;
+				count--;
+				return true;
+			}
+			size_t size()
+			{
+				return count;
+			}
+			size_t capacity()
+			{
+				return Depth;
+			}
+	};
+	/**
+	 * @brief		LifoQueuePolicy
+	 * @note		容量固定のスタックにより後入れ先出しで取り出します。
+	 * 				ThreadCallの既定(TH_SCHED_LIFO)と同等です。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	template <class T , size_t Depth>
+	class LifoQueuePolicy
+	{
+		private:
+			/** @brief 要素 */
+			T		items[Depth];
+			/** @brief 要素数 */
+			size_t	count;
+		public:
+			typedef T value_type;
+			LifoQueuePolicy(void) : count(0) {}
+			bool push(const T & item)
+			{
+				if (count >= Depth) return false;
+				items[count++] = item;
+				return true;
+			}
+			bool pushFront(const T & item)
+			{
+				return push(item);
+			}
+			bool pop(T & item)
+			{
+				if (count == 0) return false;
+				item = items[--count];
+				return true;
+			}
+			size_t size()
+			{
+				return count;
+			}
+			size_t capacity()
+			{
+				return Depth;
+			}
+	};
+	/* ***************************************************************************
+	 * 待機ポリシー
+	 * 待ち行列が空の場合のワーカーの待機方法です。
+	 * prepareの後に待ち行列を再確認し、空の場合のみwaitを呼び出します。
+	 * ***************************************************************************/
+	/**
+	 * @brief		FutexWaitPolicy
+	 * @note		futexにて待機し、待機中の場合のみ起床させます。
+	 * 				待機者が居ない場合の積み上げはシステムコールを呼び出しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class FutexWaitPolicy
+	{
+		private:
+			/** @brief 起床用futex */
+			std::atomic<int>	seq;
+			/** @brief ワーカーが待機中か */
+			std::atomic<int>	waiting;
+		public:
+			FutexWaitPolicy(void) : seq(0) , waiting(0) {}
+			int prepare()
+			{
+				waiting.store(1 , std::memory_order_seq_cst);
+				return seq.load(std::memory_order_seq_cst);
+			}
+			void cancel()
+			{
+				waiting.store(0 , std::memory_order_relaxed);
+			}
+			void wait(int key , long long timeoutNs)
+			{
+				FutexWait(&seq , key , timeoutNs);
+				waiting.store(0 , std::memory_order_relaxed);
+			}
+			void notify()
+			{
+				seq.fetch_add(1 , std::memory_order_seq_cst);
+				if (waiting.load(std::memory_order_seq_cst))
+				{
+					FutexWake(&seq , 1);
+				}
+			}
+	};
+	/**
+	 * @brief		ConditionWaitPolicy
+	 * @note		Conditionにて待機します。ThreadCallと同等です。
+	 * 				タイムアウトは使用されません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class ConditionWaitPolicy
+	{
+		private:
+			/** @brief 条件変数 */
+			Condition			condition;
+			/** @brief ワーカーが待機中か */
+			std::atomic<int>	waiting;
+		public:
+			ConditionWaitPolicy(void) : waiting(0) {}
+			int prepare()
+			{
+				waiting.store(1 , std::memory_order_seq_cst);
+				return 0;
+			}
+			void cancel()
+			{
+				waiting.store(0 , std::memory_order_relaxed);
+			}
+			void wait(int /* key */ , long long /* timeoutNs */)
+			{
+				condition.wait();
+				waiting.store(0 , std::memory_order_relaxed);
+			}
+			void notify()
+			{
+				if (waiting.load(std::memory_order_seq_cst))
+				{
+					condition.set();
+				}
+			}
+	};
+	/**
+	 * @brief		SpinWaitPolicy
+	 * @note		待機せずにスピンし、一定回数毎にsched_yieldします。
+	 * 				CPUを占有する代わりに起床の遅延と積み上げ側のコストが最小となります。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class SpinWaitPolicy
+	{
+		private:
+			/** @brief 空の待ち行列を確認した回数 */
+			unsigned int	spin;
+		public:
+			SpinWaitPolicy(void) : spin(0) {}
+			int prepare()
+			{
+				return 0;
+			}
+			void cancel()
+			{
+				spin = 0;
+			}
+			void wait(int /* key */ , long long /* timeoutNs */)
+			{
+				if (++spin % BASIC_SPIN == 0)
+				{
+					sched_yield();
+				}
+			}
+			void notify()
+			{
+			}
+	};
+	/**
+	 * @brief		ThreadFunctionHandler
+	 * @note		ThreadFunctionを実行するハンドラです。
+	 * 				ThreadCall::onFunctionと同様にステータスの更新と自動解放を行います。
+	 * 				実行中に再度積み上げられた場合は完了とせず、破棄もしません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	struct ThreadFunctionHandler
+	{
+		bool operator()(ThreadFunction * Func)
+		{
+			/* 再度積み上げられた場合は待ち行列にある */
+			return Func->execute();
+		}
+	};
+	/**
+	 * @brief	BasicThreadCall
+	 * @note	ハンドラ、待ち行列、待機、ロックの各方式をテンプレート引数にて
+	 * 			コンパイル時に指定するThreadCallです。
+	 * 			ハンドラは仮想関数を経由せずに直接呼び出される為インライン化され、
+	 * 			実行種別等の実行時の判定もありません。
+	 * 			処理時間の短い処理を大量に実行する場合に使用します。
+	 * 			HandlerはQueuePolicy::value_typeを受け取るbool operator()を持ち、
+	 * 			falseを返却した場合はスレッドを停止し、取り出し済みで未実行の要素は
+	 * 			待ち行列の先頭へ戻され、再開後に実行されます。
+	 * 			ワーカーは一度のロックで最大BASIC_DRAIN個を取り出して実行します。
+	 * 			取り出し済みの要素の分は戻せる様に積み上げ側から予約されます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	template <
+		class Handler
+	,	class QueuePolicy	= FifoQueuePolicy<ThreadFunction * , 4096>
+	,	class WaitPolicy	= FutexWaitPolicy
+	,	class LockPolicy	= MutexLockPolicy
+	>
+	class BasicThreadCall
+	{
+		public:
+			typedef typename QueuePolicy::value_type value_type;
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief ハンドラ */
+			Handler				handler;
+			/** @brief スレッド実行フラグ */
+			std::atomic<bool>	running;
+			/** @brief スレッドのアイドリング時間(ナノ秒)。0の場合は無期限 */
+			long long			idle;
+			/** @brief 実行スレッド用スレッドID */
+			pthread_t			threadhandle;
+			/** @brief スレッドを作成済みか */
+			bool				joinable;
+			/** @brief 処理された総数 */
+			std::atomic<unsigned long>	processed;
+			/** @brief 取り出し済みで実行中の要素数(ロックにて保護) */
+			size_t				held;
+			/** @brief 待機方式 */
+			alignas(TH_CACHE_LINE)
+			WaitPolicy			waiter;
+			/** @brief 待ち行列保護用ロック */
+			alignas(TH_CACHE_LINE)
+			LockPolicy			lock;
+			/** @brief 待ち行列 */
+			QueuePolicy			queue;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			BasicThreadCall(const BasicThreadCall &);
+			BasicThreadCall & operator=(const BasicThreadCall &);
+			/**
+			 * @brief		drain
+			 * 				待ち行列からまとめて取り出す
+			 * @param[out]	items：取り出した要素を格納します。
+			 * @return	取り出した数を返却します。
+			 */
+			size_t drain(value_type * items)
+			{
+				size_t num = 0;
+				lock.lock();
+				while (num < BASIC_DRAIN && queue.pop(items[num]))
+				{
+					num++;
+				}
+				/* 前回取り出した分は実行済み */
+				held = num;
+				lock.unlock();
+				return num;
+			}
+			/**
+			 * @brief		restore
+			 * 				未実行の要素を待ち行列の先頭へ戻す
+			 * @note		取り出し済みの分は予約されている為、失敗しません。
+			 * @param[in]	items：未実行の要素
+			 * @param[in]	num：要素数
+			 */
+			void restore(const value_type * items , size_t num)
+			{
+				lock.lock();
+				for (size_t i = num ; i > 0 ; i--)
+				{
+					queue.pushFront(items[i - 1]);
+				}
+				held = 0;
+				lock.unlock();
+			}
+			/**
+			 * @brief		run
+			 * 				ワーカーの処理
+			 * @note		待ち行列が空になるまで実行し、空の場合は待機方式に従い待機します。
+			 */
+			void run()
+			{
+				value_type	items[BASIC_DRAIN];
+				while (running.load(std::memory_order_acquire))
+				{
+					size_t num = drain(items);
+					if (num == 0)
+					{
+						/* 待機の準備後に再確認し、空の場合のみ待機 */
+						int key = waiter.prepare();
+						num = drain(items);
+						if (num == 0)
+						{
+							if (!running.load(std::memory_order_seq_cst))
+							{
+								waiter.cancel();
+								break;
+							}
+							waiter.wait(key , idle);
+							continue;
+						}
+						waiter.cancel();
+					}
+					for (size_t i = 0 ; i < num ; i++)
+					{
+						if (!handler(items[i]))
+						{
+							running.store(false , std::memory_order_release);
+							processed.fetch_add(i + 1 , std::memory_order_relaxed);
+							/* 未実行の分は失われない様に戻す */
+							restore(items + i + 1 , num - i - 1);
+							return;
+						}
+					}
+					processed.fetch_add(num , std::memory_order_relaxed);
+				}
+			}
+			/**
+			 * @brief		entry
+			 * 				スレッドの開始位置
+			 */
+			static void * entry(void * arg)
+			{
+				((BasicThreadCall *)arg)->run();
+				return (void *)0;
+			}
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			/**
+			 * @brief		BasicThreadCallのコンストラクタ
+			 * @note		スレッドを開始します。
+			 * @param[in]	h：ハンドラを指定します。
+			 */
+			BasicThreadCall(const Handler & h = Handler())
+			:	handler(h)
+			,	running(false)
+			,	idle(0)
+			,	joinable(false)
+			,	processed(0)
+			,	held(0)
+			{
+				start();
+			}
+			/**
+			 * @brief		operator new
+			 * @note		メンバのキャッシュライン分離を有効にする為、
+			 * 				キャッシュライン境界に確保します。
+			 * @param[in]	size：確保するサイズ
+			 */
+			static void * operator new(size_t size)
+			{
+				void * ptr;
+				if (posix_memalign(&ptr , TH_CACHE_LINE , size) != 0)
+				{
+					throw std::bad_alloc();
+				}
+				return ptr;
+			}
+			static void operator delete(void * ptr)
+			{
+				free(ptr);
+			}
+			/**
+			 * @brief		BasicThreadCallのデストラクタ
+			 * @note		スレッドを停止します。待ち行列に残っている要素は実行されません。
+			 */
+			~BasicThreadCall(void)
+			{
+				stop();
+			}
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			/**
+			 * @brief		start
+			 * 				スレッドの開始
+			 * @return	成否を返却します。
+			 * @retval	true ： 成功(開始済みの場合を含む)
+			 * @retval	false： 失敗
+			 */
+			bool start()
+			{
+				if (running.load(std::memory_order_acquire)) return true;
+				if (joinable)
+				{
+					pthread_join(threadhandle , NULL);
+					joinable = false;
+				}
+				running.store(true , std::memory_order_release);
+				if (pthread_create(&threadhandle , NULL , entry , this) != 0)
+				{
+					perror("BasicThreadCall::start");
+					running.store(false , std::memory_order_release);
+					return false;
+				}
+				joinable = true;
+				return true;
+			}
+			/**
+			 * @brief		stop
+			 * 				スレッドの停止
+			 * @note		実行中の処理の完了を待機してスレッドを停止します。
+			 * 				待機方式のnotifyが待機中かを読み込む前に停止が見える様、
+			 * 				seq_cstにて格納します。
+			 */
+			void stop()
+			{
+				running.store(false , std::memory_order_seq_cst);
+				waiter.notify();
+				if (joinable)
+				{
+					pthread_join(threadhandle , NULL);
+					joinable = false;
+				}
+				/* 最後に取り出した分は実行済みの為、予約を解除 */
+				lock.lock();
+				held = 0;
+				lock.unlock();
+			}
+			/**
+			 * @brief		push
+			 * 				要素の積み上げ
+			 * @param[in]	item：積み上げる要素を指定します。
+			 * @return	成否を返却します。
+			 * @retval	true ： 成功
+			 * @retval	false： 失敗(待ち行列が満杯)
+			 */
+			bool push(const value_type & item)
+			{
+				lock.lock();
+				bool result = queue.size() + held < queue.capacity() && queue.push(item);
+				lock.unlock();
+				if (result)
+				{
+					waiter.notify();
+				}
+				return result;
+			}
+			/**
+			 * @brief		setIdle
+			 * 				待機のタイムアウトの設定
+			 * @note		待機ポリシーが対応している場合、指定した時間毎に起床して
+			 * 				待ち行列を確認します。
+			 * @param[in]	timeout：タイムアウト(ミリ秒)。0の場合は無期限
+			 */
+			void setIdle(long timeout)
+			{
+				idle = (long long)timeout * 1000000LL;
+			}
+			/**
+			 * @brief		size
+			 * 				待ち行列の要素数の取得
+			 * @return	要素数を返却します。
+			 */
+			size_t size()
+			{
+				lock.lock();
+				size_t num = queue.size();
+				lock.unlock();
+				return num;
+			}
+			/**
+			 * @brief		getProcessed
+			 * 				処理された総数の取得
+			 * @return	処理された総数を返却します。
+			 */
+			unsigned long getProcessed()
+			{
+				return processed.load(std::memory_order_relaxed);
+			}
+			/**
+			 * @brief		isRunning
+			 * 				スレッドが実行中かの取得
+			 * @return	実行中の場合はtrue
+			 */
+			bool isRunning()
+			{
+				return running.load(std::memory_order_acquire);
+			}
+			/**
+			 * @brief		getHandler
+			 * 				ハンドラの取得
+			 * @return	ハンドラを返却します。
+			 */
+			Handler & getHandler()
+			{
+				return handler;
+			}
+	};
+	/**
+	 * @brief	FunctionThreadCall
+	 * @note	ThreadFunctionを先入れ先出しで実行するBasicThreadCallです。
+	 * 			ThreadCall::setFunctionと同様にステータスを実行待ちとして積み上げます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class FunctionThreadCall : public BasicThreadCall<ThreadFunctionHandler>
+	{
+		public:
+			/**
+			 * @brief		setFunction
+			 * 				ThreadFunctionの積み上げ
+			 * @param[in]	Func：追加するThreadFunctionを指定
+			 * @return	成否を返却します。
+			 * @retval	true ： 成功
+			 * @retval	false： 失敗(待ち行列が満杯)
+			 */
+			bool setFunction(ThreadFunction * Func)
+			{
+				if (!Func) return false;
+				functionstatus_t previous = Func->getStatus();
+				Func->setStatus(THFUNC_STATE_WAITING);
+				if (!push(Func))
+				{
+					Func->setStatus(previous);
+					return false;
+				}
+				return true;
+			}
+	};
+}
+#endif /*VSTDBASICTHREADCALL_HPP_*/
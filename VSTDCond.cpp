@@ -7,6 +7,8 @@
  * @version	1.0
  * @par 更新履歴：
  * - 2009/07/16	Sebastian 新規作成
+ * - 2026/10/19	Sebastian シグナルの取りこぼしを修正
+ * - 2026/10/19	Sebastian ロック競合の計測(VSTD_LOCK_PROFILE)を追加
  * ***************************************************************************/
 #include "VSTDCond.hpp"
 namespace VSTD
@@ -20,6 +22,7 @@ namespace VSTD
 	Condition::Condition(void)
 	{
 		created = true;
+		signaled = false;
 
 		pthread_mutexattr_init(&mutex_attr);
 		pthread_mutex_init(&mutex_lock,&mutex_attr);
@@ -41,12 +44,22 @@ namespace VSTD
 	 * 				シグナル送信
 	 * @note		waitメソッドにて待機中のスレッドに対してシグナルを送信し
 	 * 				イベントを発生させます。
+	 * 				待機中のスレッドが存在しない場合、シグナルは次のwaitまで
+	 * 				保持されます。
 	 * @author	Sebastian
 	 * @date		2009/7/16
 	 */
 	void Condition::set()
 	{
+#ifdef VSTD_LOCK_PROFILE
+		LockProfileHold_t hold;
+		LockProfiler::lock(&mutex_lock , this , __builtin_return_address(0) , &hold);
+		signaled = true;
+		LockProfiler::unlock(&hold);
+#else
 		pthread_mutex_lock(&mutex_lock);
+		signaled = true;
+#endif
 		pthread_mutex_unlock(&mutex_lock);
 		pthread_cond_signal(&signal);
 	}
@@ -54,24 +67,37 @@ namespace VSTD
 	 * @brief		wait
 	 * 				シグナル待機
 	 * @note		スレッドをサスペンドさせシグナル受信を待ちます。
+	 * 				既にシグナルを受信済みの場合は待機せずに完了します。
+	 * 				シグナル受信後はミューテックスを解放する為、
+	 * 				シグナル送信側が処理の完了を待たされる事はありません。
 	 * @author	Sebastian
 	 * @date		2009/7/16
 	 */
 	bool Condition::wait()
 	{
+#ifdef VSTD_LOCK_PROFILE
+		/* 保持時間には待機が含まれる為、取得のみを記録 */
+		LockProfileHold_t hold;
+		LockProfiler::lock(&mutex_lock , this , __builtin_return_address(0) , &hold);
+#else
 		pthread_mutex_lock(&mutex_lock);
-		pthread_cond_wait(&signal,&mutex_lock);
+#endif
+		while (!signaled)
+		{
+			pthread_cond_wait(&signal,&mutex_lock);
+		}
+		signaled = false;
+		pthread_mutex_unlock(&mutex_lock);
 		return true;
 	}
 	/**
 	 * @brief		reset
 	 * 				シグナルの初期化
-	 * @note		ミューテックスを解除する事で条件変数を初期化します。
+	 * @note		ミューテックスはwaitにて解放済みの為、互換性の為に残されています。
 	 * @author	Sebastian
 	 * @date		2009/7/16
 	 */
 	void Condition::reset()
 	{
-		pthread_mutex_unlock(&mutex_lock);
 	}
 }
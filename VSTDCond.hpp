@@ -9,6 +9,8 @@
  *
  * @par 更新履歴：
  * - 2009/07/16	Sebastian 新規作成
+ * - 2026/10/19	Sebastian シグナルの取りこぼしを修正
+ * - 2026/10/19	Sebastian ロック競合の計測(VSTD_LOCK_PROFILE)を追加
  * ***************************************************************************/
 #ifndef VSTDCOND_HPP_
 #define VSTDCOND_HPP_
@@ -16,6 +18,9 @@
  * including library
  * ***************************************************************************/ 
 #include <pthread.h>
+#ifdef VSTD_LOCK_PROFILE
+#include "VSTDLockProfiler.hpp"
+#endif
 namespace VSTD
 {
 	/* ***************************************************************************
@@ -37,6 +42,8 @@ namespace VSTD
 		pthread_mutex_t		mutex_lock;
 		/** @brief ミューテックス属性　*/
 		pthread_mutexattr_t	mutex_attr;
+		/** @brief 未受信のシグナルが存在するか */
+		bool				signaled;
 	public:
 		/* ***********************************************************************
 		 * コンストラクタ/デストラクタ
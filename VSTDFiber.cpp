@@ -0,0 +1,865 @@
+/* ***************************************************************************
+ * @file		VSTDFiber.cpp
+ * @brief		ファイバー(ユーザーモードのコンテキスト切り替え)用 Class
+ * @see		VSTDThreadCall.hpp / <ucontext.h>
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "VSTDFiber.hpp"
+#include <sys/mman.h>
+#include <stdint.h>
+#include <sched.h>
+
+namespace VSTD
+{
+	/** @brief 実行中のファイバー */
+	static thread_local Fiber * currentFiber = NULL;
+	/**
+	 * @brief		スピンロックの取得
+	 * @param[in]	guard：スピンロックの領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void spinLock(std::atomic<int> * guard)
+	{
+		int spins = 0;
+		while (guard->exchange(1 , std::memory_order_acquire))
+		{
+			if (++spins > 64)
+			{
+				sched_yield();
+				spins = 0;
+			}
+		}
+	}
+	/**
+	 * @brief		スピンロックの解放
+	 * @note		FiberWaitの解放処理として使用する為、引数はvoid *です。
+	 * @param[in]	guard：スピンロックの領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void spinUnlock(void * guard)
+	{
+		((std::atomic<int> *)guard)->store(0 , std::memory_order_release);
+	}
+	/* ***********************************************************************
+	 *
+	 * FiberWaiter
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		FiberWaiterInit
+	 * 				待機者の初期化
+	 * @note		呼び出したファイバーを待機者として設定します。
+	 * 				ファイバー以外から呼び出した場合はスレッドとして待機します。
+	 * @param[out]	waiter：初期化する待機者
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberWaiterInit(FiberWaiter_t * waiter)
+	{
+		waiter->fiber	= Fiber::current();
+		waiter->ready.store(0 , std::memory_order_relaxed);
+		waiter->next	= NULL;
+	}
+	/**
+	 * @brief		FiberWait
+	 * 				起床されるまでの待機
+	 * @note		待ち行列へ登録した後、待ち行列のロックを保持したまま呼び出します。
+	 * 				ファイバーの場合はコンテキストを保存してワーカーへ戻った後に
+	 * 				unlockを呼び出す為、保存前に起床される事はありません。
+	 * 				スレッドの場合はunlockを呼び出した後にfutexにて待機します。
+	 * @param[in]	waiter：FiberWaiterInitにて初期化した待機者
+	 * @param[in]	unlock：待ち行列のロックの解放処理
+	 * @param[in]	arg：解放処理の引数
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberWait(FiberWaiter_t * waiter , void (*unlock)(void *) , void * arg)
+	{
+		Fiber * fiber = waiter->fiber;
+		if (fiber)
+		{
+			fiber->unlock		= unlock;
+			fiber->unlockArg	= arg;
+			fiber->suspend(FIBER_ACT_PARK);
+			return;
+		}
+		unlock(arg);
+		while (!waiter->ready.load(std::memory_order_acquire))
+		{
+			FutexWait(&waiter->ready , 0);
+		}
+	}
+	/**
+	 * @brief		FiberWake
+	 * 				待機者の起床
+	 * @note		待ち行列から取り除いた後に呼び出します。
+	 * 				ファイバーの場合は実行待ちへ登録します。
+	 * @param[in]	waiter：起床させる待機者
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberWake(FiberWaiter_t * waiter)
+	{
+		Fiber * fiber = waiter->fiber;
+		if (fiber)
+		{
+			fiber->scheduler->resume(fiber);
+			return;
+		}
+		waiter->ready.store(1 , std::memory_order_release);
+		FutexWake(&waiter->ready , 1);
+	}
+	/* ***********************************************************************
+	 *
+	 * Fiber
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		Fiberのコンストラクタ
+	 * @param[in]	owner：所属するスケジューラ
+	 * @param[in]	Func：実行するThreadFunction
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Fiber::Fiber(FiberScheduler * owner , ThreadFunction * Func)
+	{
+		back		= NULL;
+		stack		= NULL;
+		stackSize	= 0;
+		func		= Func;
+		scheduler	= owner;
+		action	= FIBER_ACT_YIELD;
+		unlock	= NULL;
+		unlockArg	= NULL;
+		next		= NULL;
+	}
+	/**
+	 * @brief		Fiberのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Fiber::~Fiber(void)
+	{
+	}
+	/**
+	 * @brief		entry
+	 * 				ファイバーの開始位置
+	 * @note		makecontextの引数はint型の為、ポインタを分割して受け取ります。
+	 * 				例外はファイバーの外へ送出出来ない為、ここで破棄します。
+	 * 				例外が発生した場合も待機側が停止したままとならない様、
+	 * 				完了(THFUNC_STATE_COMLETED)とし、自動解放を行います。
+	 * 				実行中に再度積み上げられた場合は完了とせず、破棄もしません。
+	 * @param[in]	high：Fiberのアドレスの上位32bit
+	 * @param[in]	low：Fiberのアドレスの下位32bit
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Fiber::entry(unsigned int high , unsigned int low)
+	{
+		Fiber * self = (Fiber *)(uintptr_t)(((unsigned long long)high << 32) | low);
+		/* 再度積み上げられた場合は新たなファイバーにて実行される */
+		try
+		{
+			self->func->execute();
+		}
+		catch(...)
+		{
+			fprintf(stderr , "[Fiber]:ファイバー内で例外が発生しました。\n");
+		}
+		self->suspend(FIBER_ACT_EXIT);
+	}
+	/**
+	 * @brief		suspend
+	 * 				ワーカーへの切り替え
+	 * @note		再開された時点で戻ります。
+	 * @param[in]	act：ワーカーへ戻る理由
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Fiber::suspend(FiberAction_t act)
+	{
+		action = act;
+		swapcontext(&context , back);
+	}
+	/**
+	 * @brief		current
+	 * 				実行中のファイバーの取得
+	 * @return	実行中のファイバーを返却します。ファイバー以外の場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Fiber * Fiber::current()
+	{
+		return currentFiber;
+	}
+	/**
+	 * @brief		yield
+	 * 				実行の譲渡
+	 * @note		実行待ちの末尾へ戻り、他のファイバーを実行させます。
+	 * 				ファイバー以外から呼び出した場合はsched_yieldを呼び出します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Fiber::yield()
+	{
+		Fiber * fiber = current();
+		if (!fiber)
+		{
+			sched_yield();
+			return;
+		}
+		fiber->suspend(FIBER_ACT_YIELD);
+	}
+	/* ***********************************************************************
+	 *
+	 * FiberWorker
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		FiberWorkerのコンストラクタ
+	 * @param[in]	owner：所属するスケジューラを指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberWorker::FiberWorker(FiberScheduler * owner)
+		: ThreadCall() , scheduler(owner) , idle(true)
+	{
+	}
+	/**
+	 * @brief		FiberWorkerのデストラクタ
+	 * @note		派生クラスの破棄前にスレッドを停止します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberWorker::~FiberWorker(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		onFunction
+	 * 				実行待ちのファイバーの実行
+	 * @note		実行待ちが空になるまでファイバーを取り出して実行します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool FiberWorker::onFunction()
+	{
+		Fiber * fiber;
+		try
+		{
+			while ((fiber = scheduler->take(this)) != NULL)
+			{
+				scheduler->run(this , fiber);
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * FiberScheduler
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		FiberSchedulerのコンストラクタ
+	 * @param[in]	threads：ワーカー数を指定します。
+	 * @param[in]	stackSize：ファイバーのスタックサイズ(byte)。0の場合は既定値
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberScheduler::FiberScheduler(unsigned int threads , int stackSize)
+	{
+		if (threads < 1) threads = 1;
+		if (threads > MAX_FIBER_WORKER) threads = MAX_FIBER_WORKER;
+		memset(workers , 0 , sizeof(workers));
+		workerCount	= 0;
+		readyHead		= NULL;
+		readyTail		= NULL;
+		readyCount	= 0;
+		stackCount	= 0;
+		stacksize		= stackSize > 0 ? stackSize : FIBER_DEFAULT_STACK;
+		stackMapSize	= getMapSize(stacksize);
+		live			= 0;
+		spawned		= 0;
+		switches		= 0;
+		stopping		= false;
+		for (unsigned int i = 0 ; i < threads ; i++)
+		{
+			workers[workerCount++] = new FiberWorker(this);
+		}
+	}
+	/**
+	 * @brief		FiberSchedulerのデストラクタ
+	 * @note		実行待ちのファイバーは実行されずに破棄されます。
+	 * 				待機中のファイバーは破棄されない為、破棄前に完了させてください。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberScheduler::~FiberScheduler(void)
+	{
+		stop();
+		while (readyHead)
+		{
+			Fiber * fiber = readyHead;
+			readyHead = fiber->next;
+			munmap(fiber->stack , fiber->stackSize);
+			delete fiber;
+		}
+		for (unsigned int i = 0 ; i < stackCount ; i++)
+		{
+			munmap(stacks[i] , stackMapSize);
+		}
+	}
+	/**
+	 * @brief		stop
+	 * 				スケジューラの停止
+	 * @note		全てのワーカーを停止します。実行中のファイバーが
+	 * 				ワーカーへ戻るまで待機します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberScheduler::stop()
+	{
+		FiberWorker *	stopped[MAX_FIBER_WORKER];
+		unsigned int	num;
+		try
+		{
+			mutex.lock();
+			if (stopping)
+			{
+				mutex.unlock();
+				return;
+			}
+			stopping = true;
+			num = workerCount;
+			memcpy(stopped , workers , sizeof(FiberWorker *) * num);
+			workerCount = 0;
+			mutex.unlock();
+			for (unsigned int i = 0 ; i < num ; i++)
+			{
+				delete stopped[i];
+			}
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		spawn
+	 * 				ファイバーの生成
+	 * @note		ThreadFunctionを新たなファイバーにて実行します。
+	 * 				自動解放が指定されている場合は実行後に破棄されます。
+	 * @param[in]	Func：実行するThreadFunctionを指定
+	 * @param[in]	stackSize：スタックサイズ(byte)。0の場合はsetStackSizeの値
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(NULLが指定された、停止している、スタックを確保出来ない)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool FiberScheduler::spawn(ThreadFunction * Func , int stackSize)
+	{
+		size_t	mapSize;
+		void *	stack;
+		long	page = sysconf(_SC_PAGESIZE);
+		try
+		{
+			if (!Func) return false;
+			mutex.lock();
+			if (stopping)
+			{
+				mutex.unlock();
+				return false;
+			}
+			mapSize = stackSize > 0 ? getMapSize(stackSize) : stackMapSize;
+			mutex.unlock();
+			stack = allocStack(mapSize);
+			if (!stack)
+			{
+				return false;
+			}
+			Fiber * fiber = new Fiber(this , Func);
+			fiber->stack		= stack;
+			fiber->stackSize	= mapSize;
+			getcontext(&fiber->context);
+			fiber->context.uc_stack.ss_sp		= (char *)stack + page;
+			fiber->context.uc_stack.ss_size	= mapSize - page;
+			fiber->context.uc_link				= NULL;
+			uintptr_t address = (uintptr_t)fiber;
+			makecontext(&fiber->context , (void (*)(void))Fiber::entry , 2
+				, (unsigned int)((unsigned long long)address >> 32)
+				, (unsigned int)(address & 0xffffffffUL));
+			Func->setStatus(THFUNC_STATE_WAITING);
+			mutex.lock();
+			live++;
+			spawned++;
+			mutex.unlock();
+			resume(fiber);
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setStackSize
+	 * 				ファイバーのスタックサイズの設定
+	 * @note		以降に生成されるファイバーに適用されます。
+	 * 				異なるサイズの再利用スタックは解放されます。
+	 * @param[in]	size：スタックサイズ(byte)。0以下の場合は既定値
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberScheduler::setStackSize(int size)
+	{
+		void *			release[MAX_FIBER_STACK_CACHE];
+		unsigned int	num;
+		size_t			oldSize;
+		if (size <= 0) size = FIBER_DEFAULT_STACK;
+		mutex.lock();
+		oldSize		= stackMapSize;
+		stacksize		= size;
+		stackMapSize	= getMapSize(size);
+		num			= 0;
+		if (oldSize != stackMapSize)
+		{
+			num = stackCount;
+			memcpy(release , stacks , sizeof(void *) * num);
+			stackCount = 0;
+		}
+		mutex.unlock();
+		for (unsigned int i = 0 ; i < num ; i++)
+		{
+			munmap(release[i] , oldSize);
+		}
+	}
+	/**
+	 * @brief		getStackSize
+	 * 				ファイバーのスタックサイズの取得
+	 * @return	スタックサイズ(byte)を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	int FiberScheduler::getStackSize()
+	{
+		int size;
+		mutex.lock();
+		size = stacksize;
+		mutex.unlock();
+		return size;
+	}
+	/**
+	 * @brief		getStat
+	 * 				統計情報の取得
+	 * @param[out]	stat：統計情報を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberScheduler::getStat(FiberSchedulerStat_t * stat)
+	{
+		mutex.lock();
+		stat->workers		= workerCount;
+		stat->live		= live;
+		stat->ready		= readyCount;
+		stat->spawned		= spawned;
+		stat->switches	= switches.load(std::memory_order_relaxed);
+		stat->cachedStacks	= stackCount;
+		mutex.unlock();
+	}
+	/**
+	 * @brief		getMapSize
+	 * 				スタック領域のサイズの算出
+	 * @param[in]	size：スタックサイズ(byte)
+	 * @return	ページ境界に切り上げ、ガードページを加えたサイズを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	size_t FiberScheduler::getMapSize(int size)
+	{
+		size_t page = (size_t)sysconf(_SC_PAGESIZE);
+		return (((size_t)size + page - 1) / page + 1) * page;
+	}
+	/**
+	 * @brief		allocStack
+	 * 				スタック領域の確保
+	 * @note		同じサイズの再利用スタックが存在する場合はそれを使用します。
+	 * 				新たに確保する場合は下端のページをガードページとします。
+	 * @param[in]	mapSize：領域サイズ(ガードページを含む)
+	 * @return	確保した領域を返却します。失敗した場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * FiberScheduler::allocStack(size_t mapSize)
+	{
+		void * stack = NULL;
+		mutex.lock();
+		if (mapSize == stackMapSize && stackCount > 0)
+		{
+			stack = stacks[--stackCount];
+		}
+		mutex.unlock();
+		if (stack)
+		{
+			return stack;
+		}
+		stack = mmap(NULL , mapSize , PROT_READ | PROT_WRITE
+			, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK , -1 , 0);
+		if (stack == MAP_FAILED)
+		{
+			perror("Fiber:スタックを確保出来ませんでした。");
+			return NULL;
+		}
+		if (mprotect(stack , (size_t)sysconf(_SC_PAGESIZE) , PROT_NONE) != 0)
+		{
+			perror("Fiber:ガードページを設定出来ませんでした。");
+			munmap(stack , mapSize);
+			return NULL;
+		}
+		return stack;
+	}
+	/**
+	 * @brief		freeStack
+	 * 				スタック領域の解放
+	 * @note		現在のサイズと同じ場合は再利用の為に保持します。
+	 * @param[in]	stack：解放する領域
+	 * @param[in]	mapSize：領域サイズ(ガードページを含む)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberScheduler::freeStack(void * stack , size_t mapSize)
+	{
+		mutex.lock();
+		if (mapSize == stackMapSize && stackCount < MAX_FIBER_STACK_CACHE)
+		{
+			stacks[stackCount++] = stack;
+			mutex.unlock();
+			return;
+		}
+		mutex.unlock();
+		munmap(stack , mapSize);
+	}
+	/**
+	 * @brief		resume
+	 * 				実行待ちへの登録
+	 * @note		実行待ちの末尾に追加し、待機中のワーカーが存在する場合は
+	 * 				シグナルを送信します。
+	 * @param[in]	fiber：登録するファイバー
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberScheduler::resume(Fiber * fiber)
+	{
+		FiberWorker * target = NULL;
+		mutex.lock();
+		fiber->next = NULL;
+		if (readyTail)
+		{
+			readyTail->next = fiber;
+		}
+		else
+		{
+			readyHead = fiber;
+		}
+		readyTail = fiber;
+		readyCount++;
+		/* 待機中のワーカーを一つ起床 */
+		for (unsigned int i = 0 ; i < workerCount ; i++)
+		{
+			if (workers[i]->idle)
+			{
+				workers[i]->idle = false;
+				target = workers[i];
+				break;
+			}
+		}
+		mutex.unlock();
+		if (target)
+		{
+			target->setFunction();
+		}
+	}
+	/**
+	 * @brief		take
+	 * 				実行待ちの取り出し
+	 * @note		実行待ちが空の場合はワーカーを待機中として記録します。
+	 * @param[in]	worker：呼び出し元のワーカー
+	 * @return	取り出したファイバーを返却します。空の場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Fiber * FiberScheduler::take(FiberWorker * worker)
+	{
+		Fiber * fiber;
+		mutex.lock();
+		fiber = readyHead;
+		if (!fiber || stopping)
+		{
+			worker->idle = true;
+			mutex.unlock();
+			return NULL;
+		}
+		readyHead = fiber->next;
+		if (!readyHead) readyTail = NULL;
+		readyCount--;
+		worker->idle = false;
+		mutex.unlock();
+		return fiber;
+	}
+	/**
+	 * @brief		run
+	 * 				ファイバーの実行
+	 * @note		ファイバーへ切り替え、戻った理由に応じて再登録・解放処理・
+	 * 				破棄を行います。待機の場合は解放処理の呼び出し以降、
+	 * 				他のスレッドにて再開される為ファイバーを参照しません。
+	 * @param[in]	worker：実行するワーカー
+	 * @param[in]	fiber：実行するファイバー
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberScheduler::run(FiberWorker * worker , Fiber * fiber)
+	{
+		fiber->back	= &worker->context;
+		currentFiber	= fiber;
+		swapcontext(&worker->context , &fiber->context);
+		currentFiber	= NULL;
+		switches.fetch_add(1 , std::memory_order_relaxed);
+		switch (fiber->action)
+		{
+		case FIBER_ACT_YIELD:
+			resume(fiber);
+			break;
+		case FIBER_ACT_PARK:
+			fiber->unlock(fiber->unlockArg);
+			break;
+		case FIBER_ACT_EXIT:
+			destroy(fiber);
+			break;
+		}
+	}
+	/**
+	 * @brief		destroy
+	 * 				完了したファイバーの破棄
+	 * @param[in]	fiber：破棄するファイバー
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberScheduler::destroy(Fiber * fiber)
+	{
+		freeStack(fiber->stack , fiber->stackSize);
+		delete fiber;
+		mutex.lock();
+		live--;
+		mutex.unlock();
+	}
+	/* ***********************************************************************
+	 *
+	 * FiberMutex
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		FiberMutexのコンストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberMutex::FiberMutex(void)
+	{
+		guard.store(0 , std::memory_order_relaxed);
+		locked	= false;
+		head		= NULL;
+		tail		= NULL;
+	}
+	/**
+	 * @brief		FiberMutexのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberMutex::~FiberMutex(void)
+	{
+	}
+	/**
+	 * @brief		lock
+	 * 				ミューテックスのロック
+	 * @note		ロックされている場合は待ち行列へ登録して待機します。
+	 * 				起床した時点で所有権は引き渡されています。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberMutex::lock()
+	{
+		FiberWaiter_t waiter;
+		spinLock(&guard);
+		if (!locked)
+		{
+			locked = true;
+			spinUnlock(&guard);
+			return;
+		}
+		FiberWaiterInit(&waiter);
+		if (tail)
+		{
+			tail->next = &waiter;
+		}
+		else
+		{
+			head = &waiter;
+		}
+		tail = &waiter;
+		FiberWait(&waiter , spinUnlock , &guard);
+	}
+	/**
+	 * @brief		trylock
+	 * 				ミューテックスのロックの試行
+	 * @return	ロック出来た場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool FiberMutex::trylock()
+	{
+		bool result = false;
+		spinLock(&guard);
+		if (!locked)
+		{
+			locked = true;
+			result = true;
+		}
+		spinUnlock(&guard);
+		return result;
+	}
+	/**
+	 * @brief		unlock
+	 * 				ミューテックスのアンロック
+	 * @note		待機者が存在する場合はロックしたまま先頭の待機者へ
+	 * 				所有権を引き渡します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberMutex::unlock()
+	{
+		FiberWaiter_t * waiter;
+		spinLock(&guard);
+		waiter = head;
+		if (waiter)
+		{
+			head = waiter->next;
+			if (!head) tail = NULL;
+		}
+		else
+		{
+			locked = false;
+		}
+		spinUnlock(&guard);
+		if (waiter)
+		{
+			FiberWake(waiter);
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * FiberCondition
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		FiberConditionのコンストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberCondition::FiberCondition(void)
+	{
+		guard.store(0 , std::memory_order_relaxed);
+		head	= NULL;
+		tail	= NULL;
+	}
+	/**
+	 * @brief		FiberConditionのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FiberCondition::~FiberCondition(void)
+	{
+	}
+	/**
+	 * @brief		wait
+	 * 				シグナルの待機
+	 * @note		待ち行列へ登録した後にmutexを解放して待機し、
+	 * 				起床後にmutexを再度ロックします。
+	 * @param[in]	mutex：ロック済みのFiberMutex
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberCondition::wait(FiberMutex & mutex)
+	{
+		FiberWaiter_t waiter;
+		FiberWaiterInit(&waiter);
+		spinLock(&guard);
+		if (tail)
+		{
+			tail->next = &waiter;
+		}
+		else
+		{
+			head = &waiter;
+		}
+		tail = &waiter;
+		mutex.unlock();
+		FiberWait(&waiter , spinUnlock , &guard);
+		mutex.lock();
+	}
+	/**
+	 * @brief		signal
+	 * 				シグナルの送信
+	 * @note		先頭の待機者を一つ起床させます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberCondition::signal()
+	{
+		FiberWaiter_t * waiter;
+		spinLock(&guard);
+		waiter = head;
+		if (waiter)
+		{
+			head = waiter->next;
+			if (!head) tail = NULL;
+		}
+		spinUnlock(&guard);
+		if (waiter)
+		{
+			FiberWake(waiter);
+		}
+	}
+	/**
+	 * @brief		broadcast
+	 * 				全ての待機者へのシグナルの送信
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FiberCondition::broadcast()
+	{
+		FiberWaiter_t * waiter;
+		spinLock(&guard);
+		waiter	= head;
+		head		= NULL;
+		tail		= NULL;
+		spinUnlock(&guard);
+		while (waiter)
+		{
+			/* 起床後は待機者の領域が無効となる為、先に次を取得 */
+			FiberWaiter_t * next = waiter->next;
+			FiberWake(waiter);
+			waiter = next;
+		}
+	}
+}
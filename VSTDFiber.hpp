@@ -0,0 +1,307 @@
+/* ***************************************************************************
+ * @file		VSTDFiber.hpp
+ * @brief		ファイバー(ユーザーモードのコンテキスト切り替え)用 Class
+ * @see		VSTDThreadCall.hpp / <ucontext.h>
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDFIBER_HPP_
+#define VSTDFIBER_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <ucontext.h>
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief スケジューラに登録可能なワーカーの最大数 */
+	#define MAX_FIBER_WORKER 256
+	/** @brief ファイバーの既定のスタックサイズ(byte) */
+	#define FIBER_DEFAULT_STACK (64 * 1024)
+	/** @brief 再利用の為に保持するスタックの最大数 */
+	#define MAX_FIBER_STACK_CACHE 1024
+	class Fiber;
+	class FiberScheduler;
+	class FiberWorker;
+	/**
+	 * @brief		ファイバーがワーカーへ戻る理由を定義している列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief 実行待ちの末尾へ戻ります */
+		FIBER_ACT_YIELD,
+		/** @brief 起床されるまで待機します */
+		FIBER_ACT_PARK,
+		/** @brief 処理が完了しました */
+		FIBER_ACT_EXIT
+	} FiberAction_t;
+	/**
+	 * @brief		待機者の情報
+	 * @note		待機する側のスタック上に確保し、待ち行列へ登録します。
+	 * 				ファイバーから待機した場合はファイバーのみを停止し、
+	 * 				それ以外のスレッドから待機した場合はfutexにて待機します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct FiberWaiter
+	{
+		/** @brief 待機しているファイバー。スレッドの場合はNULL */
+		Fiber *					fiber;
+		/** @brief 起床済みか(スレッドの場合のみ使用) */
+		std::atomic<int>		ready;
+		/** @brief 待ち行列の次の待機者 */
+		struct FiberWaiter *	next;
+	} FiberWaiter_t;
+	void	FiberWaiterInit(FiberWaiter_t * waiter);
+	void	FiberWait(FiberWaiter_t * waiter , void (*unlock)(void *) , void * arg);
+	void	FiberWake(FiberWaiter_t * waiter);
+	/**
+	 * @brief		スケジューラの統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief ワーカー数 */
+		unsigned int		workers;
+		/** @brief 生存しているファイバー数 */
+		unsigned long		live;
+		/** @brief 実行待ちのファイバー数 */
+		unsigned long		ready;
+		/** @brief 生成したファイバーの総数 */
+		unsigned long		spawned;
+		/** @brief コンテキスト切り替えの総数 */
+		unsigned long		switches;
+		/** @brief 再利用の為に保持しているスタック数 */
+		unsigned int		cachedStacks;
+	} FiberSchedulerStat_t;
+	/**
+	 * @brief	Fiber
+	 * @note	ThreadFunctionを独自のスタック上で実行する軽量な実行単位です。
+	 * 			FiberMutex/FiberCondition/Futureにて待機した場合はファイバーのみが
+	 * 			停止し、ワーカースレッドは他のファイバーを実行します。
+	 * 			再開時は別のワーカースレッドにて実行される場合があります。
+	 * 			生成と破棄はFiberSchedulerが行います。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class Fiber
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief ファイバーのコンテキスト */
+			ucontext_t			context;
+			/** @brief 戻り先のワーカーのコンテキスト */
+			ucontext_t *		back;
+			/** @brief スタック領域(ガードページを含む) */
+			void *				stack;
+			/** @brief スタック領域のサイズ(ガードページを含む) */
+			size_t				stackSize;
+			/** @brief 実行するThreadFunction */
+			ThreadFunction *	func;
+			/** @brief 所属するスケジューラ */
+			FiberScheduler *	scheduler;
+			/** @brief ワーカーへ戻る理由 */
+			FiberAction_t		action;
+			/** @brief 停止後にワーカーにて呼び出す解放処理 */
+			void				(*unlock)(void *);
+			/** @brief 解放処理の引数 */
+			void *				unlockArg;
+			/** @brief 実行待ちの次のファイバー(スケジューラのミューテックスにて保護) */
+			Fiber *				next;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			Fiber(FiberScheduler * owner , ThreadFunction * Func);
+			~Fiber(void);
+			static void	entry(unsigned int high , unsigned int low);
+			void		suspend(FiberAction_t act);
+			friend class FiberScheduler;
+			friend void	FiberWait(FiberWaiter_t * waiter , void (*unlock)(void *) , void * arg);
+			friend void	FiberWake(FiberWaiter_t * waiter);
+		public:
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			static Fiber *	current();
+			static void		yield();
+	};
+	/**
+	 * @brief	FiberWorker
+	 * @note	FiberSchedulerのワーカー。シグナル受信時に実行待ちのファイバーを
+	 * 			取り出し、コンテキストを切り替えて実行します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class FiberWorker : public ThreadCall
+	{
+		private:
+			/** @brief 所属するスケジューラ */
+			FiberScheduler *	scheduler;
+			/** @brief ファイバーからの戻り先のコンテキスト */
+			ucontext_t			context;
+			friend class FiberScheduler;
+		public:
+			/** @brief 待機中か。スケジューラのミューテックスにて保護 */
+			bool				idle;
+			FiberWorker(FiberScheduler * owner);
+			virtual ~FiberWorker(void);
+			virtual bool	onFunction();
+			using ThreadCall::onFunction;
+	};
+	/**
+	 * @brief	FiberScheduler
+	 * @note	少数のFiberWorkerにて多数のファイバーを実行します。
+	 * 			ファイバーのスタックはmmapにて確保し、下端にガードページを設けます。
+	 * 			完了したファイバーのスタックは再利用の為に保持されます。
+	 * 			スタックサイズはsetStackSizeにて指定し、以降に生成される
+	 * 			ファイバーに適用されます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class FiberScheduler
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief ワーカー */
+			FiberWorker *		workers[MAX_FIBER_WORKER];
+			/** @brief ワーカー数 */
+			unsigned int		workerCount;
+			/** @brief 実行待ちの先頭 */
+			Fiber *				readyHead;
+			/** @brief 実行待ちの末尾 */
+			Fiber *				readyTail;
+			/** @brief 実行待ちの数 */
+			unsigned long		readyCount;
+			/** @brief 再利用するスタック */
+			void *				stacks[MAX_FIBER_STACK_CACHE];
+			/** @brief 再利用するスタックの数 */
+			unsigned int		stackCount;
+			/** @brief 再利用するスタックの領域サイズ(ガードページを含む) */
+			size_t				stackMapSize;
+			/** @brief ファイバーのスタックサイズ */
+			int					stacksize;
+			/** @brief 生存しているファイバー数 */
+			unsigned long		live;
+			/** @brief 生成したファイバーの総数 */
+			unsigned long		spawned;
+			/** @brief コンテキスト切り替えの総数 */
+			std::atomic<unsigned long>	switches;
+			/** @brief 停止中か */
+			bool				stopping;
+			/** @brief 実行待ち・スタック保護用ミューテックス */
+			Mutex				mutex;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			size_t	getMapSize(int size);
+			void *	allocStack(size_t mapSize);
+			void	freeStack(void * stack , size_t mapSize);
+			void	resume(Fiber * fiber);
+			Fiber *	take(FiberWorker * worker);
+			void	run(FiberWorker * worker , Fiber * fiber);
+			void	destroy(Fiber * fiber);
+			friend class Fiber;
+			friend class FiberWorker;
+			friend void	FiberWake(FiberWaiter_t * waiter);
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			FiberScheduler(unsigned int threads = 4 , int stackSize = 0);
+			virtual ~FiberScheduler(void);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			bool	spawn(ThreadFunction * Func , int stackSize = 0);
+			void	setStackSize(int size);
+			int		getStackSize();
+			void	stop();
+			void	getStat(FiberSchedulerStat_t * stat);
+			/**
+			 * @brief		submit
+			 * 				型付き実行結果を返却する関数のファイバーでの実行
+			 * @see		ThreadCall::submit
+			 * @param[in]	func：実行する関数オブジェクトを指定
+			 * @return	実行結果受け取り用のFutureを返却します。
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class R , class F>
+			Future<R>		submit(F && func)
+			{
+				typedef FutureTask<R , typename std::decay<F>::type>	Task;
+				Task *		task = new Task(std::forward<F>(func));
+				Future<R>	future(task->getState());
+				if (!spawn(task))
+				{
+					delete task;
+				}
+				return future;
+			}
+	};
+	/**
+	 * @brief	FiberMutex
+	 * @note	ファイバーから使用した場合、競合時はファイバーのみを停止する
+	 * 			ミューテックスです。ファイバー以外のスレッドからも使用出来ます。
+	 * 			解放時は待機者へ所有権を直接引き渡します。
+	 * 			Mutex/Conditionはワーカーのスレッドごと停止する為、
+	 * 			ファイバー間の排他にはFiberMutex/FiberConditionを使用してください。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class FiberMutex
+	{
+		private:
+			/** @brief 待ち行列保護用スピンロック */
+			std::atomic<int>	guard;
+			/** @brief ロックされているか */
+			bool				locked;
+			/** @brief 待ち行列の先頭 */
+			FiberWaiter_t *		head;
+			/** @brief 待ち行列の末尾 */
+			FiberWaiter_t *		tail;
+		public:
+			FiberMutex(void);
+			~FiberMutex(void);
+			void	lock();
+			bool	trylock();
+			void	unlock();
+	};
+	/**
+	 * @brief	FiberCondition
+	 * @note	FiberMutexと組み合わせて使用する条件変数です。
+	 * 			ファイバーから待機した場合はファイバーのみを停止します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class FiberCondition
+	{
+		private:
+			/** @brief 待ち行列保護用スピンロック */
+			std::atomic<int>	guard;
+			/** @brief 待ち行列の先頭 */
+			FiberWaiter_t *		head;
+			/** @brief 待ち行列の末尾 */
+			FiberWaiter_t *		tail;
+		public:
+			FiberCondition(void);
+			~FiberCondition(void);
+			void	wait(FiberMutex & mutex);
+			void	signal();
+			void	broadcast();
+	};
+}
+#endif /*VSTDFIBER_HPP_*/
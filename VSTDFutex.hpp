@@ -0,0 +1,111 @@
+/* ***************************************************************************
+ * @file		VSTDFutex.hpp
+ * @brief		futexによる待機/起床用関数
+ * @see		<linux/futex.h>
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian プロセス間共有の待機/起床を追加
+ * ***************************************************************************/
+#ifndef VSTDFUTEX_HPP_
+#define VSTDFUTEX_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <limits.h>
+#include <time.h>
+#include <errno.h>
+
+namespace VSTD
+{
+	/**
+	 * @brief		FutexWait
+	 * 				値の変更待機
+	 * @note		addrの値がexpectedと等しい間、起床されるまで待機します。
+	 * 				値の比較と待機はカーネル内で不可分に行われる為、
+	 * 				比較後に値が変更された場合は待機せずに戻ります。
+	 * 				シグナル等により起床する場合がある為、呼び出し側にて
+	 * 				値を再確認してください。
+	 * @param[in]	addr：待機する32bitの領域を指定します。
+	 * @param[in]	expected：待機する値を指定します。
+	 * @param[in]	timeoutNs：タイムアウトをナノ秒にて指定します。0以下の場合は無期限
+	 * @return	タイムアウトした場合はfalse
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	inline bool FutexWait(void * addr , int expected , long long timeoutNs = 0)
+	{
+		struct timespec		timeout;
+		struct timespec *	ptimeout = NULL;
+		if (timeoutNs > 0)
+		{
+			timeout.tv_sec	= (time_t)(timeoutNs / 1000000000LL);
+			timeout.tv_nsec	= (long)(timeoutNs % 1000000000LL);
+			ptimeout			= &timeout;
+		}
+		if (syscall(SYS_futex , addr , FUTEX_WAIT_PRIVATE , expected , ptimeout , NULL , 0) != 0)
+		{
+			return errno != ETIMEDOUT;
+		}
+		return true;
+	}
+	/**
+	 * @brief		FutexWaitShared
+	 * 				プロセス間共有領域の値の変更待機
+	 * @note		FutexWaitと同様ですが、MAP_SHAREDの領域を他のプロセスと
+	 * 				共有して待機します。
+	 * @param[in]	addr：共有メモリ上の待機する32bitの領域を指定します。
+	 * @param[in]	expected：待機する値を指定します。
+	 * @param[in]	timeoutNs：タイムアウトをナノ秒にて指定します。0以下の場合は無期限
+	 * @return	タイムアウトした場合はfalse
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	inline bool FutexWaitShared(void * addr , int expected , long long timeoutNs = 0)
+	{
+		struct timespec		timeout;
+		struct timespec *	ptimeout = NULL;
+		if (timeoutNs > 0)
+		{
+			timeout.tv_sec	= (time_t)(timeoutNs / 1000000000LL);
+			timeout.tv_nsec	= (long)(timeoutNs % 1000000000LL);
+			ptimeout			= &timeout;
+		}
+		if (syscall(SYS_futex , addr , FUTEX_WAIT , expected , ptimeout , NULL , 0) != 0)
+		{
+			return errno != ETIMEDOUT;
+		}
+		return true;
+	}
+	/**
+	 * @brief		FutexWake
+	 * 				待機中のスレッドの起床
+	 * @param[in]	addr：FutexWaitにて待機している領域を指定します。
+	 * @param[in]	count：起床させる最大数を指定します。既定は全て
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	inline void FutexWake(void * addr , int count = INT_MAX)
+	{
+		syscall(SYS_futex , addr , FUTEX_WAKE_PRIVATE , count , NULL , NULL , 0);
+	}
+	/**
+	 * @brief		FutexWakeShared
+	 * 				他のプロセスを含む待機中のスレッドの起床
+	 * @param[in]	addr：FutexWaitSharedにて待機している領域を指定します。
+	 * @param[in]	count：起床させる最大数を指定します。既定は全て
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	inline void FutexWakeShared(void * addr , int count = INT_MAX)
+	{
+		syscall(SYS_futex , addr , FUTEX_WAKE , count , NULL , NULL , 0);
+	}
+}
+#endif /*VSTDFUTEX_HPP_*/
@@ -0,0 +1,466 @@
+/* ***************************************************************************
+ * @file		VSTDFuture.cpp
+ * @brief		型付き実行結果受け取り用 Class
+ * @see		VSTDThreadFunction.hpp / VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian ファイバーからの待機はファイバーのみを停止する様に変更
+ * ***************************************************************************/
+#include "VSTDFuture.hpp"
+#include "VSTDFiber.hpp"
+#include <time.h>
+#include <errno.h>
+#include <stdexcept>
+
+namespace VSTD
+{
+	/**
+	 * @brief		タイムアウト時刻の算出
+	 * @param[out]	abstime：タイムアウト時刻(CLOCK_MONOTONIC)を格納します。
+	 * @param[in]	timeout：タイムアウトをミリ秒にて指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void getAbsTime(struct timespec * abstime , long timeout)
+	{
+		clock_gettime(CLOCK_MONOTONIC , abstime);
+		abstime->tv_sec	+= timeout / 1000;
+		abstime->tv_nsec	+= (timeout % 1000) * 1000000;
+		if (abstime->tv_nsec >= 1000000000)
+		{
+			abstime->tv_sec	+= 1;
+			abstime->tv_nsec	-= 1000000000;
+		}
+	}
+	/**
+	 * @brief		CLOCK_MONOTONICを使用する条件変数の初期化
+	 * @param[out]	cond：初期化する条件変数
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void initMonotonicCond(pthread_cond_t * cond)
+	{
+		pthread_condattr_t attr;
+		pthread_condattr_init(&attr);
+		pthread_condattr_setclock(&attr , CLOCK_MONOTONIC);
+		pthread_cond_init(cond , &attr);
+		pthread_condattr_destroy(&attr);
+	}
+	/**
+	 * @brief		ミューテックスの解放
+	 * @note		FiberWaitの解放処理として使用します。
+	 * @param[in]	mutex：解放するミューテックス
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void unlockMutex(void * mutex)
+	{
+		pthread_mutex_unlock((pthread_mutex_t *)mutex);
+	}
+	/* ***********************************************************************
+	 *
+	 * FutureStateBase
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		FutureStateBaseのコンストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FutureStateBase::FutureStateBase(void)
+	{
+		status	= FUTURE_PENDING;
+		refs		= 0;
+		groups	= NULL;
+		fibers	= NULL;
+		pthread_mutex_init(&mutex_lock , NULL);
+		initMonotonicCond(&signal);
+	}
+	/**
+	 * @brief		FutureStateBaseのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FutureStateBase::~FutureStateBase(void)
+	{
+		pthread_cond_destroy(&signal);
+		pthread_mutex_destroy(&mutex_lock);
+	}
+	/**
+	 * @brief		addRef
+	 * 				参照カウントの加算
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureStateBase::addRef()
+	{
+		refs.fetch_add(1 , std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		release
+	 * 				参照カウントの減算
+	 * @note		参照が無くなった場合は共有状態を破棄します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureStateBase::release()
+	{
+		if (refs.fetch_sub(1 , std::memory_order_acq_rel) == 1)
+		{
+			delete this;
+		}
+	}
+	/**
+	 * @brief		complete
+	 * 				完了通知
+	 * @note		状態を設定し、待機しているスレッドと一括待機のグループを
+	 * 				起床させます。既に完了している場合は何もしません。
+	 * @param[in]	state：設定する状態
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureStateBase::complete(futurestatus_t state)
+	{
+		pthread_mutex_lock(&mutex_lock);
+		if (status != FUTURE_PENDING)
+		{
+			pthread_mutex_unlock(&mutex_lock);
+			return;
+		}
+		status = state;
+		for (FutureGroupEntry_t * entry = groups ; entry ; entry = entry->next)
+		{
+			entry->group->notify(entry->index);
+		}
+		while (fibers)
+		{
+			FiberWaiter_t * waiter = fibers;
+			fibers = waiter->next;
+			FiberWake(waiter);
+		}
+		pthread_cond_broadcast(&signal);
+		pthread_mutex_unlock(&mutex_lock);
+	}
+	/**
+	 * @brief		fail
+	 * 				例外発生の通知
+	 * @param[in]	exception：発生した例外
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureStateBase::fail(std::exception_ptr exception)
+	{
+		error = exception;
+		complete(FUTURE_FAILED);
+	}
+	/**
+	 * @brief		abandon
+	 * 				破棄の通知
+	 * @note		実行されないまま破棄された事を通知します。
+	 * 				既に完了している場合は何もしません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureStateBase::abandon()
+	{
+		complete(FUTURE_ABANDONED);
+	}
+	/**
+	 * @brief		getStatus
+	 * 				実行結果の状態を取得
+	 * @return	実行結果の状態を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	futurestatus_t FutureStateBase::getStatus()
+	{
+		futurestatus_t state;
+		pthread_mutex_lock(&mutex_lock);
+		state = status;
+		pthread_mutex_unlock(&mutex_lock);
+		return state;
+	}
+	/**
+	 * @brief		wait
+	 * 				完了待機
+	 * @note		ファイバーから無期限で待機した場合はファイバーのみを停止し、
+	 * 				ワーカースレッドは他のファイバーを実行します。
+	 * 				タイムアウトを指定した場合はスレッドごと待機します。
+	 * @param[in]	timeout：タイムアウトをミリ秒にて指定。0の場合は無期限
+	 * @return	待機結果を返却します。
+	 * @retval	true ： 完了
+	 * @retval	false： タイムアウト
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool FutureStateBase::wait(long timeout)
+	{
+		struct timespec abstime;
+		if (timeout <= 0 && Fiber::current())
+		{
+			pthread_mutex_lock(&mutex_lock);
+			if (status != FUTURE_PENDING)
+			{
+				pthread_mutex_unlock(&mutex_lock);
+				return true;
+			}
+			/* ロックはファイバーの停止後にワーカーにて解放される */
+			FiberWaiter_t waiter;
+			FiberWaiterInit(&waiter);
+			waiter.next	= fibers;
+			fibers		= &waiter;
+			FiberWait(&waiter , unlockMutex , &mutex_lock);
+			return true;
+		}
+		if (timeout > 0)
+		{
+			getAbsTime(&abstime , timeout);
+		}
+		pthread_mutex_lock(&mutex_lock);
+		while (status == FUTURE_PENDING)
+		{
+			if (timeout > 0)
+			{
+				if (pthread_cond_timedwait(&signal , &mutex_lock , &abstime) == ETIMEDOUT)
+				{
+					break;
+				}
+			}
+			else
+			{
+				pthread_cond_wait(&signal , &mutex_lock);
+			}
+		}
+		bool done = (status != FUTURE_PENDING);
+		pthread_mutex_unlock(&mutex_lock);
+		return done;
+	}
+	/**
+	 * @brief		rethrow
+	 * 				実行時に発生した例外の再送出
+	 * @note		破棄された場合はstd::runtime_errorを送出します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureStateBase::rethrow()
+	{
+		futurestatus_t state = getStatus();
+		if (state == FUTURE_FAILED)
+		{
+			std::rethrow_exception(error);
+		}
+		if (state == FUTURE_ABANDONED)
+		{
+			throw std::runtime_error("[Future]:タスクは実行されずに破棄されました。");
+		}
+	}
+	/**
+	 * @brief		checkState
+	 * 				共有状態の確認
+	 * @note		既定のコンストラクタにて生成された場合や
+	 * 				ムーブ済みの場合はstd::runtime_errorを送出します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureBase::checkState() const
+	{
+		if (!state)
+		{
+			throw std::runtime_error("[Future]:共有状態を保持していません。");
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * FutureGroup
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		FutureGroupのコンストラクタ
+	 * @note		各共有状態に登録します。既に完了しているものは
+	 * 				その場で完了として数えます。
+	 * @param[in]	futures：待機するハンドルの配列
+	 * @param[in]	num：ハンドルの数
+	 * @param[in]	waitAny：trueの場合はいずれかの完了で起床
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FutureGroup::FutureGroup(FutureBase ** futures , size_t num , bool waitAny)
+	{
+		pthread_mutex_init(&mutex_lock , NULL);
+		initMonotonicCond(&signal);
+		count		= num;
+		remaining	= num;
+		first		= -1;
+		any		= waitAny;
+		entries	= new FutureGroupEntry_t [num];
+		for (size_t i = 0 ; i < num ; i++)
+		{
+			FutureStateBase * state = futures[i]->getState();
+			entries[i].group	= this;
+			entries[i].state	= state;
+			entries[i].index	= i;
+			entries[i].next	= NULL;
+			if (!state)
+			{
+				notify(i);
+				continue;
+			}
+			pthread_mutex_lock(&state->mutex_lock);
+			if (state->status != FUTURE_PENDING)
+			{
+				entries[i].state = NULL;
+				notify(i);
+			}
+			else
+			{
+				state->addRef();
+				entries[i].next	= state->groups;
+				state->groups		= &entries[i];
+			}
+			pthread_mutex_unlock(&state->mutex_lock);
+		}
+	}
+	/**
+	 * @brief		FutureGroupのデストラクタ
+	 * @note		各共有状態から登録を解除します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	FutureGroup::~FutureGroup(void)
+	{
+		for (size_t i = 0 ; i < count ; i++)
+		{
+			FutureStateBase * state = entries[i].state;
+			if (!state) continue;
+			pthread_mutex_lock(&state->mutex_lock);
+			FutureGroupEntry_t ** link = &state->groups;
+			while (*link)
+			{
+				if (*link == &entries[i])
+				{
+					*link = entries[i].next;
+					break;
+				}
+				link = &(*link)->next;
+			}
+			pthread_mutex_unlock(&state->mutex_lock);
+			state->release();
+		}
+		delete [] entries;
+		pthread_cond_destroy(&signal);
+		pthread_mutex_destroy(&mutex_lock);
+	}
+	/**
+	 * @brief		notify
+	 * 				完了の通知
+	 * @note		条件を満たした時点でのみ待機側を起床させます。
+	 * @param[in]	index：完了したハンドルの位置
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void FutureGroup::notify(size_t index)
+	{
+		pthread_mutex_lock(&mutex_lock);
+		remaining--;
+		if (first < 0)
+		{
+			first = (long)index;
+			if (any) pthread_cond_signal(&signal);
+		}
+		if (!any && remaining == 0)
+		{
+			pthread_cond_signal(&signal);
+		}
+		pthread_mutex_unlock(&mutex_lock);
+	}
+	/**
+	 * @brief		wait
+	 * 				条件成立の待機
+	 * @param[in]	timeout：タイムアウトをミリ秒にて指定。0の場合は無期限
+	 * @return	待機結果を返却します。
+	 * @retval	true ： 条件成立
+	 * @retval	false： タイムアウト
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool FutureGroup::wait(long timeout)
+	{
+		struct timespec abstime;
+		if (timeout > 0)
+		{
+			getAbsTime(&abstime , timeout);
+		}
+		pthread_mutex_lock(&mutex_lock);
+		while (any ? (first < 0 && count > 0) : (remaining > 0))
+		{
+			if (timeout > 0)
+			{
+				if (pthread_cond_timedwait(&signal , &mutex_lock , &abstime) == ETIMEDOUT)
+				{
+					break;
+				}
+			}
+			else
+			{
+				pthread_cond_wait(&signal , &mutex_lock);
+			}
+		}
+		bool done = any ? (first >= 0 || count == 0) : (remaining == 0);
+		pthread_mutex_unlock(&mutex_lock);
+		return done;
+	}
+	/**
+	 * @brief		getFirst
+	 * 				最初に完了した位置の取得
+	 * @return	最初に完了したハンドルの位置。未完了の場合は-1
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	long FutureGroup::getFirst()
+	{
+		long index;
+		pthread_mutex_lock(&mutex_lock);
+		index = first;
+		pthread_mutex_unlock(&mutex_lock);
+		return index;
+	}
+	/**
+	 * @brief		whenAll
+	 * 				全ての実行結果の完了待機
+	 * @note		全てのハンドルが完了した時点で一度だけ起床します。
+	 * @param[in]	futures：待機するハンドルの配列
+	 * @param[in]	count：ハンドルの数
+	 * @param[in]	timeout：タイムアウトをミリ秒にて指定。0の場合は無期限
+	 * @return	待機結果を返却します。
+	 * @retval	true ： 全て完了
+	 * @retval	false： タイムアウト
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool whenAll(FutureBase ** futures , size_t count , long timeout)
+	{
+		FutureGroup group(futures , count , false);
+		return group.wait(timeout);
+	}
+	/**
+	 * @brief		whenAny
+	 * 				いずれかの実行結果の完了待機
+	 * @note		最初のハンドルが完了した時点で一度だけ起床します。
+	 * @param[in]	futures：待機するハンドルの配列
+	 * @param[in]	count：ハンドルの数
+	 * @param[in]	timeout：タイムアウトをミリ秒にて指定。0の場合は無期限
+	 * @return	最初に完了したハンドルの位置を返却します。タイムアウトの場合は-1
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	long whenAny(FutureBase ** futures , size_t count , long timeout)
+	{
+		FutureGroup group(futures , count , true);
+		if (!group.wait(timeout)) return -1;
+		return group.getFirst();
+	}
+}
@@ -0,0 +1,395 @@
+/* ***************************************************************************
+ * @file		VSTDFuture.hpp
+ * @brief		型付き実行結果受け取り用 Class
+ * @see		VSTDThreadFunction.hpp / VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian ファイバーからの待機はファイバーのみを停止する様に変更
+ * ***************************************************************************/
+#ifndef VSTDFUTURE_HPP_
+#define VSTDFUTURE_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <pthread.h>
+#include <stddef.h>
+#include <new>
+#include <atomic>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include "VSTDThreadFunction.hpp"
+
+namespace VSTD
+{
+	/**
+	 * @brief		実行結果の状態を定義している列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief 実行結果待ちです */
+		FUTURE_PENDING,
+		/** @brief 実行結果が格納されています */
+		FUTURE_READY,
+		/** @brief 実行中に例外が発生しました */
+		FUTURE_FAILED,
+		/** @brief 実行されずに破棄されました(期限切れ・積み上げ失敗) */
+		FUTURE_ABANDONED
+	} futurestatus_t;
+	class FutureGroup;
+	class FutureStateBase;
+	struct FiberWaiter;
+	/**
+	 * @brief		一括待機の共有状態毎の登録情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct FutureGroupEntry
+	{
+		/** @brief 登録元のグループ */
+		FutureGroup *				group;
+		/** @brief 登録先の共有状態 */
+		FutureStateBase *			state;
+		/** @brief グループ内の位置 */
+		size_t						index;
+		/** @brief 共有状態に登録されている次の登録情報 */
+		struct FutureGroupEntry *	next;
+	} FutureGroupEntry_t;
+	/**
+	 * @brief		FutureStateBase
+	 * 				実行結果の共有状態
+	 * @note		実行側(ThreadCall)と受け取り側(Future)で共有され
+	 * 				参照カウントにより破棄されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class FutureStateBase
+	{
+	private:
+		/** @brief 状態保護用ミューテックス */
+		pthread_mutex_t			mutex_lock;
+		/** @brief 完了通知用条件変数 */
+		pthread_cond_t			signal;
+		/** @brief 実行結果の状態 */
+		futurestatus_t			status;
+		/** @brief 参照カウント */
+		std::atomic<int>		refs;
+		/** @brief 完了を待機しているグループ */
+		FutureGroupEntry_t *	groups;
+		/** @brief 完了を待機しているファイバー */
+		struct FiberWaiter *	fibers;
+		/** @brief 発生した例外 */
+		std::exception_ptr		error;
+		friend class FutureGroup;
+	protected:
+		void	complete(futurestatus_t state);
+		void	fail(std::exception_ptr exception);
+	public:
+		FutureStateBase(void);
+		virtual ~FutureStateBase(void);
+		void			addRef();
+		void			release();
+		futurestatus_t	getStatus();
+		bool			wait(long timeout = 0);
+		void			rethrow();
+		void			abandon();
+	};
+	/**
+	 * @brief		FutureState
+	 * 				型付き実行結果の共有状態
+	 * @note		実行結果は共有状態内の領域に直接構築されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	template <class R>
+	class FutureState : public FutureStateBase
+	{
+	private:
+		/** @brief 実行結果の格納領域 */
+		typename std::aligned_storage<sizeof(R) , alignof(R)>::type	storage;
+		/** @brief 実行結果が構築済みか */
+		bool	constructed;
+	public:
+		FutureState(void) : constructed(false) {}
+		~FutureState(void)
+		{
+			if (constructed)
+			{
+				reinterpret_cast<R *>(&storage)->~R();
+			}
+		}
+		/**
+		 * @brief		run
+		 * 				関数を実行し実行結果を格納領域に構築します。
+		 * @param[in]	func：実行する関数オブジェクト
+		 */
+		template <class F>
+		void run(F & func)
+		{
+			try
+			{
+				new (&storage) R(func());
+				constructed = true;
+			}
+			catch(...)
+			{
+				fail(std::current_exception());
+				return;
+			}
+			complete(FUTURE_READY);
+		}
+		/**
+		 * @brief		value
+		 * 				格納されている実行結果を参照します。
+		 * @note		完了を待機してから呼び出してください。
+		 * @return	実行結果を返却します。未完了の場合はNULL
+		 */
+		R * value()
+		{
+			return constructed ? reinterpret_cast<R *>(&storage) : NULL;
+		}
+	};
+	/**
+	 * @brief		FutureState
+	 * 				戻り値無しの実行結果の共有状態
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	template <>
+	class FutureState<void> : public FutureStateBase
+	{
+	public:
+		template <class F>
+		void run(F & func)
+		{
+			try
+			{
+				func();
+			}
+			catch(...)
+			{
+				fail(std::current_exception());
+				return;
+			}
+			complete(FUTURE_READY);
+		}
+	};
+	/**
+	 * @brief		FutureBase
+	 * 				実行結果の受け取り用ハンドルの基底クラス
+	 * @note		whenAll/whenAnyにて型の異なるハンドルをまとめて待機する為に
+	 * 				使用します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class FutureBase
+	{
+	protected:
+		/** @brief 共有状態 */
+		FutureStateBase *	state;
+	public:
+		FutureBase(FutureStateBase * shared = NULL) : state(shared)
+		{
+			if (state) state->addRef();
+		}
+		FutureBase(const FutureBase & other) : state(other.state)
+		{
+			if (state) state->addRef();
+		}
+		FutureBase(FutureBase && other) : state(other.state)
+		{
+			other.state = NULL;
+		}
+		FutureBase & operator=(FutureBase other)
+		{
+			std::swap(state , other.state);
+			return *this;
+		}
+		virtual ~FutureBase(void)
+		{
+			if (state) state->release();
+		}
+		/** @brief 共有状態を保持しているか */
+		bool valid() const { return state != NULL; }
+		/** @brief 実行結果の状態を取得します。 */
+		futurestatus_t getStatus() const
+		{
+			return state ? state->getStatus() : FUTURE_ABANDONED;
+		}
+		/**
+		 * @brief		wait
+		 * 				完了待機
+		 * @param[in]	timeout：タイムアウトをミリ秒にて指定。0の場合は無期限
+		 * @retval	true ： 完了(成功・失敗・破棄)
+		 * @retval	false： タイムアウト
+		 */
+		bool wait(long timeout = 0) const
+		{
+			return state ? state->wait(timeout) : true;
+		}
+		FutureStateBase * getState() const { return state; }
+	protected:
+		void checkState() const;
+	};
+	/**
+	 * @brief		Future
+	 * 				型付き実行結果の受け取り用ハンドル
+	 * @note		ThreadCall::submitにて返却されます。
+	 * 				ムーブのみ可能な型も余分な複製無しに受け取る事が出来ます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	template <class R>
+	class Future : public FutureBase
+	{
+	public:
+		Future(FutureState<R> * shared = NULL) : FutureBase(shared) {}
+		/**
+		 * @brief		get
+		 * 				実行結果の取得
+		 * @note		完了まで待機し、実行結果をムーブして返却します。
+		 * 				実行中に例外が発生した場合は例外を再送出します。
+		 * 				実行されずに破棄された場合、又は共有状態を保持していない
+		 * 				場合はstd::runtime_errorを送出します。
+		 * 				実行結果は一度だけ取得出来ます。
+		 * @return	実行結果を返却します。
+		 */
+		R get()
+		{
+			checkState();
+			state->wait();
+			state->rethrow();
+			return std::move(*static_cast<FutureState<R> *>(state)->value());
+		}
+		/**
+		 * @brief		peek
+		 * 				実行結果の参照
+		 * @return	完了している場合は実行結果を、それ以外はNULLを返却します。
+		 */
+		R * peek()
+		{
+			if (!state || state->getStatus() != FUTURE_READY) return NULL;
+			return static_cast<FutureState<R> *>(state)->value();
+		}
+	};
+	/**
+	 * @brief		Future
+	 * 				戻り値無しの実行結果の受け取り用ハンドル
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	template <>
+	class Future<void> : public FutureBase
+	{
+	public:
+		Future(FutureState<void> * shared = NULL) : FutureBase(shared) {}
+		void get()
+		{
+			checkState();
+			state->wait();
+			state->rethrow();
+		}
+	};
+	/**
+	 * @brief		FutureTask
+	 * 				ThreadCall::submitにて生成されるThreadFunction
+	 * @note		自動解放が指定されており、ThreadCallにて処理完了後
+	 * 				(期限切れの場合を含む)に破棄されます。
+	 * 				実行されずに破棄された場合、共有状態はFUTURE_ABANDONEDとなります。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	template <class R , class F>
+	class FutureTask : public ThreadFunction
+	{
+	private:
+		/** @brief 実行する関数オブジェクト */
+		F					func;
+		/** @brief 共有状態 */
+		FutureState<R> *	state;
+	public:
+		template <class G>
+		FutureTask(G && f) : func(std::forward<G>(f)) , state(new FutureState<R>())
+		{
+			state->addRef();
+			setAutoRelease(true);
+		}
+		~FutureTask()
+		{
+			state->abandon();
+			state->release();
+		}
+		FutureState<R> * getState() { return state; }
+		bool Function()
+		{
+			state->run(func);
+			return true;
+		}
+	};
+	/**
+	 * @brief		FutureGroup
+	 * 				複数の実行結果の一括待機
+	 * @note		各共有状態に登録され、条件を満たした時点で一度だけ
+	 * 				待機側を起床させます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class FutureGroup
+	{
+	private:
+		/** @brief 状態保護用ミューテックス */
+		pthread_mutex_t		mutex_lock;
+		/** @brief 完了通知用条件変数 */
+		pthread_cond_t		signal;
+		/** @brief 共有状態毎の登録情報 */
+		FutureGroupEntry_t *	entries;
+		/** @brief 待機対象の数 */
+		size_t				count;
+		/** @brief 未完了の数 */
+		size_t				remaining;
+		/** @brief 最初に完了した位置 */
+		long					first;
+		/** @brief いずれかの完了で起床するか */
+		bool					any;
+		void	notify(size_t index);
+		friend class FutureStateBase;
+	public:
+		FutureGroup(FutureBase ** futures , size_t num , bool waitAny);
+		~FutureGroup(void);
+		bool	wait(long timeout);
+		long	getFirst();
+	};
+	bool	whenAll(FutureBase ** futures , size_t count , long timeout = 0);
+	long	whenAny(FutureBase ** futures , size_t count , long timeout = 0);
+	/**
+	 * @brief		whenAll
+	 * 				全ての実行結果の完了待機
+	 * @param[in]	futures：待機するハンドルを指定します。
+	 * @return	全て完了した場合はtrue
+	 */
+	template <class... T>
+	bool whenAll(Future<T> &... futures)
+	{
+		FutureBase * list[] = { &futures... };
+		return whenAll(list , sizeof...(T) , 0);
+	}
+	/**
+	 * @brief		whenAny
+	 * 				いずれかの実行結果の完了待機
+	 * @param[in]	futures：待機するハンドルを指定します。
+	 * @return	最初に完了したハンドルの位置を返却します。
+	 */
+	template <class... T>
+	long whenAny(Future<T> &... futures)
+	{
+		FutureBase * list[] = { &futures... };
+		return whenAny(list , sizeof...(T) , 0);
+	}
+}
+#endif /*VSTDFUTURE_HPP_*/
@@ -0,0 +1,873 @@
+/* ***************************************************************************
+ * @file		VSTDJournal.cpp
+ * @brief		待ち行列の永続化(ジャーナル)用 Class
+ * @see		VSTDThreadCall.hpp / VSTDFutex.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 未完了のレコード数の取得(getReplayCount)を追加
+ * ***************************************************************************/
+#include "VSTDJournal.hpp"
+#include "VSTDFutex.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <new>
+
+namespace VSTD
+{
+	/**
+	 * @brief		レコードが占める領域のサイズ
+	 * @param[in]	len：データの長さ
+	 * @return	先頭を含め16byte境界に切り上げたサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static inline size_t getRecordSize(size_t len)
+	{
+		return sizeof(JournalRecord_t) + ((len + 15) & ~(size_t)15);
+	}
+	/**
+	 * @brief		データのチェックサム
+	 * @note		FNV-1aにて通番とデータから算出します。
+	 * @param[in]	data：データ
+	 * @param[in]	len：データの長さ
+	 * @param[in]	seq：レコードの通番
+	 * @return	チェックサムを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static uint32_t getChecksum(const void * data , size_t len , uint64_t seq)
+	{
+		const unsigned char *	p		= (const unsigned char *)data;
+		uint32_t				hash	= 2166136261u ^ (uint32_t)seq ^ (uint32_t)(seq >> 32);
+		for (size_t i = 0 ; i < len ; i++)
+		{
+			hash ^= p[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+	/* ***********************************************************************
+	 *
+	 * JournalFlusher
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		JournalFlusherのコンストラクタ
+	 * @param[in]	owner：書き出すジャーナル
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	JournalFlusher::JournalFlusher(Journal * owner)
+		: ThreadCall() , journal(owner)
+	{
+	}
+	/**
+	 * @brief		JournalFlusherのデストラクタ
+	 * @note		派生クラスの破棄前にスレッドを停止します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	JournalFlusher::~JournalFlusher(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		onFunction
+	 * 				書き出しの実行
+	 * @note		ジャーナルがcloseされるまで書き出しを繰り返します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool JournalFlusher::onFunction()
+	{
+		return journal->run();
+	}
+	/* ***********************************************************************
+	 *
+	 * Journal
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		Journalのコンストラクタ
+	 * @note		openにてディレクトリを指定するまで使用出来ません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Journal::Journal(void)
+	{
+		dirfd			= -1;
+		segmentSize	= JOURNAL_SEGMENT_SIZE;
+		syncMode		= JOURNAL_SYNC_INTERVAL;
+		interval		= (long long)JOURNAL_FLUSH_INTERVAL * 1000000LL;
+		memset(segments , 0 , sizeof(segments));
+		firstIndex	= 0;
+		nextIndex		= 0;
+		current		= NULL;
+		seq			= 0;
+		flusher		= NULL;
+		closing		= false;
+		requestSeq	= 0;
+		flusherWaiting	= 0;
+		completedSeq	= 0;
+		syncWaiters	= 0;
+		appended		= 0;
+		completed		= 0;
+		recovered		= 0;
+		replayCount	= 0;
+		syncs			= 0;
+	}
+	/**
+	 * @brief		Journalのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Journal::~Journal(void)
+	{
+		close();
+	}
+	/**
+	 * @brief		operator new
+	 * @note		メンバのキャッシュライン分離を有効にする為、
+	 * 				キャッシュライン境界に確保します。
+	 * @param[in]	size：確保するサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * Journal::operator new(size_t size)
+	{
+		void * ptr;
+		if (posix_memalign(&ptr , TH_CACHE_LINE , size) != 0)
+		{
+			throw std::bad_alloc();
+		}
+		return ptr;
+	}
+	/**
+	 * @brief		operator delete
+	 * @param[in]	ptr：operator newにて確保した領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::operator delete(void * ptr)
+	{
+		free(ptr);
+	}
+	/**
+	 * @brief		open
+	 * 				ジャーナルを開く
+	 * @note		ディレクトリが存在しない場合は作成します。
+	 * 				既存のセグメントファイルを読み込み、未完了のレコードを
+	 * 				takeReplayにて取得出来る様にします。
+	 * 				未完了のレコードが無いセグメントファイルは削除します。
+	 * 				追加は常に新しいセグメントファイルへ行います。
+	 * @param[in]	path：セグメントファイルを配置するディレクトリ
+	 * @param[in]	mode：書き出し方式
+	 * @param[in]	flushInterval：書き出し間隔(ミリ秒)
+	 * @param[in]	size：セグメントファイルのサイズ(byte)。ページ境界に切り上げます。
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Journal::open(const char * path , JournalSync_t mode , long flushInterval , size_t size)
+	{
+		std::vector<uint32_t>	found;
+		try
+		{
+			close();
+			size_t page = (size_t)sysconf(_SC_PAGESIZE);
+			if (size < page * 2) size = page * 2;
+			segmentSize	= (size + page - 1) / page * page;
+			syncMode		= mode;
+			interval		= (long long)(flushInterval > 0 ? flushInterval : JOURNAL_FLUSH_INTERVAL) * 1000000LL;
+			directory		= path;
+			if (mkdir(path , 0755) == -1 && errno != EEXIST)
+			{
+				perror("Journal::open mkdir");
+				return false;
+			}
+			dirfd = ::open(path , O_RDONLY | O_DIRECTORY);
+			if (dirfd == -1)
+			{
+				perror("Journal::open");
+				return false;
+			}
+			/* ***************************************************************
+			 * 既存のセグメントファイルを番号順に読み込む
+			 * ***************************************************************/
+			DIR * dir = opendir(path);
+			if (!dir)
+			{
+				perror("Journal::open opendir");
+				close();
+				return false;
+			}
+			struct dirent * entry;
+			while ((entry = readdir(dir)) != NULL)
+			{
+				unsigned int	index;
+				char			tail;
+				if (sscanf(entry->d_name , "journal-%10u.se%c" , &index , &tail) == 2 && tail == 'g')
+				{
+					found.push_back((uint32_t)index);
+				}
+			}
+			closedir(dir);
+			std::sort(found.begin() , found.end());
+			if (!found.empty() && found.back() - found.front() >= MAX_JOURNAL_SEGMENT)
+			{
+				fprintf(stderr , "Journal::open: too many segments in %s\n" , path);
+				close();
+				return false;
+			}
+			firstIndex	= found.empty() ? 0 : found.front();
+			nextIndex		= found.empty() ? 0 : found.back() + 1;
+			for (size_t i = 0 ; i < found.size() ; i++)
+			{
+				JournalSegment_t * segment = loadSegment(found[i]);
+				if (!segment)
+				{
+					continue;
+				}
+				/* 未完了のレコードが無い場合は削除 */
+				if (segment->pending.load(std::memory_order_relaxed) == 0)
+				{
+					releaseSegment(segment , true);
+					continue;
+				}
+				segments[segment->index % MAX_JOURNAL_SEGMENT] = segment;
+			}
+			recovered = replay.size();
+			replayCount.store(recovered , std::memory_order_release);
+			/* 古いものから取り出す為、逆順に保持 */
+			std::reverse(replay.begin() , replay.end());
+			/* ***************************************************************
+			 * 追加用のセグメントを作成し書き出しスレッドを開始
+			 * ***************************************************************/
+			current = createSegment(nextIndex);
+			if (!current)
+			{
+				close();
+				return false;
+			}
+			nextIndex++;
+			closing.store(false , std::memory_order_release);
+			flusher = new JournalFlusher(this);
+			flusher->setFunction();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		close
+	 * 				ジャーナルを閉じる
+	 * @note		追加済みのレコードを書き出してから閉じます。
+	 * 				未完了のレコードはファイルに残り、次回のopenにて再実行されます。
+	 * 				appendにて返却された領域とtakeReplayにて取得した領域は無効となります。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::close()
+	{
+		try
+		{
+			if (flusher)
+			{
+				closing.store(true , std::memory_order_seq_cst);
+				requestSeq.fetch_add(1 , std::memory_order_seq_cst);
+				FutexWake(&requestSeq);
+				delete flusher;
+				flusher = NULL;
+			}
+			/* 書き出しを待機しているappendを解放 */
+			completedSeq.store(requestSeq.load(std::memory_order_seq_cst) , std::memory_order_seq_cst);
+			FutexWake(&completedSeq);
+			mutex.lock();
+			for (unsigned int i = 0 ; i < MAX_JOURNAL_SEGMENT ; i++)
+			{
+				if (segments[i])
+				{
+					bool done = segments[i]->pending.load(std::memory_order_acquire) == 0;
+					releaseSegment(segments[i] , done);
+					segments[i] = NULL;
+				}
+			}
+			current = NULL;
+			replay.clear();
+			replayCount.store(0 , std::memory_order_release);
+			mutex.unlock();
+			if (dirfd != -1)
+			{
+				fsync(dirfd);
+				::close(dirfd);
+				dirfd = -1;
+			}
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		append
+	 * 				データの追記
+	 * @note		現在のセグメントに領域を予約してデータを複製し、未完了として
+	 * 				記録します。予約のみミューテックスにて保護し、複製は並行して行います。
+	 * 				JOURNAL_SYNC_COMMITの場合は書き出されるまで待機します。
+	 * 				返却された領域はcompleteを呼び出すまで有効です。
+	 * @param[in]	data：データ
+	 * @param[in]	len：データの長さ
+	 * @return	ジャーナル上のデータの領域を返却します。失敗した場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * Journal::append(const void * data , size_t len)
+	{
+		try
+		{
+			size_t need = getRecordSize(len);
+			if (len == 0 || len > UINT32_MAX || JOURNAL_HEADER_SIZE + need > segmentSize)
+			{
+				return NULL;
+			}
+			mutex.lock();
+			if (!current || closing.load(std::memory_order_relaxed))
+			{
+				mutex.unlock();
+				return NULL;
+			}
+			/* 満杯の場合は次のセグメントへ切り替え */
+			if (current->reserved + need > current->size)
+			{
+				JournalSegment_t * next = createSegment(nextIndex);
+				if (!next)
+				{
+					mutex.unlock();
+					return NULL;
+				}
+				current->sealed	= true;
+				current			= next;
+				nextIndex++;
+			}
+			JournalSegment_t *	segment	= current;
+			JournalRecord_t *	record	= (JournalRecord_t *)(segment->base + segment->reserved);
+			segment->reserved += need;
+			/* 長さは予約中に設定し、書き込み中のレコードも読み飛ばせる様にする */
+			record->len		= (uint32_t)len;
+			record->segment	= segment->index;
+			record->seq		= seq++;
+			segment->pending.fetch_add(1 , std::memory_order_relaxed);
+			mutex.unlock();
+			void * payload = (char *)record + sizeof(JournalRecord_t);
+			memcpy(payload , data , len);
+			record->checksum = getChecksum(payload , len , record->seq);
+			record->state.store(JOURNAL_REC_PENDING , std::memory_order_release);
+			appended.fetch_add(1 , std::memory_order_relaxed);
+			if (syncMode == JOURNAL_SYNC_COMMIT)
+			{
+				requestSync(true);
+			}
+			return payload;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		complete
+	 * 				完了の記録
+	 * @note		レコードを完了とし、再起動時に再実行されない様にします。
+	 * 				完了の記録は次の書き出しにて永続化されます。
+	 * 				呼び出し後はデータの領域を参照しないでください。
+	 * @param[in]	payload：appendまたはtakeReplayにて取得した領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::complete(void * payload)
+	{
+		if (!payload) return;
+		JournalRecord_t * record = (JournalRecord_t *)((char *)payload - sizeof(JournalRecord_t));
+		JournalSegment_t * segment = segments[record->segment % MAX_JOURNAL_SEGMENT];
+		record->state.store(JOURNAL_REC_DONE , std::memory_order_release);
+		completed.fetch_add(1 , std::memory_order_relaxed);
+		segment->pending.fetch_sub(1 , std::memory_order_acq_rel);
+	}
+	/**
+	 * @brief		sync
+	 * 				書き出し
+	 * @note		呼び出し時点までに追加・完了したレコードが書き出されるまで待機します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::sync()
+	{
+		if (!flusher) return;
+		requestSync(true);
+	}
+	/**
+	 * @brief		takeReplay
+	 * 				未完了のレコードの取得
+	 * @note		open時に未完了だったレコードのデータを古い順に取得します。
+	 * 				取得したデータは実行後にcompleteを呼び出してください。
+	 * @param[out]	items：データの領域を格納します。
+	 * @param[in]	num：取得する最大数
+	 * @return	取得した数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	size_t Journal::takeReplay(void ** items , size_t num)
+	{
+		try
+		{
+			size_t taken = 0;
+			mutex.lock();
+			while (taken < num && !replay.empty())
+			{
+				items[taken++] = replay.back();
+				replay.pop_back();
+			}
+			replayCount.store(replay.size() , std::memory_order_release);
+			mutex.unlock();
+			return taken;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		restoreReplay
+	 * 				未完了のレコードの返却
+	 * @note		takeReplayにて取得したが実行出来なかったデータを戻し、
+	 * 				次回のtakeReplayにて再度取得出来る様にします。
+	 * @param[in]	items：takeReplayにて取得した領域
+	 * @param[in]	num：戻す数
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::restoreReplay(void ** items , size_t num)
+	{
+		try
+		{
+			mutex.lock();
+			while (num > 0)
+			{
+				replay.push_back(items[--num]);
+			}
+			replayCount.store(replay.size() , std::memory_order_release);
+			mutex.unlock();
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getReplayCount
+	 * 				未完了のレコード数の取得
+	 * @note		takeReplayにて取得されていない未完了のレコードの数を
+	 * 				ミューテックスを取得せずに返却します。
+	 * @return	未完了のレコードの数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	size_t Journal::getReplayCount()
+	{
+		return replayCount.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		getStat
+	 * 				統計情報の取得
+	 * @param[out]	stat：統計情報を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::getStat(JournalStat_t * stat)
+	{
+		try
+		{
+			stat->appended	= appended.load(std::memory_order_relaxed);
+			stat->completed	= completed.load(std::memory_order_relaxed);
+			stat->recovered	= recovered;
+			stat->syncs		= syncs.load(std::memory_order_relaxed);
+			stat->segments	= 0;
+			mutex.lock();
+			for (unsigned int i = 0 ; i < MAX_JOURNAL_SEGMENT ; i++)
+			{
+				if (segments[i]) stat->segments++;
+			}
+			mutex.unlock();
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getPayloadSize
+	 * 				データの長さの取得
+	 * @param[in]	payload：appendまたはtakeReplayにて取得した領域
+	 * @return	データの長さを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	size_t Journal::getPayloadSize(const void * payload)
+	{
+		const JournalRecord_t * record = (const JournalRecord_t *)((const char *)payload - sizeof(JournalRecord_t));
+		return record->len;
+	}
+	/**
+	 * @brief		getSegmentPath
+	 * 				セグメントファイルのパスの取得
+	 * @param[in]	index：セグメントの番号
+	 * @param[out]	path：パスを格納します。
+	 * @param[in]	len：pathのサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::getSegmentPath(uint32_t index , char * path , size_t len)
+	{
+		snprintf(path , len , "%s/journal-%010u.seg" , directory.c_str() , (unsigned int)index);
+	}
+	/**
+	 * @brief		createSegment
+	 * 				セグメントファイルの作成
+	 * @note		領域をfallocateにて確保してからマッピングする為、
+	 * 				書き込み時に容量不足となる事はありません。
+	 * 				ミューテックスを取得した状態、またはopen中に呼び出してください。
+	 * @param[in]	index：セグメントの番号
+	 * @return	作成したセグメントを返却します。失敗した場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	JournalSegment_t * Journal::createSegment(uint32_t index)
+	{
+		char path[PATH_MAX];
+		if (segments[index % MAX_JOURNAL_SEGMENT])
+		{
+			fprintf(stderr , "Journal::createSegment: too many segments with pending records\n");
+			return NULL;
+		}
+		getSegmentPath(index , path , sizeof(path));
+		int fd = ::open(path , O_RDWR | O_CREAT | O_EXCL , 0644);
+		if (fd == -1)
+		{
+			perror("Journal::createSegment");
+			return NULL;
+		}
+		int err = posix_fallocate(fd , 0 , (off_t)segmentSize);
+		if (err != 0)
+		{
+			errno = err;
+			perror("Journal::createSegment fallocate");
+			::close(fd);
+			unlink(path);
+			return NULL;
+		}
+		void * base = mmap(NULL , segmentSize , PROT_READ | PROT_WRITE , MAP_SHARED , fd , 0);
+		if (base == MAP_FAILED)
+		{
+			perror("Journal::createSegment mmap");
+			::close(fd);
+			unlink(path);
+			return NULL;
+		}
+		JournalSegmentHeader_t * header = (JournalSegmentHeader_t *)base;
+		header->version	= JOURNAL_VERSION;
+		header->index		= index;
+		header->size		= segmentSize;
+		header->magic		= JOURNAL_MAGIC;
+		JournalSegment_t * segment = new JournalSegment_t;
+		segment->index	= index;
+		segment->fd		= fd;
+		segment->base		= (char *)base;
+		segment->size		= segmentSize;
+		segment->reserved	= JOURNAL_HEADER_SIZE;
+		segment->synced	= 0;
+		segment->syncedPending	= 0;
+		segment->pending	= 0;
+		segment->sealed	= false;
+		segment->durable	= false;
+		segments[index % MAX_JOURNAL_SEGMENT] = segment;
+		return segment;
+	}
+	/**
+	 * @brief		loadSegment
+	 * 				既存のセグメントファイルの読み込み
+	 * @note		レコードを先頭から走査し、チェックサムが一致する未完了の
+	 * 				レコードを再実行の対象とします。書き込み中に終了したレコードは
+	 * 				長さにより読み飛ばします。
+	 * @param[in]	index：セグメントの番号
+	 * @return	読み込んだセグメントを返却します。失敗した場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	JournalSegment_t * Journal::loadSegment(uint32_t index)
+	{
+		char		path[PATH_MAX];
+		struct stat	st;
+		getSegmentPath(index , path , sizeof(path));
+		int fd = ::open(path , O_RDWR);
+		if (fd == -1)
+		{
+			perror("Journal::loadSegment");
+			return NULL;
+		}
+		if (fstat(fd , &st) == -1 || (size_t)st.st_size < JOURNAL_HEADER_SIZE)
+		{
+			::close(fd);
+			unlink(path);
+			return NULL;
+		}
+		size_t size = (size_t)st.st_size;
+		void * base = mmap(NULL , size , PROT_READ | PROT_WRITE , MAP_SHARED , fd , 0);
+		if (base == MAP_FAILED)
+		{
+			perror("Journal::loadSegment mmap");
+			::close(fd);
+			return NULL;
+		}
+		JournalSegment_t * segment = new JournalSegment_t;
+		segment->index	= index;
+		segment->fd		= fd;
+		segment->base		= (char *)base;
+		segment->size		= size;
+		segment->pending	= 0;
+		segment->sealed	= true;
+		segment->durable	= true;
+		JournalSegmentHeader_t * header = (JournalSegmentHeader_t *)base;
+		size_t pos = JOURNAL_HEADER_SIZE;
+		if (header->magic == JOURNAL_MAGIC && header->version == JOURNAL_VERSION)
+		{
+			while (pos + sizeof(JournalRecord_t) <= size)
+			{
+				JournalRecord_t * record = (JournalRecord_t *)(segment->base + pos);
+				size_t len = record->len;
+				if (len == 0 || getRecordSize(len) > size - pos)
+				{
+					break;
+				}
+				void * payload = (char *)record + sizeof(JournalRecord_t);
+				if (record->seq >= seq)
+				{
+					seq = record->seq + 1;
+				}
+				if (record->state.load(std::memory_order_relaxed) == JOURNAL_REC_PENDING
+				 && record->segment == index
+				 && record->checksum == getChecksum(payload , len , record->seq))
+				{
+					segment->pending.fetch_add(1 , std::memory_order_relaxed);
+					replay.push_back(payload);
+				}
+				pos += getRecordSize(len);
+			}
+		}
+		segment->reserved	= pos;
+		segment->synced	= pos;
+		segment->syncedPending	= segment->pending.load(std::memory_order_relaxed);
+		return segment;
+	}
+	/**
+	 * @brief		releaseSegment
+	 * 				セグメントの解放
+	 * @param[in]	segment：解放するセグメント
+	 * @param[in]	remove：ファイルを削除するか
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::releaseSegment(JournalSegment_t * segment , bool remove)
+	{
+		char path[PATH_MAX];
+		munmap(segment->base , segment->size);
+		::close(segment->fd);
+		if (remove)
+		{
+			getSegmentPath(segment->index , path , sizeof(path));
+			unlink(path);
+		}
+		delete segment;
+	}
+	/**
+	 * @brief		flush
+	 * 				書き出し
+	 * @note		予約位置または未完了数が前回から変化したセグメントを
+	 * 				fdatasyncにて書き出します。マッピング経由の変更(完了の記録を含む)は
+	 * 				まとめて書き出され、作成直後のセグメントはファイルサイズも書き出します。
+	 * 				書き出しスレッドからのみ呼び出してください。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::flush()
+	{
+		JournalSegment_t *	dirty[MAX_JOURNAL_SEGMENT];
+		size_t				reserved[MAX_JOURNAL_SEGMENT];
+		long				pending[MAX_JOURNAL_SEGMENT];
+		unsigned int		num		= 0;
+		bool				created	= false;
+		mutex.lock();
+		for (uint32_t index = firstIndex ; index != nextIndex ; index++)
+		{
+			JournalSegment_t * segment = segments[index % MAX_JOURNAL_SEGMENT];
+			if (!segment) continue;
+			/* 追加は予約位置、完了は未完了数の変化にて判定 */
+			long count = segment->pending.load(std::memory_order_acquire);
+			if (!segment->durable || segment->reserved != segment->synced || count != segment->syncedPending)
+			{
+				if (!segment->durable) created = true;
+				dirty[num]		= segment;
+				reserved[num]	= segment->reserved;
+				pending[num]	= count;
+				num++;
+			}
+		}
+		mutex.unlock();
+		/* セグメントの解放は書き出しスレッドのみが行う為、ミューテックス無しで参照可能 */
+		for (unsigned int i = 0 ; i < num ; i++)
+		{
+			if (fdatasync(dirty[i]->fd) == -1)
+			{
+				perror("Journal::flush");
+				continue;
+			}
+			dirty[i]->synced			= reserved[i];
+			dirty[i]->syncedPending	= pending[i];
+			dirty[i]->durable			= true;
+		}
+		if (created && dirfd != -1)
+		{
+			fsync(dirfd);
+		}
+		if (num > 0)
+		{
+			syncs.fetch_add(1 , std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		retire
+	 * 				完了したセグメントの削除
+	 * @note		追加を終了し、全てのレコードが完了したセグメントを削除します。
+	 * 				書き出しスレッドからのみ呼び出してください。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::retire()
+	{
+		mutex.lock();
+		for (uint32_t index = firstIndex ; index != nextIndex ; index++)
+		{
+			JournalSegment_t * segment = segments[index % MAX_JOURNAL_SEGMENT];
+			if (segment && segment->sealed
+			 && segment->pending.load(std::memory_order_acquire) == 0)
+			{
+				segments[index % MAX_JOURNAL_SEGMENT] = NULL;
+				releaseSegment(segment , true);
+			}
+		}
+		while (firstIndex != nextIndex && !segments[firstIndex % MAX_JOURNAL_SEGMENT])
+		{
+			firstIndex++;
+		}
+		mutex.unlock();
+	}
+	/**
+	 * @brief		requestSync
+	 * 				書き出しの要求
+	 * @note		要求の通番を取得して書き出しスレッドを起床させます。
+	 * 				書き出しスレッドは通番を読み込んでから書き出す為、
+	 * 				要求前に書き込んだレコードは必ず含まれます。
+	 * 				同時に要求した場合は一度の書き出しでまとめて完了します。
+	 * @param[in]	wait：書き出されるまで待機するか
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Journal::requestSync(bool wait)
+	{
+		int ticket = requestSeq.fetch_add(1 , std::memory_order_seq_cst) + 1;
+		if (flusherWaiting.load(std::memory_order_seq_cst))
+		{
+			FutexWake(&requestSeq , 1);
+		}
+		if (!wait)
+		{
+			return;
+		}
+		syncWaiters.fetch_add(1 , std::memory_order_seq_cst);
+		while (true)
+		{
+			int done = completedSeq.load(std::memory_order_seq_cst);
+			if ((int)((unsigned int)done - (unsigned int)ticket) >= 0)
+			{
+				break;
+			}
+			FutexWait(&completedSeq , done);
+		}
+		syncWaiters.fetch_sub(1 , std::memory_order_seq_cst);
+	}
+	/**
+	 * @brief		run
+	 * 				書き出しスレッドの処理
+	 * @note		書き出しの要求、または書き出し間隔毎に書き出し、
+	 * 				要求した全てのappend/syncを完了させます。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Journal::run()
+	{
+		try
+		{
+			while (true)
+			{
+				bool	stop		= closing.load(std::memory_order_seq_cst);
+				int		request	= requestSeq.load(std::memory_order_seq_cst);
+				if (!stop && request == completedSeq.load(std::memory_order_relaxed))
+				{
+					flusherWaiting.store(1 , std::memory_order_seq_cst);
+					if (requestSeq.load(std::memory_order_seq_cst) == request)
+					{
+						FutexWait(&requestSeq , request , interval);
+					}
+					flusherWaiting.store(0 , std::memory_order_relaxed);
+					stop	= closing.load(std::memory_order_seq_cst);
+					request	= requestSeq.load(std::memory_order_seq_cst);
+				}
+				flush();
+				completedSeq.store(request , std::memory_order_seq_cst);
+				if (syncWaiters.load(std::memory_order_seq_cst))
+				{
+					FutexWake(&completedSeq);
+				}
+				retire();
+				if (stop)
+				{
+					break;
+				}
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+}
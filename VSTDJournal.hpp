@@ -0,0 +1,278 @@
+/* ***************************************************************************
+ * @file		VSTDJournal.hpp
+ * @brief		待ち行列の永続化(ジャーナル)用 Class
+ * @see		VSTDThreadCall.hpp / VSTDFutex.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 未完了のレコード数の取得(getReplayCount)を追加
+ * ***************************************************************************/
+#ifndef VSTDJOURNAL_HPP_
+#define VSTDJOURNAL_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief セグメントファイルの識別子 */
+	#define JOURNAL_MAGIC 0x564A524E
+	/** @brief セグメントファイルの形式の版数 */
+	#define JOURNAL_VERSION 1
+	/** @brief セグメントファイルの既定のサイズ(byte) */
+	#define JOURNAL_SEGMENT_SIZE (64UL * 1024UL * 1024UL)
+	/** @brief セグメントファイルの先頭部分のサイズ(byte) */
+	#define JOURNAL_HEADER_SIZE 64
+	/** @brief 同時に保持するセグメントの最大数 */
+	#define MAX_JOURNAL_SEGMENT 1024
+	/** @brief 既定の書き出し間隔(ミリ秒) */
+	#define JOURNAL_FLUSH_INTERVAL 10
+	class JournalFlusher;
+	/**
+	 * @brief		書き出し方式を定義している列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief 書き出し間隔毎にまとめて書き出します。appendは待機しません */
+		JOURNAL_SYNC_INTERVAL,
+		/** @brief appendは追加したレコードが書き出されるまで待機します(グループコミット) */
+		JOURNAL_SYNC_COMMIT
+	} JournalSync_t;
+	/**
+	 * @brief		レコードの状態を定義している列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief 未使用、または書き込み中です */
+		JOURNAL_REC_EMPTY		= 0 ,
+		/** @brief 未完了です。再起動時に再実行されます */
+		JOURNAL_REC_PENDING		= 0x4A50 ,
+		/** @brief 完了しました */
+		JOURNAL_REC_DONE			= 0x4A44
+	} JournalRecordState_t;
+	/**
+	 * @brief		セグメントファイルの先頭
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 識別子 */
+		uint32_t	magic;
+		/** @brief 形式の版数 */
+		uint32_t	version;
+		/** @brief セグメントの番号 */
+		uint32_t	index;
+		/** @brief 予約 */
+		uint32_t	reserved;
+		/** @brief セグメントのサイズ(byte) */
+		uint64_t	size;
+	} JournalSegmentHeader_t;
+	/**
+	 * @brief		レコードの先頭
+	 * @note		データは直後に16byte境界で配置されます。
+	 * 				長さは予約時に設定される為、書き込み中のレコードも読み飛ばせます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief レコードの状態 */
+		std::atomic<uint32_t>	state;
+		/** @brief データの長さ */
+		uint32_t				len;
+		/** @brief セグメントの番号 */
+		uint32_t				segment;
+		/** @brief データのチェックサム */
+		uint32_t				checksum;
+		/** @brief 追加順の通番 */
+		uint64_t				seq;
+		/** @brief 予約 */
+		uint64_t				reserved;
+	} JournalRecord_t;
+	/**
+	 * @brief		セグメントの管理情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief セグメントの番号 */
+		uint32_t			index;
+		/** @brief ファイルディスクリプタ */
+		int					fd;
+		/** @brief マッピング */
+		char *				base;
+		/** @brief サイズ */
+		size_t				size;
+		/** @brief 予約済みの位置(ミューテックスにて保護) */
+		size_t				reserved;
+		/** @brief 書き出し済みの位置(書き出しスレッドのみ更新) */
+		size_t				synced;
+		/** @brief 書き出し時の未完了のレコード数(書き出しスレッドのみ更新) */
+		long				syncedPending;
+		/** @brief 未完了のレコード数 */
+		std::atomic<long>	pending;
+		/** @brief 追加を終了したか */
+		bool				sealed;
+		/** @brief ファイルサイズを含め書き出し済みか */
+		bool				durable;
+	} JournalSegment_t;
+	/**
+	 * @brief		ジャーナルの統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 追加した総数 */
+		unsigned long		appended;
+		/** @brief 完了した総数 */
+		unsigned long		completed;
+		/** @brief open時に未完了だった数 */
+		unsigned long		recovered;
+		/** @brief 書き出した回数 */
+		unsigned long		syncs;
+		/** @brief 保持しているセグメントの数 */
+		unsigned int		segments;
+	} JournalStat_t;
+	/**
+	 * @brief	Journal
+	 * @note	データをディレクトリ内のメモリマップしたセグメントファイルへ
+	 * 			追記し、完了時にレコードへ完了を記録します。
+	 * 			セグメントが満杯になると次のファイルへ切り替え、全てのレコードが
+	 * 			完了したセグメントは削除します。
+	 * 			書き出し(fdatasync)は専用のスレッドにてまとめて行い、
+	 * 			JOURNAL_SYNC_COMMITの場合も同時に待機しているappendは一度の
+	 * 			書き出しで完了します(グループコミット)。
+	 * 			openした時点で未完了のレコードはtakeReplayにて取得し、
+	 * 			再実行します。完了の記録も書き出し間隔毎に書き出される為、
+	 * 			異常終了時には完了済みのレコードが再実行される場合があります。
+	 * 			ThreadCall::setJournalにて指定して使用します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class Journal
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief セグメントファイルを配置するディレクトリ */
+			std::string				directory;
+			/** @brief ディレクトリのファイルディスクリプタ */
+			int						dirfd;
+			/** @brief セグメントのサイズ */
+			size_t					segmentSize;
+			/** @brief 書き出し方式 */
+			JournalSync_t			syncMode;
+			/** @brief 書き出し間隔(ナノ秒) */
+			long long				interval;
+			/** @brief セグメント(番号をMAX_JOURNAL_SEGMENTで割った余りの位置) */
+			JournalSegment_t *		segments[MAX_JOURNAL_SEGMENT];
+			/** @brief 保持している最も古いセグメントの番号 */
+			uint32_t				firstIndex;
+			/** @brief 次に作成するセグメントの番号 */
+			uint32_t				nextIndex;
+			/** @brief 追加中のセグメント */
+			JournalSegment_t *		current;
+			/** @brief 次のレコードの通番 */
+			uint64_t				seq;
+			/** @brief open時に未完了だったデータ */
+			std::vector<void *>		replay;
+			/** @brief 取得されていない未完了のレコードの数 */
+			std::atomic<size_t>		replayCount;
+			/** @brief 書き出しスレッド */
+			JournalFlusher *		flusher;
+			/** @brief 終了中か */
+			std::atomic<bool>		closing;
+			/** @brief 追加・セグメント保護用ミューテックス */
+			Mutex					mutex;
+			/** @brief 書き出し要求の通番(書き出しスレッドの起床用futex) */
+			alignas(TH_CACHE_LINE)
+			std::atomic<int>		requestSeq;
+			/** @brief 書き出しスレッドが待機中か */
+			std::atomic<int>		flusherWaiting;
+			/** @brief 書き出し済みの要求の通番(appendの待機用futex) */
+			alignas(TH_CACHE_LINE)
+			std::atomic<int>		completedSeq;
+			/** @brief 書き出しを待機しているappendの数 */
+			std::atomic<int>		syncWaiters;
+			/** @brief 追加した総数 */
+			std::atomic<unsigned long>	appended;
+			/** @brief 完了した総数 */
+			std::atomic<unsigned long>	completed;
+			/** @brief open時に未完了だった数 */
+			unsigned long			recovered;
+			/** @brief 書き出した回数 */
+			std::atomic<unsigned long>	syncs;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			JournalSegment_t *	createSegment(uint32_t index);
+			JournalSegment_t *	loadSegment(uint32_t index);
+			void				releaseSegment(JournalSegment_t * segment , bool remove);
+			void				getSegmentPath(uint32_t index , char * path , size_t len);
+			void				flush();
+			void				retire();
+			void				requestSync(bool wait);
+			bool				run();
+			friend class JournalFlusher;
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			Journal(void);
+			virtual ~Journal(void);
+			static void *	operator new(size_t size);
+			static void	operator delete(void * ptr);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			bool	open(
+						const char *	path
+					,	JournalSync_t	mode = JOURNAL_SYNC_INTERVAL
+					,	long			flushInterval = JOURNAL_FLUSH_INTERVAL
+					,	size_t			size = JOURNAL_SEGMENT_SIZE
+						);
+			void	close();
+			void *	append(const void * data , size_t len);
+			void	complete(void * payload);
+			void	sync();
+			size_t	takeReplay(void ** items , size_t num);
+			void	restoreReplay(void ** items , size_t num);
+			size_t	getReplayCount();
+			void	getStat(JournalStat_t * stat);
+			static size_t	getPayloadSize(const void * payload);
+	};
+	/**
+	 * @brief	JournalFlusher
+	 * @note	Journalの書き出しを行うThreadCallです。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class JournalFlusher : public ThreadCall
+	{
+		private:
+			/** @brief 書き出すジャーナル */
+			Journal *	journal;
+		public:
+			JournalFlusher(Journal * owner);
+			virtual ~JournalFlusher(void);
+			virtual bool	onFunction();
+			using ThreadCall::onFunction;
+	};
+}
+#endif /*VSTDJOURNAL_HPP_*/
@@ -0,0 +1,624 @@
+/* ***************************************************************************
+ * @file		VSTDLockProfiler.cpp
+ * @brief		ロック競合の計測用 Class
+ * @see		VSTDMutex.hpp / VSTDCond.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 終了したスレッドの記録領域を集計へ加算して再利用
+ * ***************************************************************************/
+#include "VSTDLockProfiler.hpp"
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <errno.h>
+#include <dlfcn.h>
+#include <cxxabi.h>
+#include <map>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace VSTD
+{
+	std::atomic<bool>					LockProfiler::enabled(false);
+	std::atomic<LockProfileTable_t *>	LockProfiler::tables(NULL);
+	/** @brief 呼び出し元スレッドの記録領域 */
+	static thread_local LockProfileTable_t * localTable = NULL;
+	/** @brief 呼び出し元スレッドの記録領域を返却済みか(終了処理中) */
+	static thread_local bool localExited = false;
+	/**
+	 * @brief		レポート用の集計結果
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		const void *		lock;
+		const void *		site;
+		unsigned long		acquisitions;
+		unsigned long		contended;
+		unsigned long		waitTotal;
+		unsigned long		waitMax;
+		unsigned long		holdTotal;
+		unsigned long		holdMax;
+		unsigned long		hold[LOCKPROF_HIST];
+	} LockProfileSum_t;
+	/** @brief ロックと呼び出し元の組毎の集計結果 */
+	typedef std::map<std::pair<const void * , const void *> , LockProfileSum_t>	LockProfileSums_t;
+	/** @brief 終了したスレッドの集計・再利用待ちの記録領域の保護用ミューテックス */
+	static pthread_mutex_t		retiredLock = PTHREAD_MUTEX_INITIALIZER;
+	/** @brief 終了したスレッドの集計(終了処理の順序に依存しない様に解放しない) */
+	static LockProfileSums_t *	retired = NULL;
+	/** @brief 終了したスレッドの記録領域の不足により破棄した回数 */
+	static unsigned long		retiredDropped = 0;
+	/** @brief 再利用待ちの記録領域 */
+	static LockProfileTable_t *	freeTables = NULL;
+	/** @brief 作成した記録領域の数 */
+	static std::atomic<unsigned long>	tableCount(0);
+	/**
+	 * @brief		スレッド終了時の記録領域の返却
+	 * @note		記録領域を作成したスレッドのみ、初回の作成時に登録されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	struct LockProfileLocal
+	{
+		/** @brief 登録済みか */
+		bool	armed;
+		~LockProfileLocal()
+		{
+			LockProfileTable_t * table = localTable;
+			localTable	= NULL;
+			localExited	= true;
+			if (table) LockProfiler::retire(table);
+		}
+	};
+	/** @brief 呼び出し元スレッドの終了時の返却処理 */
+	static thread_local LockProfileLocal localRetire;
+	/**
+	 * @brief		現在時刻(CLOCK_MONOTONIC)の取得
+	 * @return	現在時刻をナノ秒にて返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static long long getNow()
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC , &now);
+		return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+	}
+	/**
+	 * @brief		記録領域の所有スレッドによる加算
+	 * @param[in]	value：加算する領域
+	 * @param[in]	add：加算する値
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static inline void addValue(std::atomic<unsigned long> & value , unsigned long add)
+	{
+		value.store(value.load(std::memory_order_relaxed) + add , std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		記録領域の所有スレッドによる最大値の更新
+	 * @param[in]	value：更新する領域
+	 * @param[in]	sample：計測値
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static inline void maxValue(std::atomic<unsigned long> & value , unsigned long sample)
+	{
+		if (sample > value.load(std::memory_order_relaxed))
+		{
+			value.store(sample , std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		計測値の集計への加算
+	 * @param[out]	sum：集計結果
+	 * @param[in]	entry：計測結果
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void addSum(LockProfileSum_t & sum , LockProfileEntry_t & entry)
+	{
+		sum.acquisitions	+= entry.acquisitions.load(std::memory_order_relaxed);
+		sum.contended		+= entry.contended.load(std::memory_order_relaxed);
+		sum.waitTotal		+= entry.waitTotal.load(std::memory_order_relaxed);
+		sum.waitMax		= std::max(sum.waitMax , entry.waitMax.load(std::memory_order_relaxed));
+		sum.holdTotal		+= entry.holdTotal.load(std::memory_order_relaxed);
+		sum.holdMax		= std::max(sum.holdMax , entry.holdMax.load(std::memory_order_relaxed));
+		for (int i = 0 ; i < LOCKPROF_HIST ; i++)
+		{
+			sum.hold[i] += entry.hold[i].load(std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		集計結果の加算
+	 * @param[out]	sum：加算先の集計結果
+	 * @param[in]	add：加算する集計結果
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void mergeSum(LockProfileSum_t & sum , const LockProfileSum_t & add)
+	{
+		sum.acquisitions	+= add.acquisitions;
+		sum.contended		+= add.contended;
+		sum.waitTotal		+= add.waitTotal;
+		sum.waitMax		= std::max(sum.waitMax , add.waitMax);
+		sum.holdTotal		+= add.holdTotal;
+		sum.holdMax		= std::max(sum.holdMax , add.holdMax);
+		for (int i = 0 ; i < LOCKPROF_HIST ; i++)
+		{
+			sum.hold[i] += add.hold[i];
+		}
+	}
+	/**
+	 * @brief		ロックと呼び出し元の組への集計結果の加算
+	 * @param[out]	sums：集計先
+	 * @param[in]	lock：ロックのアドレス
+	 * @param[in]	site：呼び出し元のアドレス
+	 * @param[in]	add：加算する集計結果
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void addKey(LockProfileSums_t & sums , const void * lock , const void * site , const LockProfileSum_t & add)
+	{
+		LockProfileSums_t::key_type key(lock , site);
+		LockProfileSums_t::iterator it = sums.find(key);
+		if (it == sums.end())
+		{
+			LockProfileSum_t sum = LockProfileSum_t();
+			sum.lock = lock;
+			sum.site = site;
+			it = sums.insert(std::make_pair(key , sum)).first;
+		}
+		mergeSum(it->second , add);
+	}
+	/**
+	 * @brief		計測結果の初期化
+	 * @param[out]	entry：初期化する計測結果
+	 * @param[in]	release：ロックと呼び出し元の組も解除するか
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void clearEntry(LockProfileEntry_t & entry , bool release)
+	{
+		entry.acquisitions.store(0 , std::memory_order_relaxed);
+		entry.contended.store(0 , std::memory_order_relaxed);
+		entry.waitTotal.store(0 , std::memory_order_relaxed);
+		entry.waitMax.store(0 , std::memory_order_relaxed);
+		entry.holdTotal.store(0 , std::memory_order_relaxed);
+		entry.holdMax.store(0 , std::memory_order_relaxed);
+		for (int j = 0 ; j < LOCKPROF_HIST ; j++)
+		{
+			entry.hold[j].store(0 , std::memory_order_relaxed);
+		}
+		if (release)
+		{
+			entry.lock.store(NULL , std::memory_order_relaxed);
+			entry.site.store(NULL , std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		保持時間の百分位の算出
+	 * @param[in]	sum：集計結果
+	 * @param[in]	percent：百分位
+	 * @return	該当する区分の上限(ns)を返却します。記録が無い場合は0
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static unsigned long getPercentile(const LockProfileSum_t & sum , unsigned int percent)
+	{
+		unsigned long total = 0;
+		unsigned long count = 0;
+		for (int i = 0 ; i < LOCKPROF_HIST ; i++)
+		{
+			total += sum.hold[i];
+		}
+		if (total == 0) return 0;
+		for (int i = 0 ; i < LOCKPROF_HIST ; i++)
+		{
+			count += sum.hold[i];
+			if (count * 100 >= total * percent)
+			{
+				return 1UL << (i + 1);
+			}
+		}
+		return sum.holdMax;
+	}
+	/**
+	 * @brief		呼び出し元の名前の出力
+	 * @note		関数名を解決出来ない場合はアドレスを出力します。
+	 * @param[in]	fp：出力先
+	 * @param[in]	site：呼び出し元のアドレス
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void printSite(FILE * fp , const void * site)
+	{
+		Dl_info info;
+		if (dladdr(site , &info) && info.dli_sname)
+		{
+			int status = 0;
+			char * name = abi::__cxa_demangle(info.dli_sname , NULL , NULL , &status);
+			fprintf(fp , "%s+0x%lx" , status == 0 && name ? name : info.dli_sname
+				, (unsigned long)((uintptr_t)site - (uintptr_t)info.dli_saddr));
+			free(name);
+			return;
+		}
+		fprintf(fp , "%p" , site);
+	}
+	/**
+	 * @brief		待機時間の合計による比較
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static bool compareWait(const LockProfileSum_t & a , const LockProfileSum_t & b)
+	{
+		if (a.waitTotal != b.waitTotal) return a.waitTotal > b.waitTotal;
+		return a.acquisitions > b.acquisitions;
+	}
+	/**
+	 * @brief		集計結果の出力
+	 * @param[in]	fp：出力先
+	 * @param[in]	list：集計結果
+	 * @param[in]	limit：出力する最大行数。0の場合は全て
+	 * @param[in]	perLock：ロックのアドレスを出力するか
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void printSums(FILE * fp , std::vector<LockProfileSum_t> & list , unsigned int limit , bool perLock)
+	{
+		std::sort(list.begin() , list.end() , compareWait);
+		fprintf(fp , "%s%12s %10s %14s %12s %10s %10s %10s %12s  %s\n"
+			, perLock ? "lock               " : ""
+			, "acquire" , "contended" , "wait(ns)" , "wait max" , "hold avg" , "hold p50" , "hold p99" , "hold max" , "site");
+		for (size_t i = 0 ; i < list.size() && (limit == 0 || i < limit) ; i++)
+		{
+			const LockProfileSum_t & sum = list[i];
+			unsigned long samples = 0;
+			for (int j = 0 ; j < LOCKPROF_HIST ; j++)
+			{
+				samples += sum.hold[j];
+			}
+			if (perLock)
+			{
+				fprintf(fp , "%-18p " , sum.lock);
+			}
+			fprintf(fp , "%12lu %10lu %14lu %12lu %10lu %10lu %10lu %12lu  "
+				, sum.acquisitions , sum.contended , sum.waitTotal , sum.waitMax
+				, samples ? sum.holdTotal / samples : 0
+				, getPercentile(sum , 50) , getPercentile(sum , 99) , sum.holdMax);
+			printSite(fp , sum.site);
+			fprintf(fp , "\n");
+		}
+	}
+	/**
+	 * @brief		終了時のレポート出力
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void reportAtExit()
+	{
+		LockProfiler::report(stderr);
+	}
+	/**
+	 * @brief		環境変数による計測の開始
+	 * @note		VSTD_LOCK_PROFILEが設定されている場合は計測を開始し、
+	 * 				終了時にレポートを出力します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static struct LockProfilerStartup
+	{
+		LockProfilerStartup()
+		{
+			if (getenv("VSTD_LOCK_PROFILE"))
+			{
+				LockProfiler::enable(true);
+				atexit(reportAtExit);
+			}
+		}
+	} lockProfilerStartup;
+	/**
+	 * @brief		enable
+	 * 				計測の開始・停止
+	 * @param[in]	on：trueの場合は開始
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void LockProfiler::enable(bool on)
+	{
+		enabled.store(on , std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		isEnabled
+	 * 				計測中かの取得
+	 * @return	計測中の場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool LockProfiler::isEnabled()
+	{
+		return enabled.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		getTable
+	 * 				呼び出し元スレッドの記録領域の取得
+	 * @note		初回の呼び出し時に終了したスレッドの記録領域を再利用し、
+	 * 				無い場合は作成して全スレッドの一覧へ登録します。
+	 * @return	記録領域を返却します。スレッドの終了処理中の場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	LockProfileTable_t * LockProfiler::getTable()
+	{
+		LockProfileTable_t * table = localTable;
+		if (table || localExited) return table;
+		pthread_mutex_lock(&retiredLock);
+		table = freeTables;
+		if (table) freeTables = table->nextFree;
+		pthread_mutex_unlock(&retiredLock);
+		if (!table)
+		{
+			table = new LockProfileTable_t();
+			table->next = tables.load(std::memory_order_relaxed);
+			while (!tables.compare_exchange_weak(table->next , table , std::memory_order_release , std::memory_order_relaxed))
+			{
+			}
+			tableCount.fetch_add(1 , std::memory_order_relaxed);
+		}
+		/* スレッドの終了時に返却する */
+		localRetire.armed = true;
+		localTable = table;
+		return table;
+	}
+	/**
+	 * @brief		retire
+	 * 				終了したスレッドの記録領域の返却
+	 * @note		計測結果を終了したスレッドの集計へ加算して初期化し、
+	 * 				再利用待ちとします。
+	 * @param[in]	table：終了したスレッドの記録領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void LockProfiler::retire(LockProfileTable_t * table)
+	{
+		pthread_mutex_lock(&retiredLock);
+		if (!retired)
+		{
+			retired = new LockProfileSums_t();
+		}
+		retiredDropped += table->dropped.load(std::memory_order_relaxed);
+		table->dropped.store(0 , std::memory_order_relaxed);
+		for (unsigned int i = 0 ; i < MAX_LOCKPROF_ENTRY ; i++)
+		{
+			LockProfileEntry_t & entry = table->entries[i];
+			const void * site = entry.site.load(std::memory_order_relaxed);
+			if (!site) continue;
+			LockProfileSum_t sum = LockProfileSum_t();
+			addSum(sum , entry);
+			addKey(*retired , entry.lock.load(std::memory_order_relaxed) , site , sum);
+			clearEntry(entry , true);
+		}
+		table->nextFree	= freeTables;
+		freeTables		= table;
+		pthread_mutex_unlock(&retiredLock);
+	}
+	/**
+	 * @brief		getTableCount
+	 * 				記録領域の数の取得
+	 * @note		終了したスレッドの記録領域は再利用される為、
+	 * 				同時に計測したスレッドの最大数を超えません。
+	 * @return	作成した記録領域の数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned long LockProfiler::getTableCount()
+	{
+		return tableCount.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		find
+	 * 				記録先の検索
+	 * @note		開番地法にて検索し、存在しない場合は登録します。
+	 * 				記録領域が不足した場合は呼び出し元のみの組に記録します。
+	 * @param[in]	table：呼び出し元スレッドの記録領域
+	 * @param[in]	lock：ロックのアドレス
+	 * @param[in]	site：呼び出し元のアドレス
+	 * @return	記録先を返却します。登録出来ない場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	LockProfileEntry_t * LockProfiler::find(LockProfileTable_t * table , const void * lock , const void * site)
+	{
+		for (int retry = 0 ; retry < 2 ; retry++)
+		{
+			uintptr_t hash = ((uintptr_t)lock >> 4) ^ ((uintptr_t)site * 0x9E3779B97F4A7C15ULL);
+			hash ^= hash >> 29;
+			for (unsigned int i = 0 ; i < MAX_LOCKPROF_ENTRY ; i++)
+			{
+				LockProfileEntry_t * entry = &table->entries[(hash + i) & (MAX_LOCKPROF_ENTRY - 1)];
+				const void * current = entry->site.load(std::memory_order_relaxed);
+				if (!current)
+				{
+					entry->lock.store(lock , std::memory_order_relaxed);
+					entry->site.store(site , std::memory_order_release);
+					return entry;
+				}
+				if (current == site && entry->lock.load(std::memory_order_relaxed) == lock)
+				{
+					return entry;
+				}
+			}
+			/* 記録領域が不足した場合は呼び出し元毎にまとめる */
+			lock = NULL;
+		}
+		addValue(table->dropped , 1);
+		return NULL;
+	}
+	/**
+	 * @brief		lock
+	 * 				計測付きのロック
+	 * @note		計測中でない場合はpthread_mutex_lockのみを呼び出します。
+	 * 				trylockに失敗した場合のみ競合として待機時間を計測します。
+	 * @param[in]	mutex：ロックするミューテックス
+	 * @param[in]	lock：ロックのアドレス(Mutex/Condition)
+	 * @param[in]	site：呼び出し元のアドレス
+	 * @param[out]	hold：保持時間の計測情報を格納します。
+	 * @return	pthread_mutex_lockの結果を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	int LockProfiler::lock(pthread_mutex_t * mutex , const void * lock , const void * site , LockProfileHold_t * hold)
+	{
+		int			result;
+		long long	start;
+		long long	wait = -1;
+		hold->entry = NULL;
+		if (!enabled.load(std::memory_order_relaxed))
+		{
+			return pthread_mutex_lock(mutex);
+		}
+		result = pthread_mutex_trylock(mutex);
+		if (result == EBUSY)
+		{
+			long long begin = getNow();
+			result	= pthread_mutex_lock(mutex);
+			start		= getNow();
+			wait		= start - begin;
+		}
+		else
+		{
+			start = getNow();
+		}
+		if (result != 0)
+		{
+			return result;
+		}
+		LockProfileTable_t * table = getTable();
+		LockProfileEntry_t * entry = table ? find(table , lock , site) : NULL;
+		if (entry)
+		{
+			addValue(entry->acquisitions , 1);
+			if (wait >= 0)
+			{
+				addValue(entry->contended , 1);
+				addValue(entry->waitTotal , (unsigned long)wait);
+				maxValue(entry->waitMax , (unsigned long)wait);
+			}
+			hold->entry	= entry;
+			hold->start	= start;
+		}
+		return 0;
+	}
+	/**
+	 * @brief		unlock
+	 * 				保持時間の記録
+	 * @note		ミューテックスのアンロック前に呼び出します。
+	 * @param[in]	hold：lockにて格納した計測情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void LockProfiler::unlock(LockProfileHold_t * hold)
+	{
+		LockProfileEntry_t * entry = hold->entry;
+		if (!entry) return;
+		hold->entry = NULL;
+		unsigned long held = (unsigned long)(getNow() - hold->start);
+		int bucket = held ? 63 - __builtin_clzll(held) : 0;
+		if (bucket >= LOCKPROF_HIST) bucket = LOCKPROF_HIST - 1;
+		addValue(entry->holdTotal , held);
+		maxValue(entry->holdMax , held);
+		addValue(entry->hold[bucket] , 1);
+	}
+	/**
+	 * @brief		report
+	 * 				レポートの出力
+	 * @note		全スレッド及び終了したスレッドの記録をロックと呼び出し元の組毎、
+	 * 				及び呼び出し元毎に集計し、待機時間の合計の降順に出力します。
+	 * @param[in]	fp：出力先
+	 * @param[in]	limit：各集計の最大行数。0の場合は全て
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void LockProfiler::report(FILE * fp , unsigned int limit)
+	{
+		LockProfileSums_t	byLock;
+		LockProfileSums_t	bySite;
+		unsigned long		dropped = 0;
+		/* 記録領域の返却と重複・欠落しない様に保護 */
+		pthread_mutex_lock(&retiredLock);
+		for (LockProfileTable_t * table = tables.load(std::memory_order_acquire) ; table ; table = table->next)
+		{
+			dropped += table->dropped.load(std::memory_order_relaxed);
+			for (unsigned int i = 0 ; i < MAX_LOCKPROF_ENTRY ; i++)
+			{
+				LockProfileEntry_t & entry = table->entries[i];
+				const void * site = entry.site.load(std::memory_order_acquire);
+				if (!site) continue;
+				LockProfileSum_t sum = LockProfileSum_t();
+				addSum(sum , entry);
+				addKey(byLock , entry.lock.load(std::memory_order_relaxed) , site , sum);
+			}
+		}
+		if (retired)
+		{
+			for (LockProfileSums_t::iterator it = retired->begin() ; it != retired->end() ; ++it)
+			{
+				addKey(byLock , it->first.first , it->first.second , it->second);
+			}
+		}
+		dropped += retiredDropped;
+		pthread_mutex_unlock(&retiredLock);
+		std::vector<LockProfileSum_t> list;
+		fprintf(fp , "[LockProfiler] ロック・呼び出し元毎 (待機時間の合計順)\n");
+		for (LockProfileSums_t::iterator it = byLock.begin() ; it != byLock.end() ; ++it)
+		{
+			list.push_back(it->second);
+			addKey(bySite , NULL , it->second.site , it->second);
+		}
+		printSums(fp , list , limit , true);
+		list.clear();
+		fprintf(fp , "[LockProfiler] 呼び出し元毎 (待機時間の合計順)\n");
+		for (LockProfileSums_t::iterator it = bySite.begin() ; it != bySite.end() ; ++it)
+		{
+			list.push_back(it->second);
+		}
+		printSums(fp , list , limit , false);
+		if (dropped)
+		{
+			fprintf(fp , "[LockProfiler] 記録領域の不足により%lu回の取得を破棄しました。\n" , dropped);
+		}
+		fflush(fp);
+	}
+	/**
+	 * @brief		reset
+	 * 				計測結果の初期化
+	 * @note		計測中に呼び出した場合、同時に記録された値は失われる場合があります。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void LockProfiler::reset()
+	{
+		pthread_mutex_lock(&retiredLock);
+		for (LockProfileTable_t * table = tables.load(std::memory_order_acquire) ; table ; table = table->next)
+		{
+			table->dropped.store(0 , std::memory_order_relaxed);
+			for (unsigned int i = 0 ; i < MAX_LOCKPROF_ENTRY ; i++)
+			{
+				clearEntry(table->entries[i] , false);
+			}
+		}
+		if (retired)
+		{
+			retired->clear();
+		}
+		retiredDropped = 0;
+		pthread_mutex_unlock(&retiredLock);
+	}
+}
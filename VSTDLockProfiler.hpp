@@ -0,0 +1,124 @@
+/* ***************************************************************************
+ * @file		VSTDLockProfiler.hpp
+ * @brief		ロック競合の計測用 Class
+ * @see		VSTDMutex.hpp / VSTDCond.hpp
+ * @note		VSTD_LOCK_PROFILEを定義してビルドした場合のみ、Mutex/Condition
+ * 				から計測処理が呼び出されます。全ての翻訳単位で同じ定義として
+ * 				ください。計測はenableにて開始するか、環境変数VSTD_LOCK_PROFILEを
+ * 				設定して起動した場合に開始し、後者は終了時に標準エラーへ
+ * 				レポートを出力します。呼び出し元の関数名の解決にはdladdrを
+ * 				使用する為、実行ファイルは-rdynamicを指定してリンクしてください。
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 終了したスレッドの記録領域を集計へ加算して再利用
+ * ***************************************************************************/
+#ifndef VSTDLOCKPROFILER_HPP_
+#define VSTDLOCKPROFILER_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <atomic>
+
+namespace VSTD
+{
+	/** @brief 保持時間の分布の区分数(2のべき乗ナノ秒毎) */
+	#define LOCKPROF_HIST 32
+	/** @brief スレッド毎に記録するロックと呼び出し元の組の最大数(2のべき乗) */
+	#define MAX_LOCKPROF_ENTRY 256
+	/**
+	 * @brief		ロックと呼び出し元の組毎の計測結果
+	 * @note		記録は各スレッドの領域に対してのみ行う為、
+	 * 				加算はロックを使用しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief ロックのアドレス。記録領域が不足した場合はNULL */
+		std::atomic<const void *>		lock;
+		/** @brief 呼び出し元のアドレス。未使用の場合はNULL */
+		std::atomic<const void *>		site;
+		/** @brief 取得回数 */
+		std::atomic<unsigned long>		acquisitions;
+		/** @brief 競合した回数 */
+		std::atomic<unsigned long>		contended;
+		/** @brief 待機時間の合計(ns) */
+		std::atomic<unsigned long>		waitTotal;
+		/** @brief 待機時間の最大(ns) */
+		std::atomic<unsigned long>		waitMax;
+		/** @brief 保持時間の合計(ns) */
+		std::atomic<unsigned long>		holdTotal;
+		/** @brief 保持時間の最大(ns) */
+		std::atomic<unsigned long>		holdMax;
+		/** @brief 保持時間の分布。[i]は2^i以上2^(i+1)未満(ns) */
+		std::atomic<unsigned long>		hold[LOCKPROF_HIST];
+	} LockProfileEntry_t;
+	/**
+	 * @brief		スレッド毎の記録領域
+	 * @note		スレッドの終了時に計測結果を終了したスレッドの集計へ加算して
+	 * 				初期化し、次に計測を開始したスレッドが再利用します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct LockProfileTable
+	{
+		/** @brief 計測結果 */
+		LockProfileEntry_t			entries[MAX_LOCKPROF_ENTRY];
+		/** @brief 記録領域の不足により破棄した回数 */
+		std::atomic<unsigned long>	dropped;
+		/** @brief 次のスレッドの記録領域 */
+		struct LockProfileTable *	next;
+		/** @brief 再利用待ちの次の記録領域 */
+		struct LockProfileTable *	nextFree;
+	} LockProfileTable_t;
+	/**
+	 * @brief		ロック保持中の計測情報
+	 * @note		ロックを保持しているスレッドのみが参照します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 記録先。計測していない場合はNULL */
+		LockProfileEntry_t *	entry;
+		/** @brief 取得した時刻(ns) */
+		long long				start;
+	} LockProfileHold_t;
+	/**
+	 * @brief	LockProfiler
+	 * @note	ロック毎・呼び出し元毎に取得回数、競合回数、待機時間、
+	 * 			保持時間の分布を記録し、待機時間の合計順にレポートします。
+	 * 			最初にtrylockを試み、失敗した場合のみ待機時間を計測する為、
+	 * 			競合しない場合の負荷は時刻の取得と記録のみです。
+	 * 			Condition::waitは保持時間に待機を含む為、取得のみを記録します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class LockProfiler
+	{
+		private:
+			/** @brief 計測中か */
+			static std::atomic<bool>					enabled;
+			/** @brief 全スレッドの記録領域 */
+			static std::atomic<LockProfileTable_t *>	tables;
+			static LockProfileTable_t *	getTable();
+			static LockProfileEntry_t *	find(LockProfileTable_t * table , const void * lock , const void * site);
+			static void					retire(LockProfileTable_t * table);
+			friend struct				LockProfileLocal;
+		public:
+			static void		enable(bool on);
+			static bool		isEnabled();
+			static int		lock(pthread_mutex_t * mutex , const void * lock , const void * site , LockProfileHold_t * hold);
+			static void		unlock(LockProfileHold_t * hold);
+			static void		report(FILE * fp = stderr , unsigned int limit = 0);
+			static void		reset();
+			static unsigned long	getTableCount();
+	};
+}
+#endif /*VSTDLOCKPROFILER_HPP_*/
@@ -7,6 +7,8 @@
  * 
  * @par 更新履歴：
  * - 2009/07/16	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 初回使用時に作成するLazyMutexを追加
+ * - 2026/10/19	Sebastian ロック競合の計測(VSTD_LOCK_PROFILE)を追加
  * ***************************************************************************/
 #include "VSTDMutex.hpp"
 namespace VSTD
@@ -42,7 +44,23 @@ namespace VSTD
 	 * @author		Sebastian
 	 * @date		2009/7/16
 	 */
+#ifdef VSTD_LOCK_PROFILE
 	void Mutex::lock()
+	{
+		lock(__builtin_return_address(0));
+	}
+	/**
+	 * @brief		lock
+	 * 				呼び出し元を指定したミューテックスのロック
+	 * @note		LockProfilerに呼び出し元を記録します。
+	 * @param[in]	site：呼び出し元のアドレス
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Mutex::lock(const void * site)
+#else
+	void Mutex::lock()
+#endif
 	{
 		int result;
 		/* *******************************************************************
@@ -58,7 +76,11 @@ namespace VSTD
 		try
 		{
 			/* ミューテックスをロック */
+#ifdef VSTD_LOCK_PROFILE
+			result = LockProfiler::lock(&mutex_id , this , site , &profile);
+#else
 			result = pthread_mutex_lock(&mutex_id);
+#endif
 			switch(result)
 			{
 			case EINVAL:
@@ -100,6 +122,9 @@ namespace VSTD
 				throw "unlock:スレッドはミューテックスを所有していません。";
 			}
 			memset(&owner_id,0,sizeof(pthread_t));
+#ifdef VSTD_LOCK_PROFILE
+			LockProfiler::unlock(&profile);
+#endif
 			result = pthread_mutex_unlock(&mutex_id);
 			switch(result)
 			{
@@ -117,4 +142,70 @@ namespace VSTD
 			throw descript;
 		}
 	}
+	/**
+	 * @brief		LazyMutexのデストラクタ
+	 * @note		作成済みの場合はミューテックスを破棄します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	LazyMutex::~LazyMutex(void)
+	{
+		delete impl.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		get
+	 * 				ミューテックスの取得
+	 * @note		未作成の場合は作成します。同時に作成された場合は
+	 * 				先に登録された方を使用し、後から作成された方は破棄します。
+	 * @return	ミューテックスを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Mutex * LazyMutex::get()
+	{
+		Mutex * current = impl.load(std::memory_order_acquire);
+		if (current) return current;
+		Mutex * created = new Mutex();
+		if (!impl.compare_exchange_strong(current , created , std::memory_order_acq_rel))
+		{
+			delete created;
+			return current;
+		}
+		return created;
+	}
+	/**
+	 * @brief		lock
+	 * 				ミューテックスのロック
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void LazyMutex::lock()
+	{
+#ifdef VSTD_LOCK_PROFILE
+		get()->lock(__builtin_return_address(0));
+#else
+		get()->lock();
+#endif
+	}
+	/**
+	 * @brief		unlock
+	 * 				ミューテックスのアンロック
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void LazyMutex::unlock()
+	{
+		get()->unlock();
+	}
+	/**
+	 * @brief		isCreated
+	 * 				ミューテックスが作成済みかの取得
+	 * @return	一度でもlockされている場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool LazyMutex::isCreated()
+	{
+		return impl.load(std::memory_order_acquire) != NULL;
+	}
 }
@@ -6,6 +6,8 @@
  * @version	1.0
  * @par 更新履歴：
  * - 2009/07/16	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 初回使用時に作成するLazyMutexを追加
+ * - 2026/10/19	Sebastian ロック競合の計測(VSTD_LOCK_PROFILE)を追加
  * ***************************************************************************/
 #ifndef VSTDMUTEX_HPP_
 #define VSTDMUTEX_HPP_
@@ -17,6 +19,10 @@
 #include <memory.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <atomic>
+#ifdef VSTD_LOCK_PROFILE
+#include "VSTDLockProfiler.hpp"
+#endif
 namespace VSTD
 {
 	/**
@@ -37,6 +43,10 @@ namespace VSTD
 			pthread_mutex_t		mutex_id;
 			/** @brief 現在、ミューテックスを取得中のスレッドIDを保持します */
 			pthread_t				owner_id;
+#ifdef VSTD_LOCK_PROFILE
+			/** @brief 保持時間の計測情報 */
+			LockProfileHold_t		profile;
+#endif
 		public:
 			/* ***************************************************************
 			 * コンストラクタ/デストラクタ
@@ -52,6 +62,34 @@ namespace VSTD
 			 * ***************************************************************/
 			void					lock();
 			void					unlock();
+#ifdef VSTD_LOCK_PROFILE
+			void					lock(const void * site);
+#endif
+	};
+	/**
+	 * @brief		LazyMutex
+	 * 				初回使用時に作成される相互排他管理用 Class
+	 * @note		lockが呼び出されるまでMutexを作成せず、ポインタ1つ分の
+	 * 				領域のみを使用します。使用されない事が多いオブジェクトに
+	 * 				Mutexを埋め込む場合に使用します。
+	 * 				複製した場合、複製先は未作成の状態となります。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class LazyMutex
+	{
+		private:
+			/** @brief 作成済みのミューテックス */
+			std::atomic<Mutex *>	impl;
+			Mutex *					get();
+		public:
+			LazyMutex(void) : impl(NULL) {}
+			LazyMutex(const LazyMutex &) : impl(NULL) {}
+			LazyMutex & operator=(const LazyMutex &) { return *this; }
+			~LazyMutex(void);
+			void					lock();
+			void					unlock();
+			bool					isCreated();
 	};
 }
 #endif
@@ -0,0 +1,670 @@
+/* ***************************************************************************
+ * @file		VSTDPipeline.cpp
+ * @brief		多段パイプライン用 Class
+ * @see		VSTDThreadCall.hpp / VSTDFutex.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "VSTDPipeline.hpp"
+
+namespace VSTD
+{
+	/* ***********************************************************************
+	 *
+	 * PipelineQueue
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		PipelineQueueのコンストラクタ
+	 * @note		createにて容量を指定するまで使用出来ません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PipelineQueue::PipelineQueue(void)
+	{
+		head			= 0;
+		spaceSeq		= 0;
+		spaceWaiting	= 0;
+		tail			= 0;
+		dataSeq		= 0;
+		dataWaiting	= 0;
+		slots			= NULL;
+		capacity		= 0;
+		mask			= 0;
+	}
+	/**
+	 * @brief		PipelineQueueのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PipelineQueue::~PipelineQueue(void)
+	{
+		delete [] slots;
+	}
+	/**
+	 * @brief		operator new[]
+	 * @note		生産者と消費者のキャッシュライン分離を有効にする為、
+	 * 				キャッシュライン境界に確保します。
+	 * @param[in]	size：確保するサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * PipelineQueue::operator new[](size_t size)
+	{
+		void * ptr;
+		if (posix_memalign(&ptr , TH_CACHE_LINE , size) != 0)
+		{
+			throw std::bad_alloc();
+		}
+		return ptr;
+	}
+	/**
+	 * @brief		operator delete[]
+	 * @param[in]	ptr：operator new[]にて確保した領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void PipelineQueue::operator delete[](void * ptr)
+	{
+		free(ptr);
+	}
+	/**
+	 * @brief		create
+	 * 				容量の設定
+	 * @param[in]	depth：容量を指定。2のべき乗に切り上げます。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool PipelineQueue::create(size_t depth)
+	{
+		uint64_t size = 2;
+		while (size < depth)
+		{
+			size <<= 1;
+		}
+		slots = new (std::nothrow) void * [size];
+		if (!slots)
+		{
+			return false;
+		}
+		capacity	= size;
+		mask		= size - 1;
+		return true;
+	}
+	/**
+	 * @brief		put
+	 * 				要素の追加
+	 * @note		生産者のスレッドからのみ呼び出してください。
+	 * 				満杯の場合は消費者が取り出すまで待機します。
+	 * @param[in]	item：追加する要素
+	 * @param[in]	timeout：待機時間をミリ秒にて指定。0の場合は待機せず、負の場合は無期限
+	 * @param[out]	waited：待機した場合はtrue
+	 * @return	成否を返却します。タイムアウトした場合はfalse
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool PipelineQueue::put(void * item , long timeout , bool * waited)
+	{
+		long long limit = timeout > 0 ? GetMonotonicTime() + timeout * 1000000LL : 0;
+		*waited = false;
+		while (true)
+		{
+			uint64_t pos = tail.load(std::memory_order_relaxed);
+			if (pos - head.load(std::memory_order_acquire) < capacity)
+			{
+				slots[pos & mask] = item;
+				tail.store(pos + 1 , std::memory_order_seq_cst);
+				/* 消費者が待機中の場合のみ起床 */
+				if (dataWaiting.load(std::memory_order_seq_cst))
+				{
+					dataSeq.fetch_add(1 , std::memory_order_seq_cst);
+					FutexWake(&dataSeq , 1);
+				}
+				return true;
+			}
+			long long remain = 0;
+			if (timeout == 0)
+			{
+				return false;
+			}
+			if (timeout > 0)
+			{
+				remain = limit - GetMonotonicTime();
+				if (remain <= 0)
+				{
+					return false;
+				}
+			}
+			*waited = true;
+			/* 待機中である事を公開してから再確認 */
+			uint32_t seq = spaceSeq.load(std::memory_order_seq_cst);
+			spaceWaiting.store(1 , std::memory_order_seq_cst);
+			if (pos - head.load(std::memory_order_seq_cst) >= capacity)
+			{
+				FutexWait(&spaceSeq , (int)seq , remain);
+			}
+			spaceWaiting.store(0 , std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		take
+	 * 				要素の取り出し
+	 * @note		消費者のスレッドからのみ呼び出してください。
+	 * 				空の場合は追加されるまで待機し、入力が終了した場合は
+	 * 				残りを取り出した後にfalseを返却します。
+	 * @param[out]	item：取り出した要素を格納します。
+	 * @param[in]	closing：入力の終了
+	 * @param[out]	waited：待機した場合はtrue
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool PipelineQueue::take(void ** item , const std::atomic<bool> * closing , bool * waited)
+	{
+		*waited = false;
+		while (true)
+		{
+			uint64_t pos = head.load(std::memory_order_relaxed);
+			if (pos != tail.load(std::memory_order_acquire))
+			{
+				*item = slots[pos & mask];
+				head.store(pos + 1 , std::memory_order_seq_cst);
+				/* 生産者が待機中の場合のみ起床 */
+				if (spaceWaiting.load(std::memory_order_seq_cst))
+				{
+					spaceSeq.fetch_add(1 , std::memory_order_seq_cst);
+					FutexWake(&spaceSeq , 1);
+				}
+				return true;
+			}
+			if (closing->load(std::memory_order_acquire))
+			{
+				/* 終了の直前に追加された場合を除き終了 */
+				if (pos != tail.load(std::memory_order_acquire)) continue;
+				return false;
+			}
+			*waited = true;
+			uint32_t seq = dataSeq.load(std::memory_order_seq_cst);
+			dataWaiting.store(1 , std::memory_order_seq_cst);
+			if (pos == tail.load(std::memory_order_seq_cst) && !closing->load(std::memory_order_seq_cst))
+			{
+				FutexWait(&dataSeq , (int)seq);
+			}
+			dataWaiting.store(0 , std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		wake
+	 * 				待機中の消費者の起床
+	 * @note		入力の終了を通知する為に使用します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void PipelineQueue::wake()
+	{
+		dataSeq.fetch_add(1 , std::memory_order_seq_cst);
+		FutexWake(&dataSeq);
+	}
+	/**
+	 * @brief		size
+	 * 				現在の要素数の取得
+	 * @return	要素数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	uint64_t PipelineQueue::size()
+	{
+		return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		getCapacity
+	 * 				容量の取得
+	 * @return	容量を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	uint64_t PipelineQueue::getCapacity()
+	{
+		return capacity;
+	}
+	/* ***********************************************************************
+	 *
+	 * PipelineStage
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		PipelineStageのコンストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PipelineStage::PipelineStage(void)
+	{
+		last = false;
+	}
+	/**
+	 * @brief		PipelineStageのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PipelineStage::~PipelineStage(void)
+	{
+	}
+	/**
+	 * @brief		onStage
+	 * 				ラッピング用仮想ファンクション
+	 * @note		既定では要素をThreadFunctionとして実行し、成功した場合は
+	 * 				次の段へ渡します。失敗した場合、最終段の場合は自動解放が
+	 * 				指定されたThreadFunctionを破棄します。
+	 * @param[in]	item：上流から渡された要素
+	 * @return	次の段へ渡す要素を返却します。NULLの場合は破棄
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * PipelineStage::onStage(void * item)
+	{
+		try
+		{
+			ThreadFunction *Func = (ThreadFunction *)item;
+			bool release = Func->isAutoRelease();
+			Func->setStatus(THFUNC_STATE_PROCESSED);
+			bool result = Func->Function();
+			Func->setStatus(THFUNC_STATE_COMLETED);
+			if (!result || last)
+			{
+				if (release)
+				{
+					delete Func;
+				}
+				return NULL;
+			}
+			return item;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * PipelineWorker
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		PipelineWorkerのコンストラクタ
+	 * @param[in]	owner：所属するパイプライン
+	 * @param[in]	index：段の位置
+	 * @param[in]	laneIndex：段内のレーン
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PipelineWorker::PipelineWorker(Pipeline * owner , unsigned int index , unsigned int laneIndex)
+		: ThreadCall() , pipeline(owner) , stage(index) , lane(laneIndex)
+	{
+	}
+	/**
+	 * @brief		PipelineWorkerのデストラクタ
+	 * @note		派生クラスの破棄前にスレッドを停止します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PipelineWorker::~PipelineWorker(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		onFunction
+	 * 				レーンの実行
+	 * @note		入力が終了するまで段を実行します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool PipelineWorker::onFunction()
+	{
+		return pipeline->run(stage , lane);
+	}
+	/* ***********************************************************************
+	 *
+	 * Pipeline
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		Pipelineのコンストラクタ
+	 * @param[in]	queueDepth：段の間の待ち行列の容量
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Pipeline::Pipeline(size_t queueDepth)
+	{
+		memset(stages , 0 , sizeof(stages));
+		stageCount	= 0;
+		depth		= queueDepth > 0 ? queueDepth : PIPELINE_DEFAULT_DEPTH;
+		started		= false;
+		accepting	= false;
+		pushCursor	= 0;
+	}
+	/**
+	 * @brief		Pipelineのデストラクタ
+	 * @note		入力済みの要素を全て処理してから停止します。
+	 * 				登録されたPipelineStageは破棄しません。
+	 * 				破棄中に発生した例外は標準エラー出力へ出力し送出しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Pipeline::~Pipeline(void)
+	{
+		try
+		{
+			close();
+			for (unsigned int i = 0 ; i < stageCount ; i++)
+			{
+				delete [] stages[i]->inputs;
+				delete stages[i];
+			}
+		}
+		catch(...)
+		{
+			/* デストラクタからは送出出来ない為、出力のみ行う */
+			fprintf(stderr , "[Pipeline]:破棄中に例外が発生しました。\n");
+		}
+	}
+	/**
+	 * @brief		addStage
+	 * 				段の追加
+	 * @note		start前に入力側から順番に追加します。
+	 * 				並列数を2以上とした場合、前後の段の並列数は同じか
+	 * 				1である必要があります。
+	 * @param[in]	stage：追加する段
+	 * @param[in]	width：並列数(1～MAX_PIPELINE_WIDTH)
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Pipeline::addStage(PipelineStage * stage , unsigned int width)
+	{
+		try
+		{
+			if (started || !stage || stageCount >= MAX_PIPELINE_STAGE
+			 || width < 1 || width > MAX_PIPELINE_WIDTH)
+			{
+				return false;
+			}
+			unsigned int prev = stageCount > 0 ? stages[stageCount - 1]->width : 1;
+			if (prev != width && prev != 1 && width != 1)
+			{
+				return false;
+			}
+			PipelineStageInfo_t * info = new PipelineStageInfo_t;
+			memset(info->workers , 0 , sizeof(info->workers));
+			info->handler		= stage;
+			info->width		= width;
+			info->inputCount	= prev > width ? prev : width;
+			info->inputs		= new PipelineQueue[info->inputCount];
+			info->closing		= false;
+			info->processed	= 0;
+			info->dropped		= 0;
+			info->busyTime	= 0;
+			info->starved		= 0;
+			info->blocked		= 0;
+			for (unsigned int i = 0 ; i < info->inputCount ; i++)
+			{
+				if (!info->inputs[i].create(depth))
+				{
+					delete [] info->inputs;
+					delete info;
+					return false;
+				}
+			}
+			stages[stageCount++] = info;
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		start
+	 * 				パイプラインの開始
+	 * @note		段毎・レーン毎にPipelineWorkerを作成して実行を開始します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Pipeline::start()
+	{
+		try
+		{
+			if (started || stageCount == 0)
+			{
+				return false;
+			}
+			for (unsigned int i = 0 ; i < stageCount ; i++)
+			{
+				stages[i]->handler->last = (i + 1 == stageCount);
+				for (unsigned int l = 0 ; l < stages[i]->width ; l++)
+				{
+					stages[i]->workers[l] = new PipelineWorker(this , i , l);
+				}
+			}
+			for (unsigned int i = 0 ; i < stageCount ; i++)
+			{
+				for (unsigned int l = 0 ; l < stages[i]->width ; l++)
+				{
+					stages[i]->workers[l]->setFunction();
+				}
+			}
+			started	= true;
+			accepting	= true;
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		push
+	 * 				要素の入力
+	 * @note		最初の段の待ち行列へ追加します。満杯の場合は背圧として
+	 * 				空きが出来るまで待機します。
+	 * 				複数のスレッドから呼び出した場合はミューテックスにて直列化されます。
+	 * @param[in]	item：入力する要素(NULL不可)
+	 * @param[in]	timeout：待機時間をミリ秒にて指定。0の場合は待機せず、負の場合は無期限
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(開始前、終了後、タイムアウト)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Pipeline::push(void * item , long timeout)
+	{
+		bool waited;
+		try
+		{
+			if (!item || !accepting.load(std::memory_order_acquire))
+			{
+				return false;
+			}
+			mutex.lock();
+			if (!accepting.load(std::memory_order_acquire))
+			{
+				mutex.unlock();
+				return false;
+			}
+			PipelineStageInfo_t * first = stages[0];
+			bool result = first->inputs[pushCursor].put(item , timeout , &waited);
+			if (result)
+			{
+				pushCursor = (pushCursor + 1) % first->inputCount;
+			}
+			mutex.unlock();
+			return result;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		close
+	 * 				パイプラインの終了
+	 * @note		入力を締め切り、入力側の段から順番に残りを処理させて
+	 * 				停止します。全ての要素が最終段まで処理されてから返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Pipeline::close()
+	{
+		try
+		{
+			if (!started)
+			{
+				return;
+			}
+			/* 入力中のpushの完了を待機 */
+			accepting.store(false , std::memory_order_release);
+			mutex.lock();
+			mutex.unlock();
+			for (unsigned int i = 0 ; i < stageCount ; i++)
+			{
+				PipelineStageInfo_t * info = stages[i];
+				info->closing.store(true , std::memory_order_seq_cst);
+				for (unsigned int q = 0 ; q < info->inputCount ; q++)
+				{
+					info->inputs[q].wake();
+				}
+				/* 上流の停止後に停止する為、下流の入力は全て揃っている */
+				for (unsigned int l = 0 ; l < info->width ; l++)
+				{
+					delete info->workers[l];
+					info->workers[l] = NULL;
+				}
+			}
+			started = false;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getStageCount
+	 * 				段の数の取得
+	 * @return	段の数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int Pipeline::getStageCount()
+	{
+		return stageCount;
+	}
+	/**
+	 * @brief		getStageStat
+	 * 				段の統計情報の取得
+	 * @note		ミューテックスを取得せずに取得されます。
+	 * @param[in]	index：段の位置
+	 * @param[out]	stat：統計情報を格納します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Pipeline::getStageStat(unsigned int index , PipelineStageStat_t * stat)
+	{
+		if (index >= stageCount || !stat)
+		{
+			return false;
+		}
+		PipelineStageInfo_t * info = stages[index];
+		memset(stat , 0 , sizeof(PipelineStageStat_t));
+		stat->width		= info->width;
+		for (unsigned int q = 0 ; q < info->inputCount ; q++)
+		{
+			stat->occupancy	+= info->inputs[q].size();
+			stat->capacity	+= info->inputs[q].getCapacity();
+		}
+		stat->processed	= info->processed.load(std::memory_order_relaxed);
+		stat->dropped		= info->dropped.load(std::memory_order_relaxed);
+		stat->busyTime	= info->busyTime.load(std::memory_order_relaxed);
+		stat->starved		= info->starved.load(std::memory_order_relaxed);
+		stat->blocked		= info->blocked.load(std::memory_order_relaxed);
+		return true;
+	}
+	/**
+	 * @brief		run
+	 * 				段の1レーンの実行
+	 * @note		PipelineWorkerのスレッド上で呼び出されます。
+	 * 				入力側が複数の待ち行列を持つ場合は順番に取り出し、
+	 * 				出力側が複数の待ち行列を持つ場合は順番に振り分けます。
+	 * 				順序を保存する為、破棄した要素もNULLとして次の段へ渡し、
+	 * 				次の段はNULLを実行せずに渡します。
+	 * @param[in]	index：段の位置
+	 * @param[in]	lane：段内のレーン
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Pipeline::run(unsigned int index , unsigned int lane)
+	{
+		PipelineStageInfo_t *	info		= stages[index];
+		PipelineStageInfo_t *	next		= index + 1 < stageCount ? stages[index + 1] : NULL;
+		unsigned int			inCursor	= lane;
+		unsigned int			outCursor	= lane;
+		void *					item;
+		bool					waited;
+		try
+		{
+			while (info->inputs[inCursor].take(&item , &info->closing , &waited))
+			{
+				if (waited)
+				{
+					info->starved.fetch_add(1 , std::memory_order_relaxed);
+				}
+				if (info->inputCount != info->width)
+				{
+					inCursor = (inCursor + 1) % info->inputCount;
+				}
+				void * out = NULL;
+				if (item)
+				{
+					long long start = GetMonotonicTime();
+					out = info->handler->onStage(item);
+					info->busyTime.fetch_add(GetMonotonicTime() - start , std::memory_order_relaxed);
+					info->processed.fetch_add(1 , std::memory_order_relaxed);
+					if (!out && next)
+					{
+						info->dropped.fetch_add(1 , std::memory_order_relaxed);
+					}
+				}
+				if (!next)
+				{
+					continue;
+				}
+				/* 待ち行列が1つの場合は順序の保存が不要な為、破棄したものは渡さない */
+				if (!out && next->inputCount == 1)
+				{
+					continue;
+				}
+				next->inputs[outCursor].put(out , -1 , &waited);
+				if (waited)
+				{
+					info->blocked.fetch_add(1 , std::memory_order_relaxed);
+				}
+				if (next->inputCount != info->width)
+				{
+					outCursor = (outCursor + 1) % next->inputCount;
+				}
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+}
@@ -0,0 +1,226 @@
+/* ***************************************************************************
+ * @file		VSTDPipeline.hpp
+ * @brief		多段パイプライン用 Class
+ * @see		VSTDThreadCall.hpp / VSTDFutex.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDPIPELINE_HPP_
+#define VSTDPIPELINE_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <stdint.h>
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief パイプラインに登録可能な段の最大数 */
+	#define MAX_PIPELINE_STAGE 32
+	/** @brief 1つの段の並列数の最大 */
+	#define MAX_PIPELINE_WIDTH 64
+	/** @brief 段の間の待ち行列の既定の容量 */
+	#define PIPELINE_DEFAULT_DEPTH 1024
+	class Pipeline;
+	class PipelineWorker;
+	/**
+	 * @brief		段の統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 並列数 */
+		unsigned int		width;
+		/** @brief 入力待ち行列の現在の数 */
+		unsigned long		occupancy;
+		/** @brief 入力待ち行列の容量 */
+		unsigned long		capacity;
+		/** @brief 処理した総数 */
+		unsigned long		processed;
+		/** @brief onStageがNULLを返却し破棄した総数(最終段は常に0) */
+		unsigned long		dropped;
+		/** @brief onStageの実行時間の総計(ナノ秒) */
+		long long			busyTime;
+		/** @brief 入力が無く待機した回数 */
+		unsigned long		starved;
+		/** @brief 下流の待ち行列が満杯で待機した回数(背圧) */
+		unsigned long		blocked;
+	} PipelineStageStat_t;
+	/**
+	 * @brief	PipelineQueue
+	 * @note	段の間を接続する容量固定の単一生産者・単一消費者の待ち行列です。
+	 * 			ロックを使用せず、相手が待機している場合のみfutexにて起床させます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class PipelineQueue
+	{
+		private:
+			/** @brief 取り出し位置(消費者のみ更新) */
+			alignas(TH_CACHE_LINE)
+			std::atomic<uint64_t>	head;
+			/** @brief 空き通知用futex */
+			std::atomic<uint32_t>	spaceSeq;
+			/** @brief 生産者が空きを待機しているか */
+			std::atomic<uint32_t>	spaceWaiting;
+			/** @brief 追加位置(生産者のみ更新) */
+			alignas(TH_CACHE_LINE)
+			std::atomic<uint64_t>	tail;
+			/** @brief 追加通知用futex */
+			std::atomic<uint32_t>	dataSeq;
+			/** @brief 消費者が追加を待機しているか */
+			std::atomic<uint32_t>	dataWaiting;
+			/** @brief 要素 */
+			alignas(TH_CACHE_LINE)
+			void **					slots;
+			/** @brief 容量 */
+			uint64_t				capacity;
+			/** @brief 容量-1 */
+			uint64_t				mask;
+		public:
+			PipelineQueue(void);
+			~PipelineQueue(void);
+			static void *	operator new[](size_t size);
+			static void	operator delete[](void * ptr);
+			bool		create(size_t depth);
+			bool		put(void * item , long timeout , bool * waited);
+			bool		take(void ** item , const std::atomic<bool> * closing , bool * waited);
+			void		wake();
+			uint64_t	size();
+			uint64_t	getCapacity();
+	};
+	/**
+	 * @brief	PipelineStage
+	 * @note	パイプラインの段。継承して仮想メソッド[onStage]をラッピングし、
+	 * 			Pipeline::addStageにて登録します。
+	 * 			onStageの返却値が次の段へ渡され、NULLの場合は破棄されます。
+	 * 			最終段の返却値は使用されません。
+	 * 			並列数を2以上とした場合はonStageが並行して呼び出されます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class PipelineStage
+	{
+		private:
+			/** @brief 最終段か */
+			bool	last;
+			friend class Pipeline;
+		public:
+			PipelineStage(void);
+			virtual ~PipelineStage(void);
+			virtual void *	onStage(void * item);
+	};
+	/**
+	 * @brief	PipelineWorker
+	 * @note	段の1レーンを実行するThreadCallです。
+	 * 			入力を取り出してonStageを呼び出し、結果を次の段へ渡します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class PipelineWorker : public ThreadCall
+	{
+		private:
+			/** @brief 所属するパイプライン */
+			Pipeline *		pipeline;
+			/** @brief 段の位置 */
+			unsigned int	stage;
+			/** @brief 段内のレーン */
+			unsigned int	lane;
+		public:
+			PipelineWorker(Pipeline * owner , unsigned int index , unsigned int laneIndex);
+			virtual ~PipelineWorker(void);
+			virtual bool	onFunction();
+			using ThreadCall::onFunction;
+	};
+	/**
+	 * @brief	Pipeline
+	 * @note	PipelineStageを連結し、段毎にPipelineWorkerにて実行します。
+	 * 			段の間は容量固定の単一生産者・単一消費者の待ち行列にて接続され、
+	 * 			下流が満杯の場合は上流が待機する為、背圧は入力(push)まで
+	 * 			伝搬し、データが破棄される事はありません。
+	 * 			並列数を2以上とした段はレーン毎に待ち行列を持ち、
+	 * 			上流から順番に振り分け、下流は同じ順番で取り出す為、
+	 * 			並列に実行しても順序は保存されます。
+	 * 			隣接する段の並列数は同じか、どちらかが1である必要があります。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class Pipeline
+	{
+		private:
+			/**
+			 * @brief		段の情報
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			typedef struct
+			{
+				/** @brief 段 */
+				PipelineStage *				handler;
+				/** @brief 並列数 */
+				unsigned int				width;
+				/** @brief レーン毎のワーカー */
+				PipelineWorker *			workers[MAX_PIPELINE_WIDTH];
+				/** @brief 入力待ち行列(上流との接続) */
+				PipelineQueue *				inputs;
+				/** @brief 入力待ち行列の数 */
+				unsigned int				inputCount;
+				/** @brief 入力の終了 */
+				std::atomic<bool>			closing;
+				/** @brief 処理した総数 */
+				std::atomic<unsigned long>	processed;
+				/** @brief 破棄した総数 */
+				std::atomic<unsigned long>	dropped;
+				/** @brief 実行時間の総計(ナノ秒) */
+				std::atomic<long long>		busyTime;
+				/** @brief 入力が無く待機した回数 */
+				std::atomic<unsigned long>	starved;
+				/** @brief 下流が満杯で待機した回数 */
+				std::atomic<unsigned long>	blocked;
+			} PipelineStageInfo_t;
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief 段 */
+			PipelineStageInfo_t *	stages[MAX_PIPELINE_STAGE];
+			/** @brief 段の数 */
+			unsigned int			stageCount;
+			/** @brief 待ち行列の容量 */
+			size_t					depth;
+			/** @brief 開始済みか */
+			bool					started;
+			/** @brief 入力を受け付けるか */
+			std::atomic<bool>		accepting;
+			/** @brief 入力の振り分け位置 */
+			unsigned int			pushCursor;
+			/** @brief 入力保護用ミューテックス */
+			Mutex					mutex;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			bool	run(unsigned int index , unsigned int lane);
+			friend class PipelineWorker;
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			Pipeline(size_t queueDepth = PIPELINE_DEFAULT_DEPTH);
+			virtual ~Pipeline(void);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			bool			addStage(PipelineStage * stage , unsigned int width = 1);
+			bool			start();
+			bool			push(void * item , long timeout = -1);
+			void			close();
+			unsigned int	getStageCount();
+			bool			getStageStat(unsigned int index , PipelineStageStat_t * stat);
+	};
+}
+#endif /*VSTDPIPELINE_HPP_*/
@@ -0,0 +1,394 @@
+/* ***************************************************************************
+ * @file		VSTDReactor.cpp
+ * @brief		ファイルディスクリプタ監視(epoll)用 Class
+ * @see		VSTDThreadCall.hpp / <sys/epoll.h>
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 解除時に実行中のReactorFunctionの完了を待機
+ * ***************************************************************************/
+#include "VSTDReactor.hpp"
+#include "VSTDThreadCall.hpp"
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace VSTD
+{
+	/** @brief 一度に受け取るイベントの最大数 */
+	#define REACTOR_MAX_EVENTS 64
+	/** @brief ReactorFunctionを実行中のReactor */
+	static thread_local Reactor *	dispatchingReactor = NULL;
+	/**
+	 * @brief		Reactorのコンストラクタ
+	 * @note		epollとeventfdを作成し、eventfdを監視対象に登録します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Reactor::Reactor(void)
+	{
+		struct epoll_event ev;
+		created	= false;
+		sleeping	= false;
+		pending	= false;
+		entries	= NULL;
+		graveyard	= NULL;
+		dispatching	= NULL;
+		dispatchSeq	= 0;
+		removers	= 0;
+		epollFd	= epoll_create1(EPOLL_CLOEXEC);
+		eventFd	= eventfd(0 , EFD_NONBLOCK | EFD_CLOEXEC);
+		if (epollFd < 0 || eventFd < 0)
+		{
+			perror("Reactor:epoll/eventfdを作成出来ませんでした。");
+			return;
+		}
+		memset(&ev , 0 , sizeof(ev));
+		ev.events	= EPOLLIN;
+		ev.data.ptr	= NULL;
+		if (epoll_ctl(epollFd , EPOLL_CTL_ADD , eventFd , &ev) != 0)
+		{
+			perror("Reactor:eventfdを登録出来ませんでした。");
+			return;
+		}
+		created = true;
+	}
+	/**
+	 * @brief		Reactorのデストラクタ
+	 * @note		タイマーを破棄し、epollとeventfdを閉じます。
+	 * 				監視していたファイルディスクリプタは閉じません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Reactor::~Reactor(void)
+	{
+		collect();
+		while (entries)
+		{
+			ReactorEntry_t * entry = entries;
+			entries = entry->next;
+			if (entry->timer) close(entry->fd);
+			delete entry;
+		}
+		if (eventFd >= 0) close(eventFd);
+		if (epollFd >= 0) close(epollFd);
+	}
+	/**
+	 * @brief		addWatch
+	 * 				ファイルディスクリプタの監視登録
+	 * @param[in]	fd：監視するファイルディスクリプタを指定します。
+	 * @param[in]	events：監視するイベント(EPOLLIN/EPOLLOUT/EPOLLET等)を指定します。
+	 * @param[in]	handler：準備完了時に実行するReactorFunctionを指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Reactor::addWatch(int fd , unsigned int events , ReactorFunction * handler)
+	{
+		struct epoll_event ev;
+		if (!created || !handler) return false;
+		ReactorEntry_t * entry = new ReactorEntry_t;
+		entry->fd		= fd;
+		entry->timer	= false;
+		entry->handler	= handler;
+		entry->active	= true;
+		memset(&ev , 0 , sizeof(ev));
+		ev.events	= events;
+		ev.data.ptr	= entry;
+		mutex.lock();
+		if (epoll_ctl(epollFd , EPOLL_CTL_ADD , fd , &ev) != 0)
+		{
+			mutex.unlock();
+			delete entry;
+			return false;
+		}
+		entry->next	= entries;
+		entries		= entry;
+		mutex.unlock();
+		return true;
+	}
+	/**
+	 * @brief		modifyWatch
+	 * 				監視するイベントの変更
+	 * @param[in]	fd：監視中のファイルディスクリプタを指定します。
+	 * @param[in]	events：監視するイベントを指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Reactor::modifyWatch(int fd , unsigned int events)
+	{
+		struct epoll_event ev;
+		bool result = false;
+		mutex.lock();
+		for (ReactorEntry_t * entry = entries ; entry ; entry = entry->next)
+		{
+			if (entry->fd != fd || entry->timer) continue;
+			memset(&ev , 0 , sizeof(ev));
+			ev.events	= events;
+			ev.data.ptr	= entry;
+			result = (epoll_ctl(epollFd , EPOLL_CTL_MOD , fd , &ev) == 0);
+			break;
+		}
+		mutex.unlock();
+		return result;
+	}
+	/**
+	 * @brief		removeWatch
+	 * 				ファイルディスクリプタの監視解除
+	 * @note		ファイルディスクリプタを閉じる前に呼び出してください。
+	 * 				他のスレッドから呼び出した場合は実行中のReactorFunctionの
+	 * 				完了を待機する為、解除後にReactorFunctionが実行される事はなく、
+	 * 				復帰後に破棄出来ます。
+	 * 				ReactorFunction内から呼び出した場合は待機しません。
+	 * @param[in]	fd：監視中のファイルディスクリプタを指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Reactor::removeWatch(int fd)
+	{
+		ReactorEntry_t * entry = detach(fd , false);
+		if (!entry) return false;
+		waitDispatch(entry);
+		return true;
+	}
+	/**
+	 * @brief		addTimer
+	 * 				タイマーの登録
+	 * @param[in]	interval：満了までの時間をミリ秒にて指定します。
+	 * @param[in]	handler：満了時に実行するReactorFunctionを指定します。
+	 * @param[in]	repeat：trueの場合は一定間隔で繰り返し満了します。
+	 * @return	タイマーの識別子を返却します。失敗した場合は-1
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	int Reactor::addTimer(long interval , ReactorFunction * handler , bool repeat)
+	{
+		struct itimerspec	spec;
+		struct epoll_event	ev;
+		if (!created || !handler || interval <= 0) return -1;
+		int fd = timerfd_create(CLOCK_MONOTONIC , TFD_NONBLOCK | TFD_CLOEXEC);
+		if (fd < 0) return -1;
+		memset(&spec , 0 , sizeof(spec));
+		spec.it_value.tv_sec		= interval / 1000;
+		spec.it_value.tv_nsec	= (interval % 1000) * 1000000;
+		if (repeat)
+		{
+			spec.it_interval = spec.it_value;
+		}
+		ReactorEntry_t * entry = new ReactorEntry_t;
+		entry->fd		= fd;
+		entry->timer	= true;
+		entry->handler	= handler;
+		entry->active	= true;
+		memset(&ev , 0 , sizeof(ev));
+		ev.events	= EPOLLIN;
+		ev.data.ptr	= entry;
+		mutex.lock();
+		if (epoll_ctl(epollFd , EPOLL_CTL_ADD , fd , &ev) != 0
+		 || timerfd_settime(fd , 0 , &spec , NULL) != 0)
+		{
+			mutex.unlock();
+			close(fd);
+			delete entry;
+			return -1;
+		}
+		entry->next	= entries;
+		entries		= entry;
+		mutex.unlock();
+		return fd;
+	}
+	/**
+	 * @brief		removeTimer
+	 * 				タイマーの解除
+	 * @note		removeWatchと同様に実行中のReactorFunctionの完了を待機します。
+	 * @param[in]	timer：addTimerにて返却された識別子を指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Reactor::removeTimer(int timer)
+	{
+		ReactorEntry_t * entry = detach(timer , true);
+		if (!entry) return false;
+		waitDispatch(entry);
+		return true;
+	}
+	/**
+	 * @brief		notify
+	 * 				待ち行列への追加の通知
+	 * @note		スレッドが待機に入ろうとしている場合のみeventfdへ書き込む為、
+	 * 				処理中のスレッドに対する通知はシステムコールを伴いません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Reactor::notify()
+	{
+		uint64_t one = 1;
+		pending.store(true , std::memory_order_seq_cst);
+		if (sleeping.exchange(false , std::memory_order_seq_cst))
+		{
+			if (write(eventFd , &one , sizeof(one)) < 0 && errno != EAGAIN)
+			{
+				perror("Reactor:eventfdへ書き込めませんでした。");
+			}
+		}
+	}
+	/**
+	 * @brief		poll
+	 * 				イベントの待機と実行
+	 * @note		ファイルディスクリプタ、タイマー、待ち行列への追加通知の
+	 * 				いずれかを待機し、準備完了となったReactorFunctionを実行します。
+	 * 				ThreadCallのスレッドから呼び出されます。
+	 * @param[in]	thread：実行するThreadCall
+	 * @return	待ち行列への追加通知を受信したか
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool Reactor::poll(ThreadCall * thread)
+	{
+		struct epoll_event	events[REACTOR_MAX_EVENTS];
+		uint64_t			value;
+		int				timeout = -1;
+		/* 前回の実行中に解除された登録情報を破棄 */
+		collect();
+		/* 待機前に未処理の通知と待ち行列を確認 */
+		sleeping.store(true , std::memory_order_seq_cst);
+		if (pending.load(std::memory_order_seq_cst) || !thread->empty())
+		{
+			timeout = 0;
+		}
+		int num = epoll_wait(epollFd , events , REACTOR_MAX_EVENTS , timeout);
+		sleeping.store(false , std::memory_order_relaxed);
+		for (int i = 0 ; i < num ; i++)
+		{
+			ReactorEntry_t * entry = (ReactorEntry_t *)events[i].data.ptr;
+			/* 待ち行列への追加通知 */
+			if (!entry)
+			{
+				while (read(eventFd , &value , sizeof(value)) > 0);
+				continue;
+			}
+			/* 解除側が完了を待機出来る様、監視中かの確認前に実行中とする */
+			dispatching.store(entry , std::memory_order_seq_cst);
+			if (!entry->active.load(std::memory_order_seq_cst))
+			{
+				endDispatch();
+				continue;
+			}
+			ReactorFunction * handler = entry->handler;
+			handler->readyFd		= entry->fd;
+			handler->readyEvents	= events[i].events;
+			handler->expirations	= 0;
+			if (entry->timer)
+			{
+				if (read(entry->fd , &value , sizeof(value)) != sizeof(value))
+				{
+					endDispatch();
+					continue;
+				}
+				handler->expirations = value;
+			}
+			dispatchingReactor = this;
+			bool result = thread->dispatch((void *)handler);
+			dispatchingReactor = NULL;
+			endDispatch();
+			if (!result)
+			{
+				detach(entry->fd , entry->timer);
+			}
+		}
+		return pending.exchange(false , std::memory_order_seq_cst);
+	}
+	/**
+	 * @brief		detach
+	 * 				登録情報の解除
+	 * @note		解除した登録情報は実行中のpollが完了するまで破棄されません。
+	 * @param[in]	fd：ファイルディスクリプタ、もしくはタイマーの識別子
+	 * @param[in]	timer：タイマーか
+	 * @return	解除した登録情報。存在しない場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ReactorEntry_t * Reactor::detach(int fd , bool timer)
+	{
+		ReactorEntry_t * found = NULL;
+		mutex.lock();
+		for (ReactorEntry_t ** link = &entries ; *link ; link = &(*link)->next)
+		{
+			ReactorEntry_t * entry = *link;
+			if (entry->fd != fd || entry->timer != timer) continue;
+			epoll_ctl(epollFd , EPOLL_CTL_DEL , fd , NULL);
+			entry->active.store(false , std::memory_order_seq_cst);
+			*link		= entry->next;
+			entry->next	= graveyard;
+			graveyard	= entry;
+			found		= entry;
+			break;
+		}
+		mutex.unlock();
+		return found;
+	}
+	/**
+	 * @brief		endDispatch
+	 * 				ReactorFunctionの実行完了
+	 * @note		完了を待機中のスレッドが存在する場合のみ起床させます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Reactor::endDispatch()
+	{
+		dispatching.store(NULL , std::memory_order_seq_cst);
+		dispatchSeq.fetch_add(1 , std::memory_order_seq_cst);
+		if (removers.load(std::memory_order_seq_cst) > 0)
+		{
+			FutexWake(&dispatchSeq);
+		}
+	}
+	/**
+	 * @brief		waitDispatch
+	 * 				解除した登録情報の実行完了の待機
+	 * @note		解除した登録情報のReactorFunctionが実行中の場合は完了まで待機します。
+	 * 				ReactorFunction内から呼び出された場合は自身の完了を待つ事になる為、
+	 * 				待機しません。登録情報は破棄されている場合がある為、参照しません。
+	 * @param[in]	entry：detachにて解除した登録情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Reactor::waitDispatch(ReactorEntry_t * entry)
+	{
+		if (dispatchingReactor == this) return;
+		removers.fetch_add(1 , std::memory_order_seq_cst);
+		while (true)
+		{
+			int seq = dispatchSeq.load(std::memory_order_seq_cst);
+			if (dispatching.load(std::memory_order_seq_cst) != entry) break;
+			FutexWait(&dispatchSeq , seq);
+		}
+		removers.fetch_sub(1 , std::memory_order_seq_cst);
+	}
+	/**
+	 * @brief		collect
+	 * 				解除済みの登録情報の破棄
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void Reactor::collect()
+	{
+		mutex.lock();
+		ReactorEntry_t * list = graveyard;
+		graveyard = NULL;
+		mutex.unlock();
+		while (list)
+		{
+			ReactorEntry_t * entry = list;
+			list = entry->next;
+			if (entry->timer) close(entry->fd);
+			delete entry;
+		}
+	}
+}
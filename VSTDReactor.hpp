@@ -0,0 +1,137 @@
+/* ***************************************************************************
+ * @file		VSTDReactor.hpp
+ * @brief		ファイルディスクリプタ監視(epoll)用 Class
+ * @see		VSTDThreadCall.hpp / <sys/epoll.h>
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 解除時に実行中のReactorFunctionの完了を待機
+ * ***************************************************************************/
+#ifndef VSTDREACTOR_HPP_
+#define VSTDREACTOR_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <sys/epoll.h>
+#include <atomic>
+#include "VSTDThreadFunction.hpp"
+
+namespace VSTD
+{
+	class ThreadCall;
+	class Reactor;
+	/**
+	 * @brief		ReactorFunction
+	 * @note		ファイルディスクリプタの準備完了、及びタイマーの満了時に
+	 * 				ThreadCallのスレッドにて実行されるThreadFunctionです。
+	 * 				Functionがfalseを返却した場合は監視が解除されます。
+	 * 				監視中は繰り返し実行される為、自動解放は指定しないでください。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class ReactorFunction : public ThreadFunction
+	{
+	private:
+		/** @brief 準備完了となったファイルディスクリプタ */
+		int					readyFd;
+		/** @brief 準備完了となったイベント(EPOLLIN等) */
+		unsigned int			readyEvents;
+		/** @brief タイマーの満了回数 */
+		unsigned long long	expirations;
+		friend class Reactor;
+	public:
+		ReactorFunction() : readyFd(-1) , readyEvents(0) , expirations(0) {}
+		virtual ~ReactorFunction() {}
+		/** @brief 準備完了となったファイルディスクリプタを取得します。 */
+		int getFd() { return readyFd; }
+		/** @brief 準備完了となったイベントを取得します。 */
+		unsigned int getEvents() { return readyEvents; }
+		/** @brief 前回の実行からのタイマーの満了回数を取得します。 */
+		unsigned long long getExpirations() { return expirations; }
+	};
+	/**
+	 * @brief		監視の登録情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct ReactorEntry
+	{
+		/** @brief 監視するファイルディスクリプタ */
+		int						fd;
+		/** @brief タイマーか */
+		bool					timer;
+		/** @brief 実行するReactorFunction */
+		ReactorFunction *		handler;
+		/** @brief 監視中か */
+		std::atomic<bool>		active;
+		/** @brief 次の登録情報 */
+		struct ReactorEntry *	next;
+	} ReactorEntry_t;
+	/**
+	 * @brief	Reactor
+	 * @note	ThreadCallのスレッドにてファイルディスクリプタ、タイマー(timerfd)、
+	 * 			待ち行列を同時に待機する為のepollのラッパーです。
+	 * 			待ち行列への追加はeventfdにて通知されます。
+	 * 			ThreadCall::setThreadTypeにてTH_TYP_REACTORを指定する事で使用されます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class Reactor
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief epollのファイルディスクリプタ */
+			int						epollFd;
+			/** @brief 待ち行列通知用のeventfd */
+			int						eventFd;
+			/** @brief スレッドが待機に入ろうとしているか */
+			std::atomic<bool>		sleeping;
+			/** @brief 未処理の通知が存在するか */
+			std::atomic<bool>		pending;
+			/** @brief 監視中の登録情報 */
+			ReactorEntry_t *		entries;
+			/** @brief 解除済みで破棄待ちの登録情報 */
+			ReactorEntry_t *		graveyard;
+			/** @brief ReactorFunctionを実行中の登録情報 */
+			std::atomic<ReactorEntry_t *>	dispatching;
+			/** @brief 実行完了の通知用futex */
+			std::atomic<int>		dispatchSeq;
+			/** @brief 実行完了を待機中のスレッドの数 */
+			std::atomic<int>		removers;
+			/** @brief 登録情報保護用ミューテックス */
+			Mutex					mutex;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			ReactorEntry_t *	detach(int fd , bool timer);
+			void				collect();
+			void				endDispatch();
+			void				waitDispatch(ReactorEntry_t * entry);
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			Reactor(void);
+			virtual ~Reactor(void);
+			/* ***************************************************************
+			 * パブリックメンバ変数
+			 * ***************************************************************/
+			bool	created;
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			bool	addWatch(int fd , unsigned int events , ReactorFunction * handler);
+			bool	modifyWatch(int fd , unsigned int events);
+			bool	removeWatch(int fd);
+			int		addTimer(long interval , ReactorFunction * handler , bool repeat = true);
+			bool	removeTimer(int timer);
+			void	notify();
+			bool	poll(ThreadCall * thread);
+	};
+}
+#endif /*VSTDREACTOR_HPP_*/
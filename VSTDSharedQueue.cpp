@@ -0,0 +1,657 @@
+/* ***************************************************************************
+ * @file		VSTDSharedQueue.cpp
+ * @brief		プロセス間共有メモリ上の待ち行列用 Class
+ * @see		VSTDThreadCall.hpp / VSTDFutex.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "VSTDSharedQueue.hpp"
+#include "VSTDFutex.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <new>
+
+namespace VSTD
+{
+	/**
+	 * @brief		共有領域の先頭部分のサイズ
+	 * @return	SharedQueueHeader_tをページ境界に切り上げたサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static size_t getHeaderSpace()
+	{
+		size_t page = (size_t)sysconf(_SC_PAGESIZE);
+		return (sizeof(SharedQueueHeader_t) + page - 1) / page * page;
+	}
+	/**
+	 * @brief		メッセージが占める領域のサイズ
+	 * @param[in]	len：メッセージ本体の長さ
+	 * @return	先頭を含め16byte境界に切り上げたサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static inline uint64_t getRecordSize(uint64_t len)
+	{
+		return sizeof(SharedRecord_t) + ((len + 15) & ~(uint64_t)15);
+	}
+	/**
+	 * @brief		現在時刻(CLOCK_MONOTONIC)の取得
+	 * @return	現在時刻をミリ秒にて返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static long long getNowMs()
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC , &now);
+		return (long long)now.tv_sec * 1000LL + now.tv_nsec / 1000000;
+	}
+	/**
+	 * @brief		送信者の終了確認
+	 * @note		親プロセスに回収されていないゾンビも終了とみなします。
+	 * @param[in]	pid：送信者のプロセスID
+	 * @return	プロセスが存在しない場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static bool isDead(pid_t pid)
+	{
+		char	path[64];
+		char	buf[256];
+		if (pid <= 0 || pid == getpid()) return false;
+		if (kill(pid , 0) == -1)
+		{
+			return errno == ESRCH;
+		}
+		snprintf(path , sizeof(path) , "/proc/%d/stat" , (int)pid);
+		FILE * fp = fopen(path , "r");
+		if (!fp)
+		{
+			return false;
+		}
+		size_t len = fread(buf , 1 , sizeof(buf) - 1 , fp);
+		fclose(fp);
+		buf[len] = '\0';
+		/* 実行ファイル名の後の状態 */
+		char * state = strrchr(buf , ')');
+		return state && state[1] == ' ' && state[2] == 'Z';
+	}
+	/* ***********************************************************************
+	 *
+	 * SharedQueue
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		SharedQueueのコンストラクタ
+	 * @note		create/open/attachにて共有メモリを割り当てるまで使用出来ません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	SharedQueue::SharedQueue(void)
+	{
+		fd		= -1;
+		base		= NULL;
+		mapSize	= 0;
+		header	= NULL;
+		ring		= NULL;
+		mask		= 0;
+		owner		= false;
+	}
+	/**
+	 * @brief		SharedQueueのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	SharedQueue::~SharedQueue(void)
+	{
+		close();
+	}
+	/**
+	 * @brief		create
+	 * 				共有待ち行列の作成
+	 * @note		名前を指定した場合はshm_openにて作成し、同名の既存の領域は
+	 * 				削除します。NULLの場合はmemfdにて作成し、getFdで取得した
+	 * 				ファイルディスクリプタをfork/SCM_RIGHTSにて他のプロセスへ渡し
+	 * 				attachします。
+	 * @param[in]	shmName：shm_openの名前("/"で始まる)。NULLの場合はmemfd
+	 * @param[in]	capacity：容量(byte)。2のべき乗に切り上げます。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueue::create(const char * shmName , size_t capacity)
+	{
+		size_t size = SHQ_MIN_CAPACITY;
+		try
+		{
+			close();
+			while (size < capacity)
+			{
+				size <<= 1;
+			}
+			if (shmName)
+			{
+				shm_unlink(shmName);
+				fd = shm_open(shmName , O_CREAT | O_EXCL | O_RDWR , 0600);
+				name = shmName;
+			}
+			else
+			{
+				fd = memfd_create("VSTDSharedQueue" , 0);
+				name.clear();
+			}
+			if (fd < 0)
+			{
+				perror("SharedQueue:共有メモリを作成出来ませんでした。");
+				return false;
+			}
+			owner = true;
+			if (ftruncate(fd , (off_t)(getHeaderSpace() + size)) != 0
+			 || !map(getHeaderSpace() + size , true , size))
+			{
+				perror("SharedQueue:共有メモリを割り当て出来ませんでした。");
+				close();
+				return false;
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		open
+	 * 				名前を指定した共有待ち行列への接続
+	 * @param[in]	shmName：createにて指定した名前
+	 * @return	成否を返却します。初期化が完了していない場合は失敗します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueue::open(const char * shmName)
+	{
+		close();
+		fd = shm_open(shmName , O_RDWR , 0600);
+		if (fd < 0)
+		{
+			return false;
+		}
+		return attach(fd);
+	}
+	/**
+	 * @brief		attach
+	 * 				ファイルディスクリプタを指定した共有待ち行列への接続
+	 * @note		ファイルディスクリプタは本インスタンスが所有し、closeにて閉じます。
+	 * @param[in]	memfd：共有メモリのファイルディスクリプタ
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueue::attach(int memfd)
+	{
+		struct stat st;
+		if (memfd != fd)
+		{
+			close();
+		}
+		fd = memfd;
+		if (fstat(fd , &st) != 0 || (size_t)st.st_size <= getHeaderSpace() || !map((size_t)st.st_size , false , 0))
+		{
+			close();
+			return false;
+		}
+		return true;
+	}
+	/**
+	 * @brief		close
+	 * 				共有待ち行列の切断
+	 * @note		shm_openにて作成したプロセスの場合は名前を削除します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SharedQueue::close()
+	{
+		if (base)
+		{
+			munmap(base , mapSize);
+		}
+		if (fd >= 0)
+		{
+			::close(fd);
+		}
+		if (owner && !name.empty())
+		{
+			shm_unlink(name.c_str());
+		}
+		fd		= -1;
+		base		= NULL;
+		mapSize	= 0;
+		header	= NULL;
+		ring		= NULL;
+		mask		= 0;
+		owner		= false;
+		name.clear();
+	}
+	/**
+	 * @brief		getFd
+	 * 				共有メモリのファイルディスクリプタの取得
+	 * @return	ファイルディスクリプタを返却します。未接続の場合は-1
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	int SharedQueue::getFd()
+	{
+		return fd;
+	}
+	/**
+	 * @brief		map
+	 * 				共有メモリの割り当て
+	 * @note		作成時は先頭部分を初期化し、最後に識別子を設定します。
+	 * 				接続時は識別子と版数、サイズを確認します。
+	 * @param[in]	size：共有メモリのサイズ
+	 * @param[in]	init：初期化するか
+	 * @param[in]	capacity：作成時の容量
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueue::map(size_t size , bool init , size_t capacity)
+	{
+		base = mmap(NULL , size , PROT_READ | PROT_WRITE , MAP_SHARED , fd , 0);
+		if (base == MAP_FAILED)
+		{
+			base = NULL;
+			return false;
+		}
+		mapSize	= size;
+		header	= (SharedQueueHeader_t *)base;
+		ring		= (char *)base + getHeaderSpace();
+		if (init)
+		{
+			pthread_mutexattr_t attr;
+			new (header) SharedQueueHeader_t();
+			header->version	= SHQ_VERSION;
+			header->capacity	= capacity;
+			pthread_mutexattr_init(&attr);
+			pthread_mutexattr_setpshared(&attr , PTHREAD_PROCESS_SHARED);
+			pthread_mutexattr_setrobust(&attr , PTHREAD_MUTEX_ROBUST);
+			pthread_mutex_init(&header->mutex , &attr);
+			pthread_mutexattr_destroy(&attr);
+			header->magic.store(SHQ_MAGIC , std::memory_order_release);
+		}
+		else if (header->magic.load(std::memory_order_acquire) != SHQ_MAGIC
+			|| header->version != SHQ_VERSION
+			|| getHeaderSpace() + header->capacity != size)
+		{
+			munmap(base , size);
+			base		= NULL;
+			header	= NULL;
+			ring		= NULL;
+			return false;
+		}
+		mask = header->capacity - 1;
+		return true;
+	}
+	/**
+	 * @brief		lockMutex
+	 * 				送信者間のミューテックスのロック
+	 * @note		ロックを保持したまま送信者が終了した場合は回復します。
+	 * 				予約はtailの更新を最後に行う為、途中で終了しても
+	 * 				共有領域は一貫しています。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SharedQueue::lockMutex()
+	{
+		if (pthread_mutex_lock(&header->mutex) == EOWNERDEAD)
+		{
+			pthread_mutex_consistent(&header->mutex);
+		}
+	}
+	/**
+	 * @brief		getRecord
+	 * 				位置に対応するメッセージの先頭の取得
+	 * @param[in]	pos：位置
+	 * @return	メッセージの先頭を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	SharedRecord_t * SharedQueue::getRecord(uint64_t pos)
+	{
+		return (SharedRecord_t *)(ring + (pos & mask));
+	}
+	/**
+	 * @brief		reserve
+	 * 				メッセージの領域の予約
+	 * @note		共有メモリ上に領域を確保して返却します。書き込み後に
+	 * 				commitを呼び出してください。領域末尾に収まらない場合は
+	 * 				詰め物を挿入して先頭から確保します。
+	 * @param[in]	len：メッセージの長さ(容量の半分まで)
+	 * @param[in]	timeout：空きの待機時間をミリ秒にて指定。0の場合は待機せず、
+	 * 						負の場合は無期限
+	 * @return	確保した領域を返却します。空きが無い場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * SharedQueue::reserve(size_t len , long timeout)
+	{
+		uint64_t	total = getRecordSize(len);
+		long long	deadline = timeout > 0 ? getNowMs() + timeout : 0;
+		try
+		{
+			if (!header || total > header->capacity / 2)
+			{
+				return NULL;
+			}
+			while (true)
+			{
+				lockMutex();
+				uint64_t tail	= header->tail.load(std::memory_order_relaxed);
+				uint64_t room	= header->capacity - (tail & mask);
+				uint64_t pad	= room < total ? room : 0;
+				uint64_t used	= tail - header->head.load(std::memory_order_acquire);
+				if (header->capacity - used >= pad + total)
+				{
+					if (pad)
+					{
+						SharedRecord_t * filler = getRecord(tail);
+						filler->len	= (uint32_t)(pad - sizeof(SharedRecord_t));
+						filler->pid	= getpid();
+						filler->state.store(SHQ_REC_PAD , std::memory_order_relaxed);
+						tail += pad;
+					}
+					SharedRecord_t * record = getRecord(tail);
+					record->len	= (uint32_t)len;
+					record->pid	= getpid();
+					record->state.store(SHQ_REC_WRITING , std::memory_order_relaxed);
+					/* 先頭の書き込み後に公開 */
+					header->tail.store(tail + total , std::memory_order_release);
+					header->posted.fetch_add(1 , std::memory_order_relaxed);
+					pthread_mutex_unlock(&header->mutex);
+					return record + 1;
+				}
+				pthread_mutex_unlock(&header->mutex);
+				long long now = getNowMs();
+				if (timeout == 0 || (deadline && now >= deadline))
+				{
+					header->rejected.fetch_add(1 , std::memory_order_relaxed);
+					return NULL;
+				}
+				/* 受信者が領域を解放するまで待機 */
+				uint32_t seq = header->spaceSeq.load(std::memory_order_seq_cst);
+				header->spaceWaiters.fetch_add(1 , std::memory_order_seq_cst);
+				used = header->tail.load(std::memory_order_seq_cst) - header->head.load(std::memory_order_seq_cst);
+				if (header->capacity - used < pad + total)
+				{
+					FutexWaitShared(&header->spaceSeq , (int)seq , deadline ? (deadline - now) * 1000000LL : 0);
+				}
+				header->spaceWaiters.fetch_sub(1 , std::memory_order_relaxed);
+			}
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		commit
+	 * 				メッセージの送信
+	 * @note		reserveにて確保した領域を受信可能とし、受信者が待機中の
+	 * 				場合のみ起床させます。
+	 * @param[in]	data：reserveにて返却された領域
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueue::commit(void * data)
+	{
+		if (!data || !header) return false;
+		SharedRecord_t * record = (SharedRecord_t *)data - 1;
+		record->state.store(SHQ_REC_READY , std::memory_order_release);
+		wakeReady();
+		return true;
+	}
+	/**
+	 * @brief		cancel
+	 * 				予約の取り消し
+	 * @note		受信者はメッセージを読み飛ばします。
+	 * @param[in]	data：reserveにて返却された領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SharedQueue::cancel(void * data)
+	{
+		if (!data || !header) return;
+		SharedRecord_t * record = (SharedRecord_t *)data - 1;
+		record->state.store(SHQ_REC_ABANDONED , std::memory_order_release);
+		wakeReady();
+	}
+	/**
+	 * @brief		post
+	 * 				メッセージの複製による送信
+	 * @param[in]	data：送信するデータ
+	 * @param[in]	len：データの長さ
+	 * @param[in]	timeout：空きの待機時間(ミリ秒)。reserveと同様
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueue::post(const void * data , size_t len , long timeout)
+	{
+		void * area = reserve(len , timeout);
+		if (!area) return false;
+		memcpy(area , data , len);
+		return commit(area);
+	}
+	/**
+	 * @brief		getStat
+	 * 				統計情報の取得
+	 * @param[out]	stat：統計情報を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SharedQueue::getStat(SharedQueueStat_t * stat)
+	{
+		memset(stat , 0 , sizeof(SharedQueueStat_t));
+		if (!header) return;
+		stat->capacity	= header->capacity;
+		stat->used		= header->tail.load(std::memory_order_acquire) - header->head.load(std::memory_order_acquire);
+		stat->posted		= header->posted.load(std::memory_order_relaxed);
+		stat->consumed	= header->consumed.load(std::memory_order_relaxed);
+		stat->recovered	= header->recovered.load(std::memory_order_relaxed);
+		stat->rejected	= header->rejected.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		wakeReady
+	 * 				受信者の起床
+	 * @note		受信者が待機中の場合のみfutexを起床させます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SharedQueue::wakeReady()
+	{
+		header->readySeq.fetch_add(1 , std::memory_order_seq_cst);
+		if (header->sleeping.load(std::memory_order_seq_cst))
+		{
+			FutexWakeShared(&header->readySeq , 1);
+		}
+	}
+	/**
+	 * @brief		consume
+	 * 				受信可能なメッセージの受信
+	 * @note		受信者のスレッドからのみ呼び出されます。
+	 * 				書き込み中のメッセージに到達した場合、送信者が終了していれば
+	 * 				破棄して進み、それ以外は停止します。
+	 * @param[in]	reader：受信者
+	 * @param[out]	pending：書き込み中のメッセージで停止した場合はtrue
+	 * @return	受信した数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	size_t SharedQueue::consume(SharedQueueReader * reader , bool * pending)
+	{
+		uint64_t	head	= header->head.load(std::memory_order_relaxed);
+		uint64_t	start	= head;
+		size_t		num	= 0;
+		*pending = false;
+		while (head != header->tail.load(std::memory_order_acquire))
+		{
+			SharedRecord_t *	record	= getRecord(head);
+			uint32_t			state	= record->state.load(std::memory_order_acquire);
+			if (state == SHQ_REC_WRITING)
+			{
+				if (!isDead(record->pid))
+				{
+					*pending = true;
+					break;
+				}
+				/* 終了直前に送信された場合を除き破棄 */
+				state = record->state.load(std::memory_order_acquire);
+				if (state == SHQ_REC_WRITING)
+				{
+					header->recovered.fetch_add(1 , std::memory_order_relaxed);
+				}
+			}
+			if (state == SHQ_REC_READY)
+			{
+				reader->onMessage(record + 1 , record->len);
+				header->consumed.fetch_add(1 , std::memory_order_relaxed);
+				num++;
+			}
+			head += getRecordSize(record->len);
+			header->head.store(head , std::memory_order_release);
+		}
+		/* 領域を解放した場合は空きを待機している送信者を起床 */
+		if (head != start)
+		{
+			header->spaceSeq.fetch_add(1 , std::memory_order_seq_cst);
+			if (header->spaceWaiters.load(std::memory_order_seq_cst))
+			{
+				FutexWakeShared(&header->spaceSeq);
+			}
+		}
+		return num;
+	}
+	/**
+	 * @brief		waitReady
+	 * 				メッセージの待機
+	 * @note		待機中であることを公開した後に再確認し、受信可能な
+	 * 				メッセージが無い場合のみfutexにて待機します。
+	 * @param[in]	timeout：タイムアウトをミリ秒にて指定。0の場合は無期限
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SharedQueue::waitReady(long timeout)
+	{
+		uint32_t seq = header->readySeq.load(std::memory_order_seq_cst);
+		header->sleeping.store(1 , std::memory_order_seq_cst);
+		uint64_t head = header->head.load(std::memory_order_relaxed);
+		bool idle = head == header->tail.load(std::memory_order_seq_cst)
+			|| getRecord(head)->state.load(std::memory_order_seq_cst) == SHQ_REC_WRITING;
+		if (idle)
+		{
+			FutexWaitShared(&header->readySeq , (int)seq , (long long)timeout * 1000000LL);
+		}
+		header->sleeping.store(0 , std::memory_order_relaxed);
+	}
+	/* ***********************************************************************
+	 *
+	 * SharedQueueReader
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		SharedQueueReaderのコンストラクタ
+	 * @note		受信を開始します。
+	 * @param[in]	source：受信する待ち行列(接続済み)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	SharedQueueReader::SharedQueueReader(SharedQueue * source)
+		: ThreadCall() , queue(source) , closing(false)
+	{
+		setFunction();
+	}
+	/**
+	 * @brief		SharedQueueReaderのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	SharedQueueReader::~SharedQueueReader(void)
+	{
+		close();
+		stop();
+	}
+	/**
+	 * @brief		onMessage
+	 * 				ラッピング用仮想ファンクション
+	 * @note		受信したメッセージ毎に呼び出されます。
+	 * @param[in]	data：メッセージ(共有メモリ上、呼び出しの間のみ有効)
+	 * @param[in]	len：メッセージの長さ
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueueReader::onMessage(const void * /* data */ , size_t /* len */)
+	{
+		return true;
+	}
+	/**
+	 * @brief		onFunction
+	 * 				受信処理
+	 * @note		closeされるまで受信と待機を繰り返します。書き込み中の
+	 * 				メッセージで停止した場合は送信者の終了を確認する為、
+	 * 				SHQ_RECOVER_INTERVAL毎に再確認します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool SharedQueueReader::onFunction()
+	{
+		bool pending;
+		try
+		{
+			while (!closing.load(std::memory_order_acquire))
+			{
+				queue->consume(this , &pending);
+				if (closing.load(std::memory_order_acquire))
+				{
+					break;
+				}
+				queue->waitReady(pending ? SHQ_RECOVER_INTERVAL : 0);
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		close
+	 * 				受信の終了
+	 * @note		待機中の受信処理を起床させて終了させます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SharedQueueReader::close()
+	{
+		closing.store(true , std::memory_order_release);
+		if (queue->header)
+		{
+			queue->header->readySeq.fetch_add(1 , std::memory_order_seq_cst);
+			FutexWakeShared(&queue->header->readySeq);
+		}
+	}
+}
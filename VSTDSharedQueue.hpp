@@ -0,0 +1,219 @@
+/* ***************************************************************************
+ * @file		VSTDSharedQueue.hpp
+ * @brief		プロセス間共有メモリ上の待ち行列用 Class
+ * @see		VSTDThreadCall.hpp / VSTDFutex.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDSHAREDQUEUE_HPP_
+#define VSTDSHAREDQUEUE_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <sys/types.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <atomic>
+#include <string>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief 共有領域の識別子 */
+	#define SHQ_MAGIC 0x56534851
+	/** @brief 共有領域の形式の版数 */
+	#define SHQ_VERSION 1
+	/** @brief 待ち行列の最小容量(byte) */
+	#define SHQ_MIN_CAPACITY 4096
+	/** @brief 書き込み中のメッセージの送信者の生存確認間隔(ミリ秒) */
+	#define SHQ_RECOVER_INTERVAL 100
+	/**
+	 * @brief		メッセージの状態を定義している列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief 送信者が書き込み中です */
+		SHQ_REC_WRITING,
+		/** @brief 受信可能です */
+		SHQ_REC_READY,
+		/** @brief 領域末尾の詰め物です */
+		SHQ_REC_PAD,
+		/** @brief 取り消されたか、送信者が書き込み中に終了しました */
+		SHQ_REC_ABANDONED
+	} SharedRecordState_t;
+	/**
+	 * @brief		メッセージの先頭
+	 * @note		メッセージ本体は直後に16byte境界で配置されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief メッセージの状態 */
+		std::atomic<uint32_t>	state;
+		/** @brief メッセージ本体の長さ */
+		uint32_t				len;
+		/** @brief 送信者のプロセスID */
+		int32_t					pid;
+		/** @brief 予約 */
+		uint32_t				reserved;
+	} SharedRecord_t;
+	/**
+	 * @brief		共有領域の先頭
+	 * @note		共有領域の先頭に配置され、全てのプロセスから参照されます。
+	 * 				位置は単調増加し、容量で割った余りを領域内の位置とします。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 識別子。初期化完了後に設定されます */
+		std::atomic<uint32_t>	magic;
+		/** @brief 形式の版数 */
+		uint32_t				version;
+		/** @brief 容量(byte、2のべき乗) */
+		uint64_t				capacity;
+		/** @brief 送信者間の予約保護用ミューテックス(プロセス間共有・ロバスト) */
+		pthread_mutex_t			mutex;
+		/** @brief 受信位置(受信者のみ更新) */
+		alignas(TH_CACHE_LINE) std::atomic<uint64_t>	head;
+		/** @brief 送信者が空きを待機している数 */
+		std::atomic<uint32_t>	spaceWaiters;
+		/** @brief 空き通知用futex */
+		std::atomic<uint32_t>	spaceSeq;
+		/** @brief 受信した総数 */
+		std::atomic<uint64_t>	consumed;
+		/** @brief 送信者の異常終了により破棄した総数 */
+		std::atomic<uint64_t>	recovered;
+		/** @brief 予約位置(ミューテックスにて保護) */
+		alignas(TH_CACHE_LINE) std::atomic<uint64_t>	tail;
+		/** @brief 受信者が待機しているか */
+		std::atomic<uint32_t>	sleeping;
+		/** @brief 受信通知用futex */
+		std::atomic<uint32_t>	readySeq;
+		/** @brief 予約した総数 */
+		std::atomic<uint64_t>	posted;
+		/** @brief 空きが無く拒否した総数 */
+		std::atomic<uint64_t>	rejected;
+	} SharedQueueHeader_t;
+	/**
+	 * @brief		共有待ち行列の統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 容量(byte) */
+		unsigned long		capacity;
+		/** @brief 使用中の領域(byte) */
+		unsigned long		used;
+		/** @brief 予約した総数 */
+		unsigned long		posted;
+		/** @brief 受信した総数 */
+		unsigned long		consumed;
+		/** @brief 送信者の異常終了により破棄した総数 */
+		unsigned long		recovered;
+		/** @brief 空きが無く拒否した総数 */
+		unsigned long		rejected;
+	} SharedQueueStat_t;
+	class SharedQueueReader;
+	/**
+	 * @brief	SharedQueue
+	 * @note	memfd/shm_openの共有メモリ上に可変長メッセージのリングを配置し、
+	 * 			複数のプロセスから送信、1つのプロセスのSharedQueueReaderにて
+	 * 			受信します。
+	 * 			送信者はreserveで確保した共有メモリへ直接書き込んでcommitし、
+	 * 			受信者は共有メモリ上のメッセージをそのまま参照する為、
+	 * 			複製は発生しません。
+	 * 			通知はプロセス間共有のfutexにて行い、待機者が居ない場合は
+	 * 			システムコールを呼び出しません。
+	 * 			送信者が予約中に終了した場合、ロバストミューテックスを回復し、
+	 * 			書き込み中のメッセージは送信者の終了を確認した時点で破棄されます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class SharedQueue
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief 共有メモリのファイルディスクリプタ */
+			int						fd;
+			/** @brief 共有メモリのマッピング */
+			void *					base;
+			/** @brief マッピングのサイズ */
+			size_t					mapSize;
+			/** @brief 共有領域の先頭 */
+			SharedQueueHeader_t *	header;
+			/** @brief リングの領域 */
+			char *					ring;
+			/** @brief 容量-1 */
+			uint64_t				mask;
+			/** @brief shm_openの名前。memfdの場合は空 */
+			std::string				name;
+			/** @brief 作成したプロセスか */
+			bool					owner;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			bool				map(size_t size , bool init , size_t capacity);
+			void				lockMutex();
+			SharedRecord_t *	getRecord(uint64_t pos);
+			size_t				consume(SharedQueueReader * reader , bool * pending);
+			void				waitReady(long timeout);
+			void				wakeReady();
+			friend class SharedQueueReader;
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			SharedQueue(void);
+			virtual ~SharedQueue(void);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			bool	create(const char * shmName , size_t capacity);
+			bool	open(const char * shmName);
+			bool	attach(int memfd);
+			void	close();
+			int		getFd();
+			void *	reserve(size_t len , long timeout = 0);
+			bool	commit(void * data);
+			void	cancel(void * data);
+			bool	post(const void * data , size_t len , long timeout = 0);
+			void	getStat(SharedQueueStat_t * stat);
+	};
+	/**
+	 * @brief	SharedQueueReader
+	 * @note	SharedQueueのメッセージを受信するThreadCallです。
+	 * 			仮想メソッド[onMessage]をラッピングして使用します。
+	 * 			onMessageに渡される領域は共有メモリ上にあり、
+	 * 			呼び出しの間のみ有効です。
+	 * 			1つの待ち行列に対して受信者は1つのみとしてください。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class SharedQueueReader : public ThreadCall
+	{
+		private:
+			/** @brief 受信する待ち行列 */
+			SharedQueue *		queue;
+			/** @brief 終了中か */
+			std::atomic<bool>	closing;
+		public:
+			SharedQueueReader(SharedQueue * source);
+			virtual ~SharedQueueReader(void);
+			virtual bool	onMessage(const void * data , size_t len);
+			virtual bool	onFunction();
+			using ThreadCall::onFunction;
+			void			close();
+	};
+}
+#endif /*VSTDSHAREDQUEUE_HPP_*/
@@ -9,23 +9,179 @@
  * 
  * @par 更新履歴：
  * - 2009/07/16	Sebastian 新規作成
+ * - 2026/10/19	Sebastian デッドライン(EDF)スケジューリングを追加
+ * - 2026/10/19	Sebastian テナント単位の重み付き公平キューイングを追加
+ * - 2026/10/19	Sebastian 型付き実行結果(submit)を追加
+ * - 2026/10/19	Sebastian スタックサイズ指定のコンストラクタを追加
+ * - 2026/10/19	Sebastian レジストリ登録と監視用の統計情報を追加
+ * - 2026/10/19	Sebastian ファイルディスクリプタ監視(TH_TYP_REACTOR)を追加
+ * - 2026/10/19	Sebastian メンバをキャッシュライン毎に分離し状態をatomic化
+ * - 2026/10/19	Sebastian 状態遷移の待機(waitThreadState)を追加
+ * - 2026/10/19	Sebastian 可変長メッセージの複製による積み上げ(post)を追加
+ * - 2026/10/19	Sebastian まとめて取り出して実行するonFunctionsを追加
+ * - 2026/10/19	Sebastian トークンバケットによる取り出しの流量制限を追加
+ * - 2026/10/19	Sebastian 実行待ちのThreadFunctionの積み上げを集約するモードを追加
+ * - 2026/10/19	Sebastian 待ち時間による過負荷時の積み上げ拒否(受付制御)を追加
+ * - 2026/10/19	Sebastian ジャーナルによる待ち行列の永続化と再実行を追加
+ * - 2026/10/19	Sebastian スレッド開始・終了時の処理とスレッド毎のコンテキストを追加
+ * - 2026/10/19	Sebastian 生産者スレッド毎の積み上げバッファ(まとめて公開)を追加
+ * - 2026/10/19	Sebastian ジャーナルの未完了データをワーカースレッドにて補充
  * ***************************************************************************/
 #include "VSTDThreadCall.hpp"
+#include "VSTDThreadRegistry.hpp"
+#include "VSTDTokenBucket.hpp"
+#include "VSTDJournal.hpp"
+#include <sched.h>
 
 int nanosleep(const struct timespec * rqtp , struct timespec * rmtp);
 
 namespace VSTD
 {
+	/** @brief 実行中のThreadCall */
+	static thread_local ThreadCall *	currentThread = NULL;
+	/** @brief 実行中のスレッドのコンテキスト */
+	static thread_local void *		threadContext = NULL;
+	/**
+	 * @brief		生産者毎のバッファのスピンロックの取得
+	 * @param[in]	buffer：生産者毎のバッファ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void lockBuffer(ProducerBuffer_t * buffer)
+	{
+		int spins = 0;
+		while (buffer->lock.exchange(1 , std::memory_order_acquire))
+		{
+			if (++spins > 64)
+			{
+				sched_yield();
+				spins = 0;
+			}
+		}
+	}
+	/**
+	 * @brief		生産者毎のバッファのスピンロックの解放
+	 * @param[in]	buffer：生産者毎のバッファ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void unlockBuffer(ProducerBuffer_t * buffer)
+	{
+		buffer->lock.store(0 , std::memory_order_release);
+	}
+	/**
+	 * @brief		生産者毎のバッファの参照の解放
+	 * @note		生産者スレッドとThreadCallの双方が解放した時点で破棄します。
+	 * @param[in]	buffer：生産者毎のバッファ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void releaseBuffer(ProducerBuffer_t * buffer)
+	{
+		if (buffer->refs.fetch_sub(1 , std::memory_order_acq_rel) == 1)
+		{
+			free(buffer->batch);
+			delete buffer;
+		}
+	}
+	/**
+	 * @brief		生産者スレッドが保持するバッファの一覧
+	 * @note		スレッドの終了時に未公開のデータを公開してバッファを解放します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	struct ProducerLocal
+	{
+		/** @brief 保持しているバッファ */
+		ProducerBuffer_t *	head;
+		/** @brief 最後に使用したバッファ */
+		ProducerBuffer_t *	last;
+		ProducerLocal() : head(NULL) , last(NULL)
+		{
+		}
+		~ProducerLocal()
+		{
+			while (head)
+			{
+				ProducerBuffer_t *	buffer	= head;
+				head = buffer->localNext;
+				/* ***********************************************************
+				 * ThreadCallの破棄(clearProducers)はバッファのロックを待つ為、
+				 * ロックを保持したまま公開する
+				 * ***********************************************************/
+				lockBuffer(buffer);
+				ThreadCall * owner = buffer->owner.load(std::memory_order_acquire);
+				if (owner && buffer->batch && buffer->batch->count > 0)
+				{
+					ProducerBatch_t * batch = buffer->batch;
+					buffer->batch = NULL;
+					owner->publishBatch(batch , true);
+				}
+				unlockBuffer(buffer);
+				releaseBuffer(buffer);
+			}
+		}
+	};
+	/** @brief 生産者スレッドが保持するバッファ */
+	static thread_local ProducerLocal	producerLocal;
 	void Sleep (unsigned int milliSecond)
 	{
-		unsigned int second;
 		struct timespec interval;
 		struct timespec remainder;
-		second = milliSecond *1000000;
-		interval.tv_sec= 0;
-		interval.tv_nsec=second;
+		interval.tv_sec= milliSecond / 1000;
+		interval.tv_nsec=(milliSecond % 1000) * 1000000;
 		nanosleep(&interval,&remainder);
 	}
+	/**
+	 * @brief		SetDeadline
+	 * 				実行期限の算出
+	 * @note		現在時刻(CLOCK_MONOTONIC)から指定されたマイクロ秒後の
+	 * 				時刻を実行期限として設定します。
+	 * @param[out]	deadline：算出した実行期限を格納します。
+	 * @param[in]	microSecond：現在時刻からの猶予をマイクロ秒にて指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void SetDeadline(struct timespec * deadline , long microSecond)
+	{
+		clock_gettime(CLOCK_MONOTONIC , deadline);
+		deadline->tv_sec	+= microSecond / 1000000;
+		deadline->tv_nsec	+= (microSecond % 1000000) * 1000;
+		if (deadline->tv_nsec >= 1000000000)
+		{
+			deadline->tv_sec	+= 1;
+			deadline->tv_nsec	-= 1000000000;
+		}
+	}
+	/** @brief メッセージの先頭部分のサイズ */
+	static const size_t MessageHeaderSize =
+		(sizeof(ThreadMessage_t) + TH_MESSAGE_ALIGN - 1) & ~((size_t)TH_MESSAGE_ALIGN - 1);
+	/**
+	 * @brief		getMessageSize
+	 * 				メッセージがリング上で占めるサイズの算出
+	 * @param[in]	message：メッセージの先頭
+	 * @return	先頭を含めTH_MESSAGE_ALIGN境界に切り上げたサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static inline uint64_t getMessageSize(const ThreadMessage_t * message)
+	{
+		if (message->pad) return message->len;
+		return MessageHeaderSize + ((message->len + TH_MESSAGE_ALIGN - 1) & ~((uint64_t)TH_MESSAGE_ALIGN - 1));
+	}
+	/**
+	 * @brief		GetMonotonicTime
+	 * 				現在時刻(CLOCK_MONOTONIC)の取得
+	 * @return	現在時刻をナノ秒にて返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	long long GetMonotonicTime()
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC , &now);
+		return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+	}
 	/* ***********************************************************************
 	 *
 	 * コンストラクタ/デストラクタ
@@ -38,31 +194,103 @@ namespace VSTD
 	 */
 	ThreadCall::ThreadCall(void)
 	{
-		running				= false;
+		initialize(100);
+	}
+	/**
+	 * @brief		ThreadCallのコンストラクタ
+	 * @note		スタックサイズを指定してスレッドを開始します。
+	 * @param[in]	size：スレッドのスタックサイズをbyte単位で指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadCall::ThreadCall(int size)
+	{
+		initialize(size);
+	}
+	/**
+	 * @brief		initialize
+	 * 				メンバの初期化とスレッドの開始
+	 * @param[in]	size：スレッドのスタックサイズを指定します。
+	 * @author	Sebastian
+	 * @date		2009/7/16
+	 */
+	void ThreadCall::initialize(int size)
+	{
+		stateWaiters			= 0;
+		running.store(false , std::memory_order_release);
+		joinable				= false;
 		threadId				= 0L;
-		threadstatus			= TH_STAT_DOWN;
+		setThreadState(TH_STAT_DOWN);
 		threadIdle			= 100;
 		threadQueue			= NULL;
 		ProcessQueue			= NULL;
 		threadQueDepath		= MAX_THREAD;
 		threadtype			= TH_TYP_EVENTDRIVEN;
-		stacksize				= 100;
+		stacksize				= size;
 		currentThreadQueue	= 0;
 		threadCondition		= TH_ERR_NOERROR;
-		threadQueue			= new void * [MAX_THREAD];
+		threadschedule		= TH_SCHED_LIFO;
+		batchSize				= 1;
+		rateLimit				= NULL;
+		coalescing			= false;
+		coalescedFunctions	= 0;
+		overloadTarget		= 0;
+		overloadInterval		= 0;
+		journal				= NULL;
+		journalPayload		= 0;
+		contextCreate			= NULL;
+		contextDestroy		= NULL;
+		producerSize			= 0;
+		producerInterval		= (long long)TH_PRODUCER_INTERVAL * 1000LL;
+		producerLimit			= TH_PRODUCER_BACKLOG;
+		producerExcluded		= false;
+		producerBatches		= NULL;
+		producerBacklog		= 0;
+		producerArmed			= 0;
+		producers				= NULL;
+		overloaded			= false;
+		shedFunctions			= 0;
+		overloadSince			= 0;
+		throttleWait			= 0;
+		throttleSeq			= 0;
+		throttleParked		= false;
+		expiredFunctions		= 0;
+		ProcessDeadline.tv_sec	= TH_NO_DEADLINE;
+		ProcessDeadline.tv_nsec	= 0;
+		ProcessTenant			= TH_TENANT_DEFAULT;
+		tenantCount			= 0;
+		tenantCursor			= 0;
+		tenantTurn			= false;
+		memset(tenants , 0 , sizeof(tenants));
+		ProcessEnqueued		= 0;
+		ProcessOldest			= 0;
+		busySince				= 0;
+		processedFunctions	= 0;
+		totalWait				= 0;
+		maxWait				= 0;
+		watchdogFlagged		= 0;
+		registered			= false;
+		registryGroup			= 0;
+		reactor				= NULL;
+		messageRing			= NULL;
+		messageCapacity		= TH_MESSAGE_RING;
+		messageTail			= 0;
+		messageHead			= 0;
+		messageReserved		= 0;
+		threadQueue			= new ThreadQueue_t [MAX_THREAD];
 		try
 		{
 
 			if (!threadQueue)
 			{
 				threadCondition	|=	TH_ERR_MEMORY_ERR	;
-				threadstatus		=	TH_STAT_FAULT;
+				setThreadState(TH_STAT_FAULT);
 				return;
 			}
 			if (!mutex.created)
 			{
 				threadCondition	|=	TH_ERR_MUTEX_CREATE;
-				threadstatus		=	TH_STAT_FAULT;
+				setThreadState(TH_STAT_FAULT);
 				std::string desc = "[ThreadCall]:ミューテックスが正常に作成出来ませんでした。";
 				throw desc;
 				return;
@@ -70,7 +298,7 @@ namespace VSTD
 			if (!condition.created)
 			{
 				threadCondition	|=	TH_ERR_COND_CREATE;
-				threadstatus		=	TH_STAT_FAULT;
+				setThreadState(TH_STAT_FAULT);
 				std::string desc = "[ThreadCall]:条件変数が正常に作成出来ませんでした。";
 				throw desc;
 				return;
@@ -90,23 +318,67 @@ namespace VSTD
 	 */
 	ThreadCall::~ThreadCall(void)
 	{
-		void * result;
 		try
 		{
 			/* 実行中の場合は停止 */
 			if (running)
 			{
 				stop();
-				pthread_join(threadhandle,&result);
+			}
+			/* スレッドの回収 */
+			join();
+			/* 生産者毎のバッファをクリア(公開時に通知先を参照する為先に行う) */
+			clearProducers();
+			/* レジストリから登録解除 */
+			if (registered)
+			{
+				ThreadRegistry::getInstance()->remove(this);
 			}
 			/* スレッドファンクションをクリア */
 			delete [] threadQueue;
+			/* テナントの待ち行列をクリア */
+			for (unsigned int i = 0 ; i < tenantCount ; i++)
+			{
+				delete [] tenants[i]->queue;
+				delete tenants[i];
+			}
+			/* ファイルディスクリプタ監視をクリア */
+			delete reactor;
+			/* 未実行のメッセージをクリア */
+			clearMessages();
 		}
 		catch(...)
 		{
 			throw;
 		}
 	}
+	/**
+	 * @brief		operator new
+	 * @note		メンバのキャッシュライン分離を有効にする為、
+	 * 				キャッシュライン境界に確保します。
+	 * @param[in]	size：確保するサイズ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * ThreadCall::operator new(size_t size)
+	{
+		void * ptr;
+		if (posix_memalign(&ptr , TH_CACHE_LINE , size) != 0)
+		{
+			throw std::bad_alloc();
+		}
+		return ptr;
+	}
+	/**
+	 * @brief		operator delete
+	 * @param[in]	ptr：operator newにて確保した領域
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::operator delete(void * ptr)
+	{
+		free(ptr);
+	}
 	/* ***********************************************************************
 	 *
 	 * フレンドメソッド
@@ -131,11 +403,20 @@ namespace VSTD
 		 * *******************************************************************/
 		ThreadCall *	pThread;
 		ThreadType_t		Type;
+		Reactor *		pReactor = NULL;
+		bool			started = false;
 		pThread = (ThreadCall *)threadCall;
 		pThread->mutex.lock();
-		pThread->threadstatus = TH_STAT_WAIT;
-		pThread->running	= true;
 		pThread->threadId	= pthread_self();
+		/* 開始前に停止が要求された場合は終了 */
+		if (!pThread->running.load(std::memory_order_acquire))
+		{
+			pThread->setThreadState(TH_STAT_DOWN);
+			pThread->mutex.unlock();
+			return (void *)0;
+		}
+		/* 実行中フラグはstartにて設定済み */
+		pThread->setThreadState(TH_STAT_WAIT);
 		pThread->mutex.unlock();
 		try
 		{
@@ -144,7 +425,7 @@ namespace VSTD
 			 * *******************************************************************/
 			while (true)
 			{
-				Type = pThread->threadtype;
+				Type = pThread->threadtype.load(std::memory_order_acquire);
 				/* ***************************************************************
 				 * スレッド種別がイベントドリブンタイプである
 				 * ***************************************************************/
@@ -158,6 +439,43 @@ namespace VSTD
 						break;
 					}
 				}
+				/* ***************************************************************
+				 * 初回の実行前にスレッド開始時の処理を実行
+				 * (スレッドはコンストラクタ内で開始される為、派生クラスの
+				 *  構築後となる初回の起床まで遅延させる)
+				 * ***************************************************************/
+				if (!started)
+				{
+					/* 開始前に停止された場合は実行しない */
+					if (!pThread->running.load(std::memory_order_acquire))
+					{
+						break;
+					}
+					started		= true;
+					currentThread	= pThread;
+					if (!pThread->onThreadStart())
+					{
+						break;
+					}
+				}
+				/* ***************************************************************
+				 * スレッド種別がファイルディスクリプタ監視タイプである
+				 * ***************************************************************/
+				if (Type == TH_TYP_REACTOR)
+				{
+					if (!pReactor)
+					{
+						pReactor = pThread->getReactor();
+					}
+					/* ***********************************************************
+					 * 準備完了となったReactorFunctionを実行し、待ち行列への
+					 * 追加通知が無く待ち行列も空の場合は再度待機
+					 * ***********************************************************/
+					if (!pReactor->poll(pThread) && pThread->empty())
+					{
+						continue;
+					}
+				}
 				/* ***************************************************************
 				 * 待機状態のスレッドファンクションを逐次実行
 				 * ***************************************************************/
@@ -175,17 +493,22 @@ namespace VSTD
 				/* ***************************************************************
 				 * インターバル型の場合はアイドリング
 				 * ***************************************************************/
-				if (pThread->threadtype == TH_TYP_INTERVAL)
+				if (pThread->threadtype.load(std::memory_order_acquire) == TH_TYP_INTERVAL)
 				{
-					Sleep(pThread->threadIdle);
+					Sleep(pThread->threadIdle.load(std::memory_order_relaxed));
 				}
 			}
 			/* *******************************************************************
 			 * スレッドのシャットダウン処理
 			 * *******************************************************************/
+			if (started)
+			{
+				pThread->onThreadExit();
+				currentThread = NULL;
+			}
 			pThread->mutex.lock();
-			pThread->threadstatus = TH_STAT_DOWN;
-			pThread->running = false;
+			pThread->running.store(false , std::memory_order_release);
+			pThread->setThreadState(TH_STAT_DOWN);
 			pThread->mutex.unlock();
 			return (void *)0;
 		}
@@ -201,6 +524,10 @@ namespace VSTD
 	 * 				ラッピングしたonFunctionをスレッドとして実行します。
 	 * 				また、引数Dataに値を与える事でスレッドに対して値を渡す事も
 	 * 				可能となります。
+	 * 				自動解放が指定されたThreadFunctionは処理完了後に破棄されます。
+	 * 				実行中に再度積み上げられた場合は完了とせず、破棄もしません。
+	 * 				集約モードの場合は実行中の積み上げは待ち行列に追加されない為、
+	 * 				ここで積み直し、積み直せない場合はそのまま再度実行します。
 	 * @return		成否を返却します。
 	 * @retval		true ： 成功
 	 * @retval		false： 失敗
@@ -213,10 +540,26 @@ namespace VSTD
 		try
 		{
 			ThreadFunction *Func = (ThreadFunction *)Data;
-			Func->setStatus(THFUNC_STATE_PROCESSED);
-			retVal = Func->Function();
-			Func->setStatus(THFUNC_STATE_COMLETED);
-			return retVal;
+			while (true)
+			{
+				bool completed;
+				retVal = Func->execute(&completed);
+				/* 実行中に再度積み上げられていなければ完了(自動解放済み) */
+				if (completed)
+				{
+					return retVal;
+				}
+				/* 集約モード以外は待ち行列に追加済み */
+				if (!retVal || !coalescing.load(std::memory_order_relaxed))
+				{
+					return retVal;
+				}
+				if (push((void *)Func , NULL , ProcessTenant))
+				{
+					signal();
+					return retVal;
+				}
+			}
 		}
 		catch(...)
 		{
@@ -239,51 +582,52 @@ namespace VSTD
 		return true;
 	}
 	/**
-	 * @brief		setFunction
-	 * 				ThreadFunctionの積み上げ
-	 * @note		待ち行列にThreadFunctionオブジェクトを追加し
-	 * 				条件変数にて待機状態を設定します。
-	 * @param[in]	Func：追加するTHreadFunctionオブジェクトを指定
+	 * @brief		onFunction
+	 * 				メッセージ受信用仮想ファンクション
+	 * @note		postにて積み上げられたメッセージ毎に呼び出されます。
+	 * 				dataはメッセージ用リング上の領域を指し、呼び出し完了後に
+	 * 				解放される為、保持する場合は複製してください。
+	 * 				post<T>にて積み上げた場合はT型の値を指し、lenはsizeof(T)です。
+	 * @param[in]	data：メッセージ本体
+	 * @param[in]	len：メッセージの長さ
 	 * @return	成否を返却します。
 	 * @retval	true ： 成功
-	 * @retval	false： 失敗
+	 * @retval	false： 失敗(スレッドを停止します)
 	 * @author	Sebastian
-	 * @date		2009/7/16
+	 * @date		2026/10/19
 	 */
-	bool ThreadCall::setFunction(ThreadFunction *Func)
+	bool ThreadCall::onFunction(const void * /* data */ , size_t /* len */)
+	{
+		return true;
+	}
+	/**
+	 * @brief		onFunctions
+	 * 				まとめて実行する為の仮想ファンクション
+	 * @note		setBatchSizeにて2以上を指定した場合、待ち行列から
+	 * 				まとめて取り出したデータが取り出した順に引き渡されます。
+	 * 				既定では各データに対してonFunctionを呼び出します。
+	 * 				ThreadCallをラッピングし本メソッドを実装する事で
+	 * 				一括登録等、複数のデータに対する処理をまとめて行えます。
+	 * 				実行期限切れのデータは含まれず、onExpiredへ引き渡されます。
+	 * @param[in]	items：取り出したデータ
+	 * @param[in]	num：データの数(1以上、バッチサイズ以下)
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(スレッドを停止します。残りのデータは実行されません)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::onFunctions(void ** items , size_t num)
 	{
-		pthread_t id;
 		try
 		{
-			/* ***************************************************************
-			 * 実行種別がイベントドリブン型である事を確認
-			 * ***************************************************************/
-			mutex.lock();
-			if (threadtype != TH_TYP_EVENTDRIVEN)
-			{
-				mutex.unlock();
-				threadCondition	|= 	TH_ERR_ILLEGAL_USE_COND;
-				threadstatus		=	TH_STAT_FAULT;
-				return false;
-			}
-			mutex.unlock();
-			/* ***************************************************************
-			 * スレッドファンクションをキューにスタックする
-			 * ***************************************************************/
-			/* スレッドIDの取得 */
-			getThreadId(&id);
-			/* スレッドファンクションにスレッドIDを指定 */
-			Func->setThreadId(&id);
-			/* スレッドファンクションの待ち行列にキューを追加 */
-			if (!push((void *)Func))
+			for (size_t i = 0 ; i < num ; i++)
 			{
-				return false;
+				if (!onFunction(items[i]))
+				{
+					return false;
+				}
 			}
-			/* ***************************************************************
-			 * スレッドファンクションをシグナル待ち待機状態に指定
-			 * ***************************************************************/
-			Func->setStatus(THFUNC_STATE_WAITING);
-			condition.set();
 			return true;
 		}
 		catch(...)
@@ -292,35 +636,32 @@ namespace VSTD
 		}
 	}
 	/**
-	 * @brief		setFunction
-	 * 				ThreadFunction用のデータの積み上げ
-	 * @note		待ち行列にThreadFunctionオブジェクトが
-	 * 				使用するデータを追加して積み上げます。
-	 * @param[in]	Data：追加するThreadFunctionオブジェクトを指定
-	 * @return	成否を返却します。
-	 * @retval	true ： 成功
-	 * @retval	false： 失敗
-	 * @author	Sebastian
-	 * @date		2009/7/16
+	 * @brief		onExpired
+	 * 				実行期限切れ通知用仮想ファンクション
+	 * @note		取り出した時点で実行期限を過ぎていたデータは
+	 * 				onFunctionを呼び出さずに本メソッドへ引き渡されます。
+	 * 				既定ではThreadFunctionを実行期限切れ状態にして破棄します。
+	 * 				自動解放が指定されたThreadFunctionはdeleteされます。
+	 * 				ThreadCallをラッピングし本メソッドを実装する事で
+	 * 				期限切れのデータを別の処理へ振り替える事が可能となります。
+	 * @param[in]	Data：期限切れとなったデータが指定されます。
+	 * @return		成否を返却します。
+	 * @retval		true ： 成功
+	 * @retval		false： 失敗(スレッドを停止します)
+	 * @author		Sebastian
+	 * @date		2026/10/19
 	 */
-	 bool ThreadCall::setFunction(void * Data)
+	bool ThreadCall::onExpired(void * Data)
 	{
-		 try
-		 {
-			mutex.lock();
-			if (threadtype != TH_TYP_EVENTDRIVEN)
-			{
-				mutex.unlock();
-				threadCondition |= TH_ERR_ILLEGAL_USE_COND;
-				threadstatus = TH_STAT_FAULT;
-				return false;
-			}
-			mutex.unlock();
-			if (! push(Data))
+		try
+		{
+			ThreadFunction *Func = (ThreadFunction *)Data;
+			bool release = Func->isAutoRelease();
+			Func->setStatus(THFUNC_STATE_EXPIRED);
+			if (release)
 			{
-				return false;
+				delete Func;
 			}
-			condition.set();
 			return true;
 		}
 		catch(...)
@@ -329,65 +670,29 @@ namespace VSTD
 		}
 	}
 	/**
-	 * @brief		signalRunning
-	 * @note		待ち行列に積まれたThreadFunctionのキューを逐次実行
-	 * @return	成否を返却します。
-	 * @retval	true ： 成功
-	 * @retval	false： 失敗
-	 * @author	Sebastian
-	 * @date		2009/7/16
+	 * @brief		onThreadStart
+	 * 				スレッド開始時の処理
+	 * @note		スレッド上で初回の実行前に一度だけ呼び出されます。
+	 * 				setThreadContextにて生成処理が指定されている場合は
+	 * 				コンテキストを生成します。
+	 * 				ラッピングする場合は先頭で呼び出してください。
+	 * @return		成否を返却します。
+	 * @retval		true ： 成功
+	 * @retval		false： 失敗(スレッドを停止します)
+	 * @author		Sebastian
+	 * @date		2026/10/19
 	 */
-	bool ThreadCall::signalRunning()
+	bool ThreadCall::onThreadStart()
 	{
 		try
 		{
-			/* ミューテックスを取得 */
 			mutex.lock();
-			/* ステータスを実行中に指定 */
-			threadstatus = TH_STAT_BUSY;
-			/* 多重実行回避処理 */
-			if (!running)
-			{
-				threadstatus = TH_STAT_SHUTDOWN;
-				mutex.unlock();
-				return false;
-			}
-			/* ミューテックスの開放 */
+			ThreadContextCreate_t create = contextCreate;
 			mutex.unlock();
-			/* 待機しているキューが空で無い場合 */
-			if (!empty())
-			{
-				/* 条件変数が空になるまで実行 */
-				while (!empty())
-				{
-					pop();
-					if (!onFunction(ProcessQueue))
-					{
-						mutex.lock();
-						ProcessQueue = NULL;
-						threadstatus = TH_STAT_SHUTDOWN;
-						mutex.unlock();
-						return false;
-					}
-				}
-				mutex.lock();
-				ProcessQueue = NULL;
-				threadstatus = TH_STAT_WAIT;
-			}
-			/* 待機しているキューが空の場合 */
-			else
+			if (create)
 			{
-				if (!onFunction())
-				{
-					mutex.lock();
-					threadstatus = TH_STAT_SHUTDOWN;
-					mutex.unlock();
-					return false;
-				}
-				mutex.lock();
-				threadstatus = TH_STAT_WAIT;
+				threadContext = create(this);
 			}
-			mutex.unlock();
 			return true;
 		}
 		catch(...)
@@ -396,21 +701,27 @@ namespace VSTD
 		}
 	}
 	/**
-	 * @brief		getThreadFunctions
-	 * 				現在待機中のThreadFunctionの数を取得します
-	 * @return	ThreadFunctionの数を返却します。
-	 * @author	Sebastian
-	 * @date		2009/7/13
+	 * @brief		onThreadExit
+	 * 				スレッド終了時の処理
+	 * @note		onThreadStartを呼び出したスレッドの終了時に、
+	 * 				スレッド上で一度だけ呼び出されます。
+	 * 				コンテキストが生成されている場合は破棄します。
+	 * 				ラッピングする場合は末尾で呼び出してください。
+	 * @author		Sebastian
+	 * @date		2026/10/19
 	 */
-	unsigned int ThreadCall::getThreadFunctions()
+	void ThreadCall::onThreadExit()
 	{
-		unsigned int chEventsWaiting;
 		try
 		{
 			mutex.lock();
-			chEventsWaiting = currentThreadQueue;
+			ThreadContextDestroy_t destroy = contextDestroy;
 			mutex.unlock();
-			return chEventsWaiting;
+			if (destroy && threadContext)
+			{
+				destroy(threadContext);
+			}
+			threadContext = NULL;
 		}
 		catch(...)
 		{
@@ -418,19 +729,438 @@ namespace VSTD
 		}
 	}
 	/**
-	 * @brief		setThreadtype
-	 * 				スレッドの実行種別を変更します。
-	 * @param[in]	type：スレッドの実行種別を指定します。
-	 * 				Defaultでイベントドリブン型(TH_TYP_EVENTDRIVEN)
-	 * @param[in]	idel：スレッドのアイドル時間を指定します。
-	 * 				Defaultで100milli秒
+	 * @brief		setFunction
+	 * 				ThreadFunctionの積み上げ
+	 * @note		待ち行列にThreadFunctionオブジェクトを追加し
+	 * 				条件変数にて待機状態を設定します。
+	 * @param[in]	Func：追加するTHreadFunctionオブジェクトを指定
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
 	 * @author	Sebastian
 	 * @date		2009/7/16
 	 */
-	void ThreadCall::setThreadType(ThreadType_t type , long idle)
+	bool ThreadCall::setFunction(ThreadFunction *Func)
 	{
-		try
-		{
+		return setFunction(Func , (const struct timespec *)NULL);
+	}
+	/**
+	 * @brief		setFunction
+	 * 				実行期限付きThreadFunctionの積み上げ
+	 * @note		待ち行列にThreadFunctionオブジェクトを実行期限付きで追加し
+	 * 				条件変数にて待機状態を設定します。
+	 * 				取り出した時点で実行期限を過ぎている場合は実行されずに
+	 * 				onExpiredへ引き渡されます。
+	 * @param[in]	Func：追加するTHreadFunctionオブジェクトを指定
+	 * @param[in]	deadline：実行期限(CLOCK_MONOTONIC)を指定。NULLの場合は期限無し
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::setFunction(ThreadFunction *Func , const struct timespec * deadline)
+	{
+		return setTenantFunction(TH_TENANT_DEFAULT , Func , deadline);
+	}
+	/**
+	 * @brief		setTenantFunction
+	 * 				テナントを指定したThreadFunctionの積み上げ
+	 * @note		スケジューリング種別がTH_SCHED_FAIRの場合、
+	 * 				指定されたテナントの待ち行列にThreadFunctionを追加します。
+	 * 				テナントの待ち行列が最大数に達している場合は失敗します。
+	 * 				TH_SCHED_FAIR以外の場合はテナントの指定は無視されます。
+	 * 				集約モード(setCoalescing)の場合、既に実行待ちの
+	 * 				ThreadFunctionは待ち行列に追加せずに成功とします。
+	 * @param[in]	tenant：addTenantにて登録したテナントIDを指定
+	 * @param[in]	Func：追加するTHreadFunctionオブジェクトを指定
+	 * @param[in]	deadline：実行期限(CLOCK_MONOTONIC)を指定。NULLの場合は期限無し
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::setTenantFunction(
+						int						tenant
+					,	ThreadFunction *		Func
+					,	const struct timespec *	deadline
+									)
+	{
+		pthread_t id;
+		functionstatus_t previous = THFUNC_STATE_NOTSUBMITTED;
+		bool coalesce = coalescing.load(std::memory_order_relaxed);
+		try
+		{
+			/* ***************************************************************
+			 * 集約モードの場合は実行待ちへの遷移を先に行い、
+			 * 既に実行待ちの場合は積み上げを省略する
+			 * ***************************************************************/
+			if (coalesce && !Func->markWaiting(&previous))
+			{
+				coalescedFunctions.fetch_add(1 , std::memory_order_relaxed);
+				return true;
+			}
+			/* 実行中の場合は完了時にonFunctionにて積み直される */
+			if (coalesce && previous == THFUNC_STATE_PROCESSED)
+			{
+				coalescedFunctions.fetch_add(1 , std::memory_order_relaxed);
+				return true;
+			}
+			/* ***************************************************************
+			 * 待ち行列に追加した時点でワーカーが実行・解放し得る為、
+			 * 実行待ちへの遷移は追加前に行い、失敗時に元に戻す
+			 * ***************************************************************/
+			if (!coalesce)
+			{
+				previous = Func->getStatus();
+				Func->setStatus(THFUNC_STATE_WAITING);
+			}
+			/* ***************************************************************
+			 * 生産者毎のバッファを使用する場合はミューテックスを取得せずに格納
+			 * ***************************************************************/
+			if (isProducerBuffered(deadline))
+			{
+				getThreadId(&id);
+				Func->setThreadId(&id);
+				if (!bufferFunction((void *)Func , true))
+				{
+					Func->setStatus(previous);
+					return false;
+				}
+				return true;
+			}
+			/* ***************************************************************
+			 * 実行種別がインターバル型でない事を確認
+			 * ***************************************************************/
+			mutex.lock();
+			if (threadtype == TH_TYP_INTERVAL)
+			{
+				mutex.unlock();
+				Func->setStatus(previous);
+				threadCondition	|= 	TH_ERR_ILLEGAL_USE_COND;
+				setThreadState(TH_STAT_FAULT);
+				return false;
+			}
+			/* ジャーナル使用時はオブジェクトを記録出来ない為、積み上げ不可 */
+			if (journal)
+			{
+				mutex.unlock();
+				Func->setStatus(previous);
+				threadCondition	|= 	TH_ERR_ILLEGAL_USE_COND;
+				return false;
+			}
+			mutex.unlock();
+			/* ***************************************************************
+			 * スレッドファンクションをキューにスタックする
+			 * ***************************************************************/
+			/* スレッドIDの取得 */
+			getThreadId(&id);
+			/* スレッドファンクションにスレッドIDを指定 */
+			Func->setThreadId(&id);
+			/* スレッドファンクションの待ち行列にキューを追加 */
+			if (!push((void *)Func , deadline , tenant))
+			{
+				Func->setStatus(previous);
+				return false;
+			}
+			signal();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setFunction
+	 * 				ThreadFunction用のデータの積み上げ
+	 * @note		待ち行列にThreadFunctionオブジェクトが
+	 * 				使用するデータを追加して積み上げます。
+	 * @param[in]	Data：追加するThreadFunctionオブジェクトを指定
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2009/7/16
+	 */
+	 bool ThreadCall::setFunction(void * Data)
+	{
+		return setFunction(Data , (const struct timespec *)NULL);
+	}
+	/**
+	 * @brief		setFunction
+	 * 				実行期限付きデータの積み上げ
+	 * @note		待ち行列にデータを実行期限付きで追加して積み上げます。
+	 * @param[in]	Data：追加するデータを指定
+	 * @param[in]	deadline：実行期限(CLOCK_MONOTONIC)を指定。NULLの場合は期限無し
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	 bool ThreadCall::setFunction(void * Data , const struct timespec * deadline)
+	{
+		return setTenantFunction(TH_TENANT_DEFAULT , Data , deadline);
+	}
+	/**
+	 * @brief		setTenantFunction
+	 * 				テナントを指定したデータの積み上げ
+	 * @note		スケジューリング種別がTH_SCHED_FAIRの場合、
+	 * 				指定されたテナントの待ち行列にデータを追加します。
+	 * 				TH_SCHED_FAIR以外の場合はテナントの指定は無視されます。
+	 * 				ジャーナル使用時はデータをジャーナルへ複製し、
+	 * 				複製を積み上げます。
+	 * @param[in]	tenant：addTenantにて登録したテナントIDを指定
+	 * @param[in]	Data：追加するデータを指定
+	 * @param[in]	deadline：実行期限(CLOCK_MONOTONIC)を指定。NULLの場合は期限無し
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	 bool ThreadCall::setTenantFunction(
+						int						tenant
+					,	void *					Data
+					,	const struct timespec *	deadline
+									)
+	{
+		 try
+		 {
+			/* 生産者毎のバッファを使用する場合はミューテックスを取得せずに格納 */
+			if (Data && isProducerBuffered(deadline))
+			{
+				return bufferFunction(Data , false);
+			}
+			mutex.lock();
+			if (threadtype == TH_TYP_INTERVAL)
+			{
+				mutex.unlock();
+				threadCondition |= TH_ERR_ILLEGAL_USE_COND;
+				setThreadState(TH_STAT_FAULT);
+				return false;
+			}
+			Journal *	journaled	= journal;
+			size_t		payload		= journalPayload;
+			mutex.unlock();
+			/* ジャーナル使用時は複製を記録してから積み上げる(NULLは停止の通知) */
+			void * item = Data;
+			if (journaled && Data)
+			{
+				item = journaled->append(Data , payload);
+				if (!item)
+				{
+					return false;
+				}
+			}
+			if (! push(item , deadline , tenant))
+			{
+				/* 積み上げに失敗した記録は完了とする */
+				if (journaled && item) journaled->complete(item);
+				/* 停止等の起床の通知は拒否された場合も行う */
+				if (!item) signal();
+				return false;
+			}
+			signal();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		signalRunning
+	 * @note		待ち行列に積まれたThreadFunctionのキューを逐次実行
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2009/7/16
+	 */
+	bool ThreadCall::signalRunning()
+	{
+		try
+		{
+			/* ミューテックスを取得 */
+			mutex.lock();
+			/* ステータスを実行中に指定 */
+			setThreadState(TH_STAT_BUSY);
+			/* 多重実行回避処理 */
+			if (!running)
+			{
+				setThreadState(TH_STAT_SHUTDOWN);
+				mutex.unlock();
+				return false;
+			}
+			unsigned int batch = batchSize;
+			Journal * journaled = journal;
+			/* ミューテックスの開放 */
+			mutex.unlock();
+			/* 待機しているキューが空で無い場合 */
+			if (!empty() || refillJournal(journaled))
+			{
+				/* 条件変数が空になるまで実行 */
+				while (!empty() || refillJournal(journaled))
+				{
+					/* ジャーナルの未完了データを待ち行列の空きに応じて補充 */
+					refillJournal(journaled);
+					/* 積み上げられたメッセージを実行 */
+					if (!runMessages())
+					{
+						mutex.lock();
+						ProcessQueue = NULL;
+						setThreadState(TH_STAT_SHUTDOWN);
+						mutex.unlock();
+						return false;
+					}
+					/* 生産者毎のバッファから公開されたものを実行 */
+					if (!runProducers())
+					{
+						mutex.lock();
+						ProcessQueue = NULL;
+						setThreadState(TH_STAT_SHUTDOWN);
+						mutex.unlock();
+						return false;
+					}
+					/* まとめて取り出して実行 */
+					if (batch > 1)
+					{
+						/* 流量制限中の場合は次の補充まで待機 */
+						if (!runBatch(batch) || !park())
+						{
+							mutex.lock();
+							setThreadState(TH_STAT_SHUTDOWN);
+							mutex.unlock();
+							return false;
+						}
+						continue;
+					}
+					if (!pop())
+					{
+						/* 流量制限中の場合は次の補充まで待機 */
+						if (!park())
+						{
+							mutex.lock();
+							ProcessQueue = NULL;
+							setThreadState(TH_STAT_SHUTDOWN);
+							mutex.unlock();
+							return false;
+						}
+						continue;
+					}
+					/* 実行期限を過ぎている場合は実行せずに破棄 */
+					if (isExpired(&ProcessDeadline))
+					{
+						mutex.lock();
+						expiredFunctions++;
+						if (threadschedule == TH_SCHED_FAIR)
+						{
+							ThreadTenant_t * t = findTenant(ProcessTenant);
+							if (t) t->expired++;
+						}
+						mutex.unlock();
+						void * item = ProcessQueue;
+						bool expired = onExpired(item);
+						if (journaled) journaled->complete(item);
+						if (!expired)
+						{
+							mutex.lock();
+							ProcessQueue = NULL;
+							setThreadState(TH_STAT_SHUTDOWN);
+							mutex.unlock();
+							return false;
+						}
+						continue;
+					}
+					void * item = ProcessQueue;
+					beginBusy();
+					bool result = onFunction(item);
+					endBusy();
+					/* 実行後に完了を記録(異常終了時は再実行される) */
+					if (journaled) journaled->complete(item);
+					if (!result)
+					{
+						mutex.lock();
+						ProcessQueue = NULL;
+						setThreadState(TH_STAT_SHUTDOWN);
+						mutex.unlock();
+						return false;
+					}
+				}
+				/* 待ち行列が空になった為、過負荷を解除 */
+				overloadSince = 0;
+				overloaded.store(false , std::memory_order_relaxed);
+				mutex.lock();
+				ProcessQueue = NULL;
+				setThreadState(TH_STAT_WAIT);
+			}
+			/* 待機しているキューが空の場合 */
+			else
+			{
+				beginBusy();
+				bool result = onFunction();
+				endBusy();
+				if (!result)
+				{
+					mutex.lock();
+					setThreadState(TH_STAT_SHUTDOWN);
+					mutex.unlock();
+					return false;
+				}
+				mutex.lock();
+				setThreadState(TH_STAT_WAIT);
+			}
+			mutex.unlock();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getThreadFunctions
+	 * 				現在待機中のThreadFunctionの数を取得します
+	 * @return	ThreadFunctionの数を返却します。
+	 * @author	Sebastian
+	 * @date		2009/7/13
+	 */
+	unsigned int ThreadCall::getThreadFunctions()
+	{
+		unsigned int chEventsWaiting;
+		try
+		{
+			chEventsWaiting = currentThreadQueue.load(std::memory_order_acquire);
+			return chEventsWaiting;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setThreadtype
+	 * 				スレッドの実行種別を変更します。
+	 * @param[in]	type：スレッドの実行種別を指定します。
+	 * 				Defaultでイベントドリブン型(TH_TYP_EVENTDRIVEN)
+	 * @param[in]	idel：スレッドのアイドル時間を指定します。
+	 * 				Defaultで100milli秒
+	 * @author	Sebastian
+	 * @date		2009/7/16
+	 */
+	void ThreadCall::setThreadType(ThreadType_t type , long idle)
+	{
+		try
+		{
+			/* ファイルディスクリプタ監視の作成 */
+			if (type == TH_TYP_REACTOR && !getReactor())
+			{
+				threadCondition |= TH_ERR_ILLEGAL_USE_COND;
+				return;
+			}
 			/* ミューテックスの取得 */
 			mutex.lock();
 			threadIdle = idle;
@@ -442,6 +1172,11 @@ namespace VSTD
 			threadtype = type;
 			/* ミューテックスの解放 */
 			mutex.unlock();
+			/* 待機中のepollを起床 */
+			if (reactor)
+			{
+				reactor->notify();
+			}
 			/* シグナル状態に設定 */
 			condition.set();
 		}
@@ -463,25 +1198,15 @@ namespace VSTD
 		{
 			/* 実行フラグの変更 */
 			mutex.lock();
-			running = false;
+			running.store(false , std::memory_order_release);
 			mutex.unlock();
+			/* 流量制限により待機中の場合は起床 */
+			unpark();
 			setFunction();
 			/* *******************************************************************
-			 * スレッドの終了までアイドリング
+			 * スレッドの終了まで待機
 			 * *******************************************************************/
-			Sleep(threadIdle);
-			while(true)
-			{
-				/* スレッドがシャットダウンするまでアイドリングを続ける */
-				mutex.lock();
-				if (threadstatus == TH_STAT_DOWN)
-				{
-					mutex.unlock();
-					return;
-				}
-				mutex.unlock();
-				Sleep(threadIdle);
-			}
+			waitState(1u << TH_STAT_DOWN , 0);
 		}
 		catch(...)
 		{
@@ -573,6 +1298,12 @@ namespace VSTD
 				return true;
 			}
 			mutex.unlock();
+			/* 停止済みのスレッドを回収 */
+			join();
+			/* 生成直後のstart/stopと競合しない様、生成前に実行中とする */
+			mutex.lock();
+			running.store(true , std::memory_order_release);
+			mutex.unlock();
 			/* スレッドコンディションの設定 */
 			if (threadCondition & TH_ERR_THREAD_CREATE)
 			{
@@ -593,8 +1324,9 @@ namespace VSTD
 			 * *******************************************************************/
 			if (result != 0)
 			{
+				running.store(false , std::memory_order_release);
 				threadCondition	|=	TH_ERR_THREAD_CREATE;
-				threadstatus		=	TH_STAT_FAULT;
+				setThreadState(TH_STAT_FAULT);
 				switch(result)
 				{
 				case EINVAL:
@@ -616,6 +1348,12 @@ namespace VSTD
 				}
 				return false;
 			}
+			joinable = true;
+			/* レジストリへ登録 */
+			if (!registered && ThreadRegistry::getInstance()->isEnabled())
+			{
+				registered = ThreadRegistry::getInstance()->add(this);
+			}
 			return true;
 		}
 		catch(...)
@@ -623,9 +1361,33 @@ namespace VSTD
 			throw;
 		}
 	}
+	/**
+	 * @brief		join
+	 * 				停止したスレッドの回収
+	 * @note		startにて作成したスレッドをpthread_joinにて回収します。
+	 * 				スレッドが停止していない場合は停止まで待機します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::join()
+	{
+		void * result;
+		if (!joinable) return;
+		/* 自スレッドからの呼び出しは回収出来ない */
+		if (pthread_equal(threadhandle , pthread_self()))
+		{
+			pthread_detach(threadhandle);
+		}
+		else
+		{
+			pthread_join(threadhandle , &result);
+		}
+		joinable = false;
+	}
 	/**
 	 * @brief		getThreadStatus
 	 * 				スレッドステータス取得
+	 * @note		ミューテックスを取得せずに1回の読み込みで取得します。
 	 * @return	現在のスレッド状態を返却します。
 	 * @author	Sebastian
 	 * @date		2009/7/16
@@ -634,11 +1396,7 @@ namespace VSTD
 	{
 		try
 		{
-			ThreadState_t	retval;
-			mutex.lock();
-			retval = threadstatus;
-			mutex.unlock();
-			return retval;
+			return threadstatus.load(std::memory_order_acquire);
 		}
 		catch(...)
 		{
@@ -649,9 +1407,8 @@ namespace VSTD
 	 * @brief		isThreadRunning
 	 * 				スレッドの実行中確認する
 	 * @note		指定したタイムアウトが訪れるまで
-	 * 				アイドリングとミューテックスの取得を繰り返しながら
-	 * 				実行中フラグの取得を行う。
-	 * @param[in]	timeout：タイムアウト時間を指定
+	 * 				スレッドが実行中(TH_STAT_WAIT/TH_STAT_BUSY)となるのを待機する。
+	 * @param[in]	timeout：タイムアウト時間をミリ秒にて指定。0の場合は無期限
 	 * @return	確認結果を返却
 	 * @retval	true ：スレッド実行中
 	 * @retval	false：スレッドは実行していない
@@ -660,35 +1417,37 @@ namespace VSTD
 	 */
 	bool ThreadCall::isThreadRunning(long timeout)
 	{
-		long total = 0;
 		try
 		{
-			/* *******************************************************************
-			 * アイドリングしながら実行中フラグの取得
-			 * *******************************************************************/
-			while(true)
-			{
-				/* タイムアウト処理 */
-				if (total > timeout && timeout > 0)
-				{
-					return false;
-				}
-				/* ミューテックスの取得 */
-				mutex.lock();
-				if (running)
-				{
-					/* 実行中と判断 */
-					mutex.unlock();
-					return true;
-				}
-				/* 現在のアイドリング時間の総計を計算 */
-				total += threadIdle;
-				/* ミューテックスの解放 */
-				mutex.unlock();
-				/* アイドリング */
-				Sleep(threadIdle);
-			}
-			return false;
+			return waitState(
+						(1u << TH_STAT_WAIT) | (1u << TH_STAT_BUSY)
+					,	(long long)timeout * 1000000LL
+						);
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		waitThreadState
+	 * 				スレッドの状態遷移の待機
+	 * @note		スレッドが指定した状態となるまで待機します。
+	 * 				状態の変更時にfutexにて起床される為、遷移後直ちに戻ります。
+	 * 				既に指定した状態の場合は待機しません。
+	 * @param[in]	state：待機する状態を指定します。
+	 * @param[in]	timeoutNs：タイムアウトをナノ秒にて指定。0の場合は無期限
+	 * @return	確認結果を返却
+	 * @retval	true ：指定した状態となった
+	 * @retval	false：タイムアウト
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::waitThreadState(ThreadState_t state , long long timeoutNs)
+	{
+		try
+		{
+			return waitState(1u << state , timeoutNs);
 		}
 		catch(...)
 		{
@@ -723,34 +1482,146 @@ namespace VSTD
 	 */
 	long ThreadCall::getObjectCondition()
 	{
+		if (overloaded.load(std::memory_order_relaxed))
+		{
+			return threadCondition | TH_ERR_OVERLOADED;
+		}
 		return threadCondition;
 	}
-	/* ***************************************************************************
-	 *
-	 * プライベートメソッド
-	 *
-	 ****************************************************************************/
 	/**
-	 * @brief		empty
-	 * 				待機中のスレッドファンクションの有無を確認
-	 * @return	スレッドファンクションの有無を返却
-	 * @retval	true:現在待機中のものは存在しない
-	 * @retval	false:待機中である
+	 * @brief		getMonitorStat
+	 * 				監視用の統計情報を取得します。
+	 * @note		ミューテックスを取得しない為、実行中のスレッドを
+	 * 				妨げずに取得出来ます。
+	 * @param[out]	stat：統計情報を格納します。
 	 * @author	Sebastian
-	 * @date		2009/7/16
+	 * @date		2026/10/19
 	 */
-	bool ThreadCall::empty()
+	void ThreadCall::getMonitorStat(ThreadMonitorStat_t * stat)
+	{
+		stat->processed	= processedFunctions.load(std::memory_order_relaxed);
+		stat->totalWait	= totalWait.load(std::memory_order_relaxed);
+		stat->maxWait		= maxWait.load(std::memory_order_relaxed);
+		stat->busySince	= busySince.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		setRegistryGroup
+	 * 				レジストリでのグループを設定します。
+	 * @note		同一のグループに属するThreadCallは同等の処理を行うものとして
+	 * 				ThreadRegistry::rebalanceにて待ち行列が再配分されます。
+	 * 				0の場合は再配分の対象外となります。
+	 * @param[in]	group：グループを指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::setRegistryGroup(int group)
+	{
+		mutex.lock();
+		registryGroup = group;
+		mutex.unlock();
+	}
+	/**
+	 * @brief		getRegistryGroup
+	 * 				レジストリでのグループを取得します。
+	 * @return	グループを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	int ThreadCall::getRegistryGroup()
+	{
+		int group;
+		mutex.lock();
+		group = registryGroup;
+		mutex.unlock();
+		return group;
+	}
+	/**
+	 * @brief		setScheduleType
+	 * 				待ち行列のスケジューリング種別を変更します。
+	 * @note		TH_SCHED_DEADLINEを指定した場合、待ち行列は実行期限の
+	 * 				最も早いものから取り出されます(EDF)。
+	 * 				実行期限の無いデータは期限付きのデータの後に実行されます。
+	 * 				TH_SCHED_FAIRを指定した場合、待ち行列はテナント毎に分割され
+	 * 				重みに従ったDeficit Round Robinにて取り出されます。
+	 * 				テナント未指定のデータは既定のテナント(TH_TENANT_DEFAULT)に
+	 * 				積み上げられます。
+	 * 				既定のテナントの待ち行列に積まれているデータが
+	 * 				収まらない場合は変更せずに失敗を返却します。
+	 * @param[in]	type：スケジューリング種別を指定します。
+	 * 				DefaultでTH_SCHED_LIFO
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::setScheduleType(ThreadSchedule_t type)
 	{
 		try
 		{
 			mutex.lock();
-			if (currentThreadQueue <= 0)
+			if (threadschedule == type)
 			{
 				mutex.unlock();
 				return true;
 			}
+			/* 共通の待ち行列を既定のテナントへ移動出来るかを先に確認 */
+			if (type == TH_SCHED_FAIR)
+			{
+				ThreadTenant_t * t = findTenant(TH_TENANT_DEFAULT);
+				if (!t)
+				{
+					/* 積まれているデータが収まる様に既定の最大数を拡張 */
+					unsigned int depth = TH_TENANT_DEPTH;
+					if (depth < currentThreadQueue) depth = currentThreadQueue;
+					t = createTenant(TH_TENANT_DEFAULT , 1 , depth);
+				}
+				if (!t || t->depth - t->count < currentThreadQueue)
+				{
+					mutex.unlock();
+					return false;
+				}
+			}
+			/* テナントの待ち行列から共通の待ち行列へ戻す */
+			if (threadschedule == TH_SCHED_FAIR)
+			{
+				unsigned int n = 0;
+				for (unsigned int i = 0 ; i < tenantCount ; i++)
+				{
+					ThreadTenant_t * t = tenants[i];
+					for (; t->count > 0 ; t->count--)
+					{
+						threadQueue[n++] = t->queue[t->head];
+						t->head = (t->head + 1) % t->depth;
+					}
+					t->head		= 0;
+					t->deficit	= 0;
+				}
+				tenantCursor	= 0;
+				tenantTurn	= false;
+			}
+			/* 共通の待ち行列を既定のテナントへ移動 */
+			if (type == TH_SCHED_FAIR)
+			{
+				ThreadTenant_t * t = findTenant(TH_TENANT_DEFAULT);
+				for (unsigned int i = 0 ; i < currentThreadQueue ; i++)
+				{
+					t->queue[(t->head + t->count) % t->depth] = threadQueue[i];
+					t->count++;
+				}
+			}
+			threadschedule = type;
+			producerExcluded.store(type == TH_SCHED_FAIR || journal != NULL , std::memory_order_release);
+			/* 積まれている待ち行列をヒープに再構成 */
+			if (type == TH_SCHED_DEADLINE)
+			{
+				for (unsigned int i = currentThreadQueue / 2 ; i > 0 ; i--)
+				{
+					heapDown(i - 1);
+				}
+			}
 			mutex.unlock();
-			return false;
+			return true;
 		}
 		catch(...)
 		{
@@ -758,30 +1629,21 @@ namespace VSTD
 		}
 	}
 	/**
-	 * @brief		push
-	 * 				ThreadFunctionを追加
-	 * @param[in]	FuncQue 追加するThreadFunctionを指定
-	 * @return	処理の成否を返却
-	 * @retval	true:成功
-	 * @retval	false:失敗
+	 * @brief		getScheduleType
+	 * 				待ち行列のスケジューリング種別を取得します。
+	 * @return	スケジューリング種別を返却します。
 	 * @author	Sebastian
-	 * @date		2009/7/16
+	 * @date		2026/10/19
 	 */
-	bool ThreadCall::push(void * FuncQue)
+	ThreadSchedule_t ThreadCall::getScheduleType()
 	{
 		try
 		{
-			if (!FuncQue) return true;
-
+			ThreadSchedule_t	retval;
 			mutex.lock();
-			if (currentThreadQueue + 1 >= threadQueDepath)
-			{
-				mutex.unlock();
-				return false;
-			}
-			threadQueue[currentThreadQueue++] = FuncQue;
+			retval = threadschedule;
 			mutex.unlock();
-			return true;
+			return retval;
 		}
 		catch(...)
 		{
@@ -789,30 +1651,201 @@ namespace VSTD
 		}
 	}
 	/**
-	 * @brief		pop
-	 * 				ThreadFunctionを取得
-	 * @note		pushメソッドにて積み上げられたThreadFunctionを
-	 * 				末尾から一つ取り出す。
-	 * @return	処理の成否を返却
-	 * @retval	true:成功
-	 * @retval	false:失敗
+	 * @brief		setBatchSize
+	 * 				まとめて実行する最大数の設定
+	 * @note		2以上を指定した場合、待ち行列から最大で指定した数を
+	 * 				一度に取り出しonFunctionsへ引き渡します。
+	 * 				1の場合は従来通り一つずつonFunctionを呼び出します。
+	 * @param[in]	size：最大数を指定(1～MAX_BATCH)
 	 * @author	Sebastian
-	 * @date		2009/7/16
+	 * @date		2026/10/19
 	 */
-	bool ThreadCall::pop()
+	void ThreadCall::setBatchSize(unsigned int size)
+	{
+		try
+		{
+			if (size < 1) size = 1;
+			if (size > MAX_BATCH) size = MAX_BATCH;
+			mutex.lock();
+			batchSize = size;
+			mutex.unlock();
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getBatchSize
+	 * 				まとめて実行する最大数の取得
+	 * @return	最大数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int ThreadCall::getBatchSize()
+	{
+		try
+		{
+			unsigned int	retval;
+			mutex.lock();
+			retval = batchSize;
+			mutex.unlock();
+			return retval;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getExpiredFunctions
+	 * 				実行期限切れにより破棄された数を取得します。
+	 * @return	破棄された数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned long ThreadCall::getExpiredFunctions()
+	{
+		try
+		{
+			unsigned long	retval;
+			mutex.lock();
+			retval = expiredFunctions;
+			mutex.unlock();
+			return retval;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setCoalescing
+	 * 				積み上げの集約の設定
+	 * @note		trueを指定した場合、実行待ち(THFUNC_STATE_WAITING)の
+	 * 				ThreadFunctionを再度積み上げてもCAS一回のみで成功とし、
+	 * 				同じオブジェクトが待ち行列に入るのは一つまでとなります。
+	 * 				実行開始(THFUNC_STATE_PROCESSED)後の積み上げは
+	 * 				実行完了後に一度だけ積み直され、再度実行されます。
+	 * 				更新通知の様に最新の状態で一度実行されれば良い処理に使用します。
+	 * 				onFunctionをラッピングする場合はステータスを更新してください。
+	 * 				データ(void *)の積み上げは対象外です。
+	 * @param[in]	enable：集約するかを指定
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::setCoalescing(bool enable)
+	{
+		coalescing.store(enable , std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		isCoalescing
+	 * 				積み上げの集約の取得
+	 * @return	集約する場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::isCoalescing()
+	{
+		return coalescing.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		getCoalescedFunctions
+	 * 				集約により積み上げを省略した数を取得します。
+	 * @return	省略した数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned long ThreadCall::getCoalescedFunctions()
+	{
+		return coalescedFunctions.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		setAdmissionControl
+	 * 				待ち時間による受付制御の設定
+	 * @note		待ち行列の最大数に加えて、実際の待ち時間による受付制御を行います。
+	 * 				取り出した要素の待ち時間が目標を超え続けた状態が判定間隔を
+	 * 				経過した場合に過負荷とし、待ち行列が空になるか、待ち時間が
+	 * 				目標未満となるまで積み上げを即座に失敗させます。
+	 * 				過負荷中はgetObjectConditionにTH_ERR_OVERLOADEDが付加される為、
+	 * 				呼び出し側は失敗の理由を判別して他へ振り替える事が出来ます。
+	 * 				メッセージ(post)は対象外です。
+	 * @param[in]	target：待ち時間の目標(マイクロ秒)。0以下の場合は無効
+	 * @param[in]	interval：判定間隔(マイクロ秒)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::setAdmissionControl(long target , long interval)
+	{
+		if (interval < 0) interval = 0;
+		overloadInterval.store((long long)interval * 1000LL , std::memory_order_relaxed);
+		overloadTarget.store(target > 0 ? (long long)target * 1000LL : 0 , std::memory_order_relaxed);
+		if (target <= 0)
+		{
+			overloaded.store(false , std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		isOverloaded
+	 * 				過負荷の取得
+	 * @return	過負荷により積み上げを拒否中の場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::isOverloaded()
+	{
+		return overloaded.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		getShedFunctions
+	 * 				過負荷により積み上げを拒否した数を取得します。
+	 * @return	拒否した数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned long ThreadCall::getShedFunctions()
+	{
+		return shedFunctions.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		setJournal
+	 * 				ジャーナルの設定
+	 * @note		以降に積み上げたデータ(void *)を指定したサイズ分ジャーナルへ
+	 * 				複製して記録し、onFunction(void *)には複製を引き渡します。
+	 * 				onFunction/onExpiredの終了後に完了を記録する為、
+	 * 				異常終了時に未完了だったデータは次回の設定時に再実行されます。
+	 * 				完了の記録が書き出される前に異常終了した場合は完了済みの
+	 * 				データも再実行される場合があります(少なくとも一回)。
+	 * 				ThreadFunctionの積み上げは出来なくなる為、onFunction(void *)を
+	 * 				オーバーライドして使用してください。
+	 * 				待ち行列が空の状態で設定してください。
+	 * @param[in]	target：Journal::open済みのジャーナル。NULLの場合は記録を終了
+	 * @param[in]	payloadSize：記録するデータのサイズ(byte)
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(待ち行列が空で無い、またはサイズが不正)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::setJournal(Journal * target , size_t payloadSize)
 	{
 		try
 		{
+			if (target && payloadSize == 0)
+			{
+				return false;
+			}
 			mutex.lock();
-			if (currentThreadQueue-1 < 0)
+			if (currentThreadQueue.load(std::memory_order_relaxed) > 0)
 			{
-				currentThreadQueue = 0;
 				mutex.unlock();
 				return false;
 			}
-			currentThreadQueue--;
-			ProcessQueue = threadQueue[currentThreadQueue];
+			journal			= target;
+			journalPayload	= payloadSize;
+			producerExcluded.store(threadschedule == TH_SCHED_FAIR || target != NULL , std::memory_order_release);
 			mutex.unlock();
+			replayJournal();
 			return true;
 		}
 		catch(...)
@@ -820,4 +1853,1870 @@ namespace VSTD
 			throw;
 		}
 	}
+	/**
+	 * @brief		setProducerBuffer
+	 * 				生産者毎のバッファの設定
+	 * @note		sizeに1以上を指定した場合、実行期限を指定しない積み上げを
+	 * 				積み上げたスレッド毎のバッファへミューテックス無しで格納し、
+	 * 				満杯となった時点でまとめて一度のCASにて公開します。
+	 * 				満杯とならないバッファは最初の格納からintervalを経過した時点で
+	 * 				ワーカースレッドが公開する為、遅延はintervalに制限されます。
+	 * 				公開されたものはonFunctionsにてまとめて実行されます。
+	 * 				待ち行列・メッセージとの順序、及び生産者間の順序は保証しません。
+	 * 				TH_SCHED_FAIR、ジャーナル使用時、及び受付制御は対象外です。
+	 * 				公開済みで未実行の数がbacklogを超えた場合は積み上げに失敗します。
+	 * @param[in]	size：バッファのサイズ(0～MAX_PRODUCER_BUFFER)。0の場合は使用しない
+	 * @param[in]	interval：公開するまでの時間(マイクロ秒)
+	 * @param[in]	backlog：公開済みで未実行の最大数
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(サイズが不正)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::setProducerBuffer(unsigned int size , long interval , unsigned int backlog)
+	{
+		if (size > MAX_PRODUCER_BUFFER)
+		{
+			return false;
+		}
+		mutex.lock();
+		producerInterval	= (long long)(interval > 0 ? interval : TH_PRODUCER_INTERVAL) * 1000LL;
+		producerLimit		= backlog > 0 ? backlog : TH_PRODUCER_BACKLOG;
+		producerSize.store(size , std::memory_order_release);
+		mutex.unlock();
+		return true;
+	}
+	/**
+	 * @brief		flush
+	 * 				生産者毎のバッファの公開
+	 * @note		呼び出したスレッドのバッファに格納されているものを
+	 * 				満杯となるのを待たずに公開します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::flush()
+	{
+		ProducerBuffer_t * buffer = getProducerBuffer(false);
+		if (!buffer)
+		{
+			return;
+		}
+		ProducerBatch_t * batch = NULL;
+		lockBuffer(buffer);
+		if (buffer->batch && buffer->batch->count > 0)
+		{
+			batch			= buffer->batch;
+			buffer->batch	= NULL;
+		}
+		unlockBuffer(buffer);
+		if (batch)
+		{
+			publishBatch(batch , true);
+		}
+	}
+	/**
+	 * @brief		setThreadContext
+	 * 				スレッド毎のコンテキストの設定
+	 * @note		スレッドの開始時(onThreadStart)に生成処理を呼び出し、
+	 * 				終了時(onThreadExit)に破棄処理を呼び出します。
+	 * 				生成したコンテキストはスレッド上でgetThreadContextにて
+	 * 				ロック無しで取得出来る為、接続や作業領域等をスレッド毎に
+	 * 				保持する場合に使用します。
+	 * 				初回の積み上げ前(start前)に指定してください。
+	 * @param[in]	create：生成処理。NULLの場合は生成しない
+	 * @param[in]	destroy：破棄処理。NULLの場合は破棄しない
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::setThreadContext(ThreadContextCreate_t create , ThreadContextDestroy_t destroy)
+	{
+		mutex.lock();
+		contextCreate		= create;
+		contextDestroy	= destroy;
+		mutex.unlock();
+	}
+	/**
+	 * @brief		getThreadContext
+	 * 				スレッド毎のコンテキストの取得
+	 * @return	実行中のスレッドのコンテキストを返却します。
+	 * 			ThreadCallのスレッド以外、または未設定の場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * ThreadCall::getThreadContext()
+	{
+		return threadContext;
+	}
+	/**
+	 * @brief		getCurrentThread
+	 * 				実行中のThreadCallの取得
+	 * @return	実行中のスレッドのThreadCallを返却します。
+	 * 			ThreadCallのスレッド以外の場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadCall * ThreadCall::getCurrentThread()
+	{
+		return currentThread;
+	}
+	/**
+	 * @brief		replayJournal
+	 * 				ジャーナルの未完了データの再実行
+	 * @note		ジャーナルをopenした時点で未完了だったデータを
+	 * 				待ち行列の空きの分だけ積み上げます。
+	 * 				積み上げ出来なかったデータはジャーナルに残り、
+	 * 				待ち行列が減った時点でワーカースレッドが補充します。
+	 * 				TH_SCHED_FAIRの場合は既定のテナントへ積み上げます。
+	 * @return	積み上げた数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	size_t ThreadCall::replayJournal()
+	{
+		void *	items[MAX_BATCH];
+		size_t	total = 0;
+		try
+		{
+			mutex.lock();
+			Journal *	journaled	= journal;
+			long		room		= (long)threadQueDepath - 1 - (long)currentThreadQueue.load(std::memory_order_relaxed);
+			mutex.unlock();
+			if (!journaled)
+			{
+				return 0;
+			}
+			while (room > 0)
+			{
+				size_t num = journaled->takeReplay(items , room < MAX_BATCH ? (size_t)room : MAX_BATCH);
+				if (num == 0)
+				{
+					break;
+				}
+				size_t pushed = 0;
+				while (pushed < num && push(items[pushed] , NULL , TH_TENANT_DEFAULT))
+				{
+					pushed++;
+				}
+				total	+= pushed;
+				room	-= (long)num;
+				if (pushed < num)
+				{
+					journaled->restoreReplay(items + pushed , num - pushed);
+					break;
+				}
+			}
+			if (total > 0)
+			{
+				signal();
+			}
+			return total;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		refillJournal
+	 * 				ジャーナルの未完了データの補充
+	 * @note		ワーカースレッドから呼び出し、未完了データが残っている場合は
+	 * 				待ち行列が半分以下となった時点で空きの分を積み上げます。
+	 * @param[in]	journaled：実行中のジャーナル
+	 * @return	積み上げた場合はtrueを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::refillJournal(Journal * journaled)
+	{
+		if (!journaled || journaled->getReplayCount() == 0)
+		{
+			return false;
+		}
+		if (currentThreadQueue.load(std::memory_order_relaxed) > threadQueDepath / 2)
+		{
+			return false;
+		}
+		return replayJournal() > 0;
+	}
+	/**
+	 * @brief		post
+	 * 				メッセージの複製による積み上げ
+	 * @note		データをThreadCallが所有するメッセージ用リングへ複製して
+	 * 				積み上げます。ヒープの確保と解放は発生しません。
+	 * 				スレッド上で積み上げた順にonFunction(const void*,size_t)が
+	 * 				呼び出されます。setFunctionの待ち行列との順序は保証しません。
+	 * @param[in]	data：積み上げるデータを指定
+	 * @param[in]	len：データの長さ(リングの容量の半分未満)を指定
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(リングに空きが無い)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::post(const void * data , size_t len)
+	{
+		try
+		{
+			void * area = beginPost(len , NULL);
+			if (!area) return false;
+			memcpy(area , data , len);
+			endPost(area , true);
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setMessageCapacity
+	 * 				メッセージ用リングの容量の設定
+	 * @note		未実行のメッセージが無い場合のみ変更可能です。
+	 * 				リングは次回のpost時に確保されます。
+	 * @param[in]	capacity：容量(byte)を指定。2のべき乗に切り上げます。
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(未実行のメッセージが存在する)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::setMessageCapacity(size_t capacity)
+	{
+		size_t size = MessageHeaderSize * 4;
+		try
+		{
+			while (size < capacity)
+			{
+				size <<= 1;
+			}
+			mutex.lock();
+			if (messageHead.load(std::memory_order_acquire) != messageTail.load(std::memory_order_relaxed))
+			{
+				mutex.unlock();
+				return false;
+			}
+			free(messageRing);
+			messageRing		= NULL;
+			messageCapacity	= size;
+			mutex.unlock();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		addTenant
+	 * 				テナントの登録
+	 * @note		TH_SCHED_FAIRにて使用するテナントを登録します。
+	 * 				登録済みのテナントを指定した場合は重みと最大数を変更します。
+	 * @param[in]	tenant：テナントIDを指定します。
+	 * @param[in]	weight：重みを指定します。巡回毎に重みの数だけ取り出されます。
+	 * @param[in]	depth：テナントの待ち行列の最大数を指定します。
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::addTenant(int tenant , unsigned int weight , unsigned int depth)
+	{
+		try
+		{
+			if (weight == 0 || depth == 0) return false;
+			mutex.lock();
+			ThreadTenant_t * t = findTenant(tenant);
+			if (t)
+			{
+				/* 待ち行列が積まれている場合は最大数を縮小出来ない */
+				if (depth != t->depth && t->count > 0)
+				{
+					mutex.unlock();
+					return false;
+				}
+				if (depth != t->depth)
+				{
+					delete [] t->queue;
+					t->queue	= new ThreadQueue_t [depth];
+					t->depth	= depth;
+					t->head		= 0;
+				}
+				t->weight = weight;
+				mutex.unlock();
+				return true;
+			}
+			t = createTenant(tenant , weight , depth);
+			mutex.unlock();
+			return t != NULL;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		removeTenant
+	 * 				テナントの登録解除
+	 * @note		待ち行列が積まれているテナントは解除出来ません。
+	 * @param[in]	tenant：テナントIDを指定します。
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::removeTenant(int tenant)
+	{
+		try
+		{
+			mutex.lock();
+			for (unsigned int i = 0 ; i < tenantCount ; i++)
+			{
+				if (tenants[i]->id != tenant) continue;
+				if (tenants[i]->count > 0)
+				{
+					mutex.unlock();
+					return false;
+				}
+				delete [] tenants[i]->queue;
+				delete tenants[i];
+				/* 後続のテナントを詰める */
+				for (unsigned int j = i + 1 ; j < tenantCount ; j++)
+				{
+					tenants[j - 1] = tenants[j];
+				}
+				tenantCount--;
+				tenants[tenantCount] = NULL;
+				if (tenantCursor > i || tenantCursor >= tenantCount)
+				{
+					tenantCursor	= (tenantCursor > 0) ? tenantCursor - 1 : 0;
+					tenantTurn	= false;
+				}
+				mutex.unlock();
+				return true;
+			}
+			mutex.unlock();
+			return false;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getTenantStat
+	 * 				テナントの統計情報を取得します。
+	 * @param[in]	tenant：テナントIDを指定します。
+	 * @param[out]	stat：統計情報を格納します。
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： テナントが登録されていない
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::getTenantStat(int tenant , ThreadTenantStat_t * stat)
+	{
+		try
+		{
+			mutex.lock();
+			ThreadTenant_t * t = findTenant(tenant);
+			if (!t)
+			{
+				mutex.unlock();
+				return false;
+			}
+			stat->weight		= t->weight;
+			stat->depth		= t->depth;
+			stat->waiting		= t->count;
+			stat->submitted	= t->submitted;
+			stat->dispatched	= t->dispatched;
+			stat->rejected	= t->rejected;
+			stat->expired		= t->expired;
+			stat->throttled	= t->throttled;
+			mutex.unlock();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setRateLimit
+	 * 				取り出しの流量制限の設定
+	 * @note		待ち行列からの取り出し毎にトークンを1個取得し、不足している
+	 * 				場合は次の補充まで待機します。待機中はスピンせず、
+	 * 				futexにて補充時刻まで停止します。
+	 * 				同じTokenBucketを複数のThreadCallに指定した場合は
+	 * 				合計で制限されます。メッセージ(post)は制限されません。
+	 * @param[in]	bucket：流量制限。NULLの場合は無制限。ThreadCallより先に破棄しないでください
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::setRateLimit(TokenBucket * bucket)
+	{
+		try
+		{
+			mutex.lock();
+			rateLimit = bucket;
+			mutex.unlock();
+			unpark();
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setTenantRateLimit
+	 * 				テナント毎の取り出しの流量制限の設定
+	 * @note		TH_SCHED_FAIRの場合のみ使用されます。
+	 * 				流量制限中のテナントは見送り、他のテナントから取り出します。
+	 * @param[in]	tenant：addTenantにて登録したテナントIDを指定
+	 * @param[in]	bucket：流量制限。NULLの場合は無制限
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(テナントが存在しない)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::setTenantRateLimit(int tenant , TokenBucket * bucket)
+	{
+		try
+		{
+			mutex.lock();
+			ThreadTenant_t * t = findTenant(tenant);
+			if (!t)
+			{
+				mutex.unlock();
+				return false;
+			}
+			t->bucket = bucket;
+			mutex.unlock();
+			unpark();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		addWatch
+	 * 				ファイルディスクリプタの監視登録
+	 * @note		スレッド種別がTH_TYP_REACTORの場合、ファイルディスクリプタが
+	 * 				準備完了となった時点でReactorFunctionをスレッドにて実行します。
+	 * 				待ち行列の処理と同じスレッドで実行される為、
+	 * 				ReactorFunction内での排他制御は不要です。
+	 * @param[in]	fd：監視するファイルディスクリプタを指定します。
+	 * @param[in]	events：監視するイベント(EPOLLIN/EPOLLOUT/EPOLLET等)を指定します。
+	 * @param[in]	handler：準備完了時に実行するReactorFunctionを指定します。
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::addWatch(int fd , unsigned int events , ReactorFunction * handler)
+	{
+		try
+		{
+			Reactor * r = getReactor();
+			return r ? r->addWatch(fd , events , handler) : false;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		modifyWatch
+	 * 				監視するイベントの変更
+	 * @param[in]	fd：監視中のファイルディスクリプタを指定します。
+	 * @param[in]	events：監視するイベントを指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::modifyWatch(int fd , unsigned int events)
+	{
+		try
+		{
+			Reactor * r = getReactor();
+			return r ? r->modifyWatch(fd , events) : false;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		removeWatch
+	 * 				ファイルディスクリプタの監視解除
+	 * @note		ファイルディスクリプタを閉じる前に呼び出してください。
+	 * 				他のスレッドから呼び出した場合は実行中のReactorFunctionの
+	 * 				完了を待機します。
+	 * @param[in]	fd：監視中のファイルディスクリプタを指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::removeWatch(int fd)
+	{
+		try
+		{
+			Reactor * r = getReactor();
+			return r ? r->removeWatch(fd) : false;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		addTimer
+	 * 				タイマーの登録
+	 * @note		スレッド種別がTH_TYP_REACTORの場合、指定時間毎に
+	 * 				ReactorFunctionをスレッドにて実行します。
+	 * 				処理が遅延した場合、満了回数はgetExpirationsにて取得出来ます。
+	 * @param[in]	interval：満了までの時間をミリ秒にて指定します。
+	 * @param[in]	handler：満了時に実行するReactorFunctionを指定します。
+	 * @param[in]	repeat：trueの場合は一定間隔で繰り返し満了します。
+	 * @return	タイマーの識別子を返却します。失敗した場合は-1
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	int ThreadCall::addTimer(long interval , ReactorFunction * handler , bool repeat)
+	{
+		try
+		{
+			Reactor * r = getReactor();
+			return r ? r->addTimer(interval , handler , repeat) : -1;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		removeTimer
+	 * 				タイマーの解除
+	 * @note		他のスレッドから呼び出した場合は実行中のReactorFunctionの
+	 * 				完了を待機します。
+	 * @param[in]	timer：addTimerにて返却された識別子を指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::removeTimer(int timer)
+	{
+		try
+		{
+			Reactor * r = getReactor();
+			return r ? r->removeTimer(timer) : false;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/* ***************************************************************************
+	 *
+	 * プライベートメソッド
+	 *
+	 ****************************************************************************/
+	/**
+	 * @brief		empty
+	 * 				待機中のスレッドファンクションの有無を確認
+	 * @return	スレッドファンクションの有無を返却
+	 * @retval	true:現在待機中のものは存在しない
+	 * @retval	false:待機中である
+	 * @author	Sebastian
+	 * @date		2009/7/16
+	 */
+	bool ThreadCall::empty()
+	{
+		try
+		{
+			return currentThreadQueue.load(std::memory_order_acquire) == 0
+				&& messageHead.load(std::memory_order_relaxed) == messageTail.load(std::memory_order_acquire)
+				&& producerBatches.load(std::memory_order_acquire) == NULL
+				&& producerArmed.load(std::memory_order_acquire) == 0;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		push
+	 * 				ThreadFunctionを追加
+	 * @note		スケジューリング種別がTH_SCHED_DEADLINEの場合は
+	 * 				実行期限順のヒープとして追加します。
+	 * @param[in]	FuncQue 追加するThreadFunctionを指定
+	 * @param[in]	deadline 実行期限を指定。NULLの場合は期限無し
+	 * @param[in]	tenant テナントIDを指定。TH_SCHED_FAIRの場合のみ使用
+	 * @return	処理の成否を返却
+	 * @retval	true:成功
+	 * @retval	false:失敗
+	 * @author	Sebastian
+	 * @date		2009/7/16
+	 */
+	bool ThreadCall::push(void * FuncQue , const struct timespec * deadline , int tenant)
+	{
+		try
+		{
+			/* 過負荷の場合は待ち行列が空になるまでミューテックスを取得せずに拒否 */
+			if (overloaded.load(std::memory_order_relaxed)
+			 && currentThreadQueue.load(std::memory_order_relaxed) > 0)
+			{
+				shedFunctions.fetch_add(1 , std::memory_order_relaxed);
+				return false;
+			}
+
+			mutex.lock();
+			/* テナントの上限を全体の上限より先に判定し、拒否をテナントへ計上 */
+			ThreadTenant_t * t = NULL;
+			if (threadschedule == TH_SCHED_FAIR)
+			{
+				t = findTenant(tenant);
+				if (!t)
+				{
+					mutex.unlock();
+					return false;
+				}
+				if (t->count >= t->depth)
+				{
+					t->rejected++;
+					mutex.unlock();
+					return false;
+				}
+			}
+			if (currentThreadQueue + 1 >= threadQueDepath)
+			{
+				if (t) t->rejected++;
+				mutex.unlock();
+				return false;
+			}
+			/* 積み上げるデータが無い場合は起床の通知のみ */
+			if (!FuncQue)
+			{
+				mutex.unlock();
+				return true;
+			}
+			/* テナントの待ち行列へ追加 */
+			if (t)
+			{
+				ThreadQueue_t * item = &t->queue[(t->head + t->count) % t->depth];
+				item->data = FuncQue;
+				item->enqueued = GetMonotonicTime();
+				if (deadline)
+				{
+					item->deadline = *deadline;
+				}
+				else
+				{
+					item->deadline.tv_sec	= TH_NO_DEADLINE;
+					item->deadline.tv_nsec	= 0;
+				}
+				t->count++;
+				t->submitted++;
+				currentThreadQueue.store(currentThreadQueue.load(std::memory_order_relaxed) + 1 , std::memory_order_release);
+				mutex.unlock();
+				return true;
+			}
+			threadQueue[currentThreadQueue].data = FuncQue;
+			threadQueue[currentThreadQueue].enqueued = GetMonotonicTime();
+			if (deadline)
+			{
+				threadQueue[currentThreadQueue].deadline = *deadline;
+			}
+			else
+			{
+				threadQueue[currentThreadQueue].deadline.tv_sec		= TH_NO_DEADLINE;
+				threadQueue[currentThreadQueue].deadline.tv_nsec	= 0;
+			}
+			currentThreadQueue.store(currentThreadQueue.load(std::memory_order_relaxed) + 1 , std::memory_order_release);
+			if (threadschedule == TH_SCHED_DEADLINE)
+			{
+				heapUp(currentThreadQueue - 1);
+			}
+			mutex.unlock();
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		pop
+	 * 				ThreadFunctionを取得
+	 * @note		pushメソッドにて積み上げられたThreadFunctionを
+	 * 				末尾から一つ取り出す。
+	 * 				スケジューリング種別がTH_SCHED_DEADLINEの場合は
+	 * 				実行期限の最も早いものを一つ取り出す。
+	 * @return	処理の成否を返却
+	 * @retval	true:成功
+	 * @retval	false:失敗
+	 * @author	Sebastian
+	 * @date		2009/7/16
+	 */
+	bool ThreadCall::pop()
+	{
+		try
+		{
+			mutex.lock();
+			bool result = popLocked();
+			mutex.unlock();
+			return result;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		popLocked
+	 * 				ThreadFunctionを取得
+	 * @note		popと同様ですが、ミューテックスを取得した状態で呼び出してください。
+	 * @return	処理の成否を返却
+	 * @retval	true:成功
+	 * @retval	false:失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::popLocked()
+	{
+		if (currentThreadQueue.load(std::memory_order_relaxed) == 0)
+		{
+			return false;
+		}
+		/* 流量制限 */
+		if (rateLimit && !rateLimit->tryAcquire(&throttleWait))
+		{
+			return false;
+		}
+		if (threadschedule == TH_SCHED_FAIR)
+		{
+			if (!popTenant())
+			{
+				/* 全てのテナントが流量制限中の為、取り出さなかった分を返却 */
+				if (rateLimit) rateLimit->refund();
+				return false;
+			}
+			ProcessOldest = ProcessEnqueued;
+			return true;
+		}
+		currentThreadQueue.store(currentThreadQueue.load(std::memory_order_relaxed) - 1 , std::memory_order_release);
+		if (threadschedule == TH_SCHED_DEADLINE)
+		{
+			/* 先頭(最も早い期限)を取り出し末尾を先頭へ移動 */
+			ProcessQueue	= threadQueue[0].data;
+			ProcessDeadline	= threadQueue[0].deadline;
+			ProcessEnqueued	= threadQueue[0].enqueued;
+			ProcessOldest	= ProcessEnqueued;
+			threadQueue[0]	= threadQueue[currentThreadQueue];
+			heapDown(0);
+		}
+		else
+		{
+			ProcessQueue	= threadQueue[currentThreadQueue].data;
+			ProcessDeadline	= threadQueue[currentThreadQueue].deadline;
+			ProcessEnqueued	= threadQueue[currentThreadQueue].enqueued;
+			/* 後入れ先出しの為、過負荷は残っている最も古い要素の待ち時間で判定 */
+			ProcessOldest	= currentThreadQueue > 0 ? threadQueue[0].enqueued : ProcessEnqueued;
+		}
+		return true;
+	}
+	/**
+	 * @brief		runBatch
+	 * 				まとめて取り出して実行
+	 * @note		ミューテックスを一度だけ取得して最大で指定した数を取り出し、
+	 * 				実行期限切れのものはonExpiredへ、それ以外はまとめて
+	 * 				onFunctionsへ引き渡します。
+	 * @param[in]	num：取り出す最大数
+	 * @return	処理の成否を返却
+	 * @retval	true:成功
+	 * @retval	false:失敗(onExpired/onFunctionsが失敗)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::runBatch(unsigned int num)
+	{
+		void *			items[MAX_BATCH];
+		void *			expired[MAX_BATCH];
+		unsigned int	taken	= 0;
+		unsigned int	dropped	= 0;
+		bool			result	= true;
+		try
+		{
+			long long now = GetMonotonicTime();
+			mutex.lock();
+			Journal * journaled = journal;
+			while (taken + dropped < num && popLocked())
+			{
+				/* 実行期限を過ぎている場合は実行せずに破棄 */
+				if (isExpired(&ProcessDeadline))
+				{
+					expiredFunctions++;
+					if (threadschedule == TH_SCHED_FAIR)
+					{
+						ThreadTenant_t * t = findTenant(ProcessTenant);
+						if (t) t->expired++;
+					}
+					expired[dropped++] = ProcessQueue;
+					continue;
+				}
+				long long wait = now - ProcessEnqueued;
+				totalWait.fetch_add(wait , std::memory_order_relaxed);
+				if (wait > maxWait.load(std::memory_order_relaxed))
+				{
+					maxWait.store(wait , std::memory_order_relaxed);
+				}
+				updateOverload(now , now - ProcessOldest);
+				items[taken++] = ProcessQueue;
+			}
+			ProcessQueue	= NULL;
+			ProcessEnqueued	= 0;
+			mutex.unlock();
+			for (unsigned int i = 0 ; i < dropped ; i++)
+			{
+				if (!onExpired(expired[i]))
+				{
+					result = false;
+				}
+				if (journaled) journaled->complete(expired[i]);
+			}
+			/* 取り出し済みのデータは停止する場合も実行 */
+			if (taken > 0)
+			{
+				processedFunctions.fetch_add(taken , std::memory_order_relaxed);
+				beginBusy();
+				if (!onFunctions(items , taken))
+				{
+					result = false;
+				}
+				endBusy();
+				if (journaled)
+				{
+					for (unsigned int i = 0 ; i < taken ; i++)
+					{
+						journaled->complete(items[i]);
+					}
+				}
+			}
+			return result;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		popTenant
+	 * 				テナントの待ち行列からThreadFunctionを取得
+	 * @note		Deficit Round Robinにて取り出すテナントを決定し
+	 * 				テナントの待ち行列の先頭から一つ取り出す。
+	 * 				テナントの巡回毎に重みの数だけ取り出し可能となり、
+	 * 				待ち行列が空になったテナントの残数は破棄されます。
+	 * 				ミューテックスを取得した状態で呼び出してください。
+	 * @return	処理の成否を返却
+	 * @retval	true:成功
+	 * @retval	false:失敗
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::popTenant()
+	{
+		unsigned int	visits	= 0;
+		long long		wait		= 0;
+		if (currentThreadQueue == 0 || tenantCount == 0) return false;
+		while (true)
+		{
+			if (tenantCursor >= tenantCount)
+			{
+				tenantCursor	= 0;
+				tenantTurn	= false;
+			}
+			/* 全てのテナントが流量制限中の場合は最も早い補充までの時間を返却 */
+			if (visits++ > tenantCount * 2)
+			{
+				throttleWait = wait;
+				return false;
+			}
+			ThreadTenant_t * t = tenants[tenantCursor];
+			if (t->count > 0)
+			{
+				/* 巡回毎に重みの数だけ加算 */
+				if (!tenantTurn)
+				{
+					t->deficit	+= t->weight;
+					tenantTurn	= true;
+				}
+				long long remain = 0;
+				if (t->deficit > 0 && t->bucket && !t->bucket->tryAcquire(&remain))
+				{
+					/* 流量制限中のテナントは見送り、残数は重みまでとする */
+					t->throttled++;
+					if (t->deficit > t->weight) t->deficit = t->weight;
+					if (wait == 0 || remain < wait) wait = remain;
+				}
+				else if (t->deficit > 0)
+				{
+					t->deficit--;
+					ProcessQueue	= t->queue[t->head].data;
+					ProcessDeadline	= t->queue[t->head].deadline;
+					ProcessEnqueued	= t->queue[t->head].enqueued;
+					ProcessTenant	= t->id;
+					t->head = (t->head + 1) % t->depth;
+					t->count--;
+					t->dispatched++;
+					currentThreadQueue.store(currentThreadQueue.load(std::memory_order_relaxed) - 1 , std::memory_order_release);
+					/* 空になったテナントは次の巡回へ */
+					if (t->count == 0)
+					{
+						t->deficit = 0;
+						tenantCursor++;
+						tenantTurn = false;
+					}
+					return true;
+				}
+			}
+			else
+			{
+				t->deficit = 0;
+			}
+			tenantCursor++;
+			tenantTurn = false;
+		}
+	}
+	/**
+	 * @brief		findTenant
+	 * 				テナントの検索
+	 * @note		ミューテックスを取得した状態で呼び出してください。
+	 * @param[in]	tenant：テナントIDを指定します。
+	 * @return	テナントを返却します。存在しない場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadTenant_t * ThreadCall::findTenant(int tenant)
+	{
+		for (unsigned int i = 0 ; i < tenantCount ; i++)
+		{
+			if (tenants[i]->id == tenant) return tenants[i];
+		}
+		return NULL;
+	}
+	/**
+	 * @brief		createTenant
+	 * 				テナントの作成
+	 * @note		ミューテックスを取得した状態で呼び出してください。
+	 * @param[in]	tenant：テナントIDを指定します。
+	 * @param[in]	weight：重みを指定します。
+	 * @param[in]	depth：待ち行列の最大数を指定します。
+	 * @return	作成したテナントを返却します。登録数を超える場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadTenant_t * ThreadCall::createTenant(int tenant , unsigned int weight , unsigned int depth)
+	{
+		if (tenantCount >= MAX_TENANT) return NULL;
+		ThreadTenant_t * t = new ThreadTenant_t;
+		memset(t , 0 , sizeof(ThreadTenant_t));
+		t->id		= tenant;
+		t->weight	= weight;
+		t->depth	= depth;
+		t->queue	= new ThreadQueue_t [depth];
+		tenants[tenantCount++] = t;
+		return t;
+	}
+	/**
+	 * @brief		heapUp
+	 * 				指定位置の要素をヒープの上位へ移動
+	 * @note		ミューテックスを取得した状態で呼び出してください。
+	 * @param[in]	index：移動する要素の位置
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::heapUp(unsigned int index)
+	{
+		ThreadQueue_t	item = threadQueue[index];
+		while (index > 0)
+		{
+			unsigned int parent = (index - 1) / 2;
+			const struct timespec * p = &threadQueue[parent].deadline;
+			if (p->tv_sec < item.deadline.tv_sec
+			 || (p->tv_sec == item.deadline.tv_sec && p->tv_nsec <= item.deadline.tv_nsec))
+			{
+				break;
+			}
+			threadQueue[index] = threadQueue[parent];
+			index = parent;
+		}
+		threadQueue[index] = item;
+	}
+	/**
+	 * @brief		heapDown
+	 * 				指定位置の要素をヒープの下位へ移動
+	 * @note		ミューテックスを取得した状態で呼び出してください。
+	 * @param[in]	index：移動する要素の位置
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::heapDown(unsigned int index)
+	{
+		if (currentThreadQueue == 0) return;
+		ThreadQueue_t	item = threadQueue[index];
+		while (true)
+		{
+			unsigned int child = index * 2 + 1;
+			if (child >= currentThreadQueue) break;
+			if (child + 1 < currentThreadQueue)
+			{
+				const struct timespec * l = &threadQueue[child].deadline;
+				const struct timespec * r = &threadQueue[child + 1].deadline;
+				if (r->tv_sec < l->tv_sec
+				 || (r->tv_sec == l->tv_sec && r->tv_nsec < l->tv_nsec))
+				{
+					child++;
+				}
+			}
+			const struct timespec * c = &threadQueue[child].deadline;
+			if (item.deadline.tv_sec < c->tv_sec
+			 || (item.deadline.tv_sec == c->tv_sec && item.deadline.tv_nsec <= c->tv_nsec))
+			{
+				break;
+			}
+			threadQueue[index] = threadQueue[child];
+			index = child;
+		}
+		threadQueue[index] = item;
+	}
+	/**
+	 * @brief		beginBusy
+	 * 				処理開始の記録
+	 * @note		処理を開始した時刻を記録し、待ち行列から取り出したものは
+	 * 				処理数と待ち時間を集計します。ミューテックスは使用しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::beginBusy()
+	{
+		long long now = GetMonotonicTime();
+		if (ProcessQueue && ProcessEnqueued > 0)
+		{
+			long long wait = now - ProcessEnqueued;
+			totalWait.fetch_add(wait , std::memory_order_relaxed);
+			if (wait > maxWait.load(std::memory_order_relaxed))
+			{
+				maxWait.store(wait , std::memory_order_relaxed);
+			}
+			updateOverload(now , now - ProcessOldest);
+			ProcessEnqueued = 0;
+			processedFunctions.fetch_add(1 , std::memory_order_relaxed);
+		}
+		busySince.store(now , std::memory_order_release);
+	}
+	/**
+	 * @brief		updateOverload
+	 * 				過負荷の判定
+	 * @note		取り出した要素の待ち行列での待ち時間(滞留時間)から
+	 * 				CoDelと同様に過負荷を判定します。
+	 * 				TH_SCHED_LIFOの場合は残っている最も古い要素の待ち時間を使用します。
+	 * 				待ち時間が目標を超え続けた状態が判定間隔を経過した場合
+	 * 				(判定間隔内の最小の待ち時間が目標を超えた場合)に過負荷とし、
+	 * 				目標未満の要素を取り出した場合に解除します。
+	 * 				一時的な集中は判定間隔内に解消される為、拒否されません。
+	 * @param[in]	now：取り出した時刻(ナノ秒)
+	 * @param[in]	wait：待ち時間(ナノ秒)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::updateOverload(long long now , long long wait)
+	{
+		long long target = overloadTarget.load(std::memory_order_relaxed);
+		if (target <= 0)
+		{
+			return;
+		}
+		if (wait < target)
+		{
+			overloadSince = 0;
+			if (overloaded.load(std::memory_order_relaxed))
+			{
+				overloaded.store(false , std::memory_order_relaxed);
+			}
+			return;
+		}
+		if (overloadSince == 0)
+		{
+			overloadSince = now + overloadInterval.load(std::memory_order_relaxed);
+		}
+		else if (now >= overloadSince && !overloaded.load(std::memory_order_relaxed))
+		{
+			overloaded.store(true , std::memory_order_relaxed);
+		}
+	}
+	/**
+	 * @brief		endBusy
+	 * 				処理完了の記録
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::endBusy()
+	{
+		busySince.store(0 , std::memory_order_release);
+	}
+	/**
+	 * @brief		moveFunctions
+	 * 				待ち行列の移動
+	 * @note		待ち行列の末尾から指定された数を移動先の待ち行列へ移動します。
+	 * 				双方のミューテックスを保持したまま移動する為、移動中の要素が
+	 * 				何れの待ち行列にも存在しない状態にはなりません。
+	 * 				ミューテックスはアドレス順に取得します。
+	 * 				TH_SCHED_FAIRの場合、ジャーナル使用時、移動先がインターバル型
+	 * 				又は過負荷の場合は移動しません。移動先が満杯となった時点で終了します。
+	 * @param[in]	target：移動先を指定します。
+	 * @param[in]	num：移動する最大数を指定します。
+	 * @return	移動した数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int ThreadCall::moveFunctions(ThreadCall * target , unsigned int num)
+	{
+		unsigned int moved = 0;
+		if (target == this || num == 0)
+		{
+			return 0;
+		}
+		ThreadCall * first	= this < target ? this : target;
+		ThreadCall * second	= this < target ? target : this;
+		first->mutex.lock();
+		second->mutex.lock();
+		if (threadschedule != TH_SCHED_FAIR && !journal
+		 && target->threadschedule != TH_SCHED_FAIR && !target->journal
+		 && target->threadtype.load(std::memory_order_relaxed) != TH_TYP_INTERVAL
+		 && !target->overloaded.load(std::memory_order_relaxed))
+		{
+			/* 末尾の要素はヒープの葉である為、ヒープを崩さずに取り出せる */
+			while (moved < num
+				&& currentThreadQueue > 0
+				&& target->currentThreadQueue + 1 < target->threadQueDepath)
+			{
+				unsigned int from	= currentThreadQueue.load(std::memory_order_relaxed) - 1;
+				unsigned int to	= target->currentThreadQueue.load(std::memory_order_relaxed);
+				target->threadQueue[to] = threadQueue[from];
+				currentThreadQueue.store(from , std::memory_order_release);
+				target->currentThreadQueue.store(to + 1 , std::memory_order_release);
+				if (target->threadschedule == TH_SCHED_DEADLINE)
+				{
+					target->heapUp(to);
+				}
+				moved++;
+			}
+		}
+		second->mutex.unlock();
+		first->mutex.unlock();
+		if (moved > 0)
+		{
+			target->signal();
+		}
+		return moved;
+	}
+	/**
+	 * @brief		getReactor
+	 * 				ファイルディスクリプタ監視用オブジェクトの取得
+	 * @note		初回呼び出し時に作成します。
+	 * @return	監視用オブジェクトを返却します。作成に失敗した場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Reactor * ThreadCall::getReactor()
+	{
+		Reactor * r;
+		mutex.lock();
+		if (!reactor)
+		{
+			r = new Reactor();
+			if (r->created)
+			{
+				reactor = r;
+			}
+			else
+			{
+				delete r;
+			}
+		}
+		r = reactor;
+		mutex.unlock();
+		return r;
+	}
+	/**
+	 * @brief		signal
+	 * 				待ち行列への追加の通知
+	 * @note		スレッド種別がTH_TYP_REACTORの場合はepollを、
+	 * 				それ以外の場合は条件変数を起床させます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::signal()
+	{
+		/* テナント単位の流量制限により待機中の場合は他のテナントの為に起床 */
+		if (throttleParked.load(std::memory_order_seq_cst) && threadschedule == TH_SCHED_FAIR)
+		{
+			unpark();
+		}
+		if (reactor)
+		{
+			reactor->notify();
+			/* 通知後に種別が変更されていない場合は条件変数への通知は不要 */
+			if (threadtype == TH_TYP_REACTOR) return;
+		}
+		condition.set();
+	}
+	/**
+	 * @brief		dispatch
+	 * 				ReactorFunctionの実行
+	 * @note		Reactorからスレッド上で呼び出されます。
+	 * 				派生クラスのonFunctionは経由せずに実行します。
+	 * @param[in]	Data：実行するReactorFunction
+	 * @return	ReactorFunctionの実行結果を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::dispatch(void * Data)
+	{
+		beginBusy();
+		bool result = ThreadCall::onFunction(Data);
+		endBusy();
+		return result;
+	}
+	/**
+	 * @brief		setThreadState
+	 * 				スレッドステータスの設定
+	 * @note		waitThreadStateにて待機しているスレッドが存在する場合のみ
+	 * 				futexにて起床させます。
+	 * @param[in]	state：設定するステータス
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::setThreadState(ThreadState_t state)
+	{
+		threadstatus.store(state , std::memory_order_seq_cst);
+		if (stateWaiters.load(std::memory_order_seq_cst) > 0)
+		{
+			FutexWake(&threadstatus);
+		}
+	}
+	/**
+	 * @brief		waitState
+	 * 				スレッドの状態遷移の待機
+	 * @param[in]	mask：待機する状態のビット(1 << ThreadState_t)の組み合わせ
+	 * @param[in]	timeoutNs：タイムアウトをナノ秒にて指定。0以下の場合は無期限
+	 * @return	指定した状態となった場合はtrue、タイムアウトの場合はfalse
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::waitState(unsigned int mask , long long timeoutNs)
+	{
+		long long	limit = 0;
+		bool		result = true;
+		ThreadState_t current = threadstatus.load(std::memory_order_acquire);
+		if (mask & (1u << current)) return true;
+		if (timeoutNs > 0)
+		{
+			limit = GetMonotonicTime() + timeoutNs;
+		}
+		stateWaiters.fetch_add(1 , std::memory_order_seq_cst);
+		while (true)
+		{
+			current = threadstatus.load(std::memory_order_seq_cst);
+			if (mask & (1u << current)) break;
+			long long remain = 0;
+			if (timeoutNs > 0)
+			{
+				remain = limit - GetMonotonicTime();
+				if (remain <= 0)
+				{
+					result = false;
+					break;
+				}
+			}
+			FutexWait(&threadstatus , (int)current , remain);
+		}
+		stateWaiters.fetch_sub(1 , std::memory_order_seq_cst);
+		return result;
+	}
+	/**
+	 * @brief		park
+	 * 				流量制限による待機
+	 * @note		取り出し時に流量制限によりトークンが不足していた場合、
+	 * 				次の補充までfutexにて待機します。停止、流量制限の変更、
+	 * 				待ち行列への追加(他のテナントの為)にて起床します。
+	 * @return	停止が要求された場合はfalse
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::park()
+	{
+		long long wait = throttleWait;
+		throttleWait = 0;
+		if (wait <= 0)
+		{
+			return true;
+		}
+		int seq = throttleSeq.load(std::memory_order_seq_cst);
+		throttleParked.store(true , std::memory_order_seq_cst);
+		if (running.load(std::memory_order_seq_cst))
+		{
+			FutexWait(&throttleSeq , seq , wait);
+		}
+		throttleParked.store(false , std::memory_order_relaxed);
+		return running.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		unpark
+	 * 				流量制限による待機の解除
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::unpark()
+	{
+		throttleSeq.fetch_add(1 , std::memory_order_seq_cst);
+		if (throttleParked.load(std::memory_order_seq_cst))
+		{
+			FutexWake(&throttleSeq);
+		}
+	}
+	/**
+	 * @brief		beginPost
+	 * 				メッセージ用リングの領域の確保
+	 * @note		成功した場合はミューテックスを保持したまま返却します。
+	 * 				書き込み後にendPostを呼び出してください。
+	 * 				領域末尾に収まらない場合は詰め物を挿入して先頭から確保します。
+	 * @param[in]	len：メッセージの長さ
+	 * @param[in]	destroy：実行後に呼び出す破棄処理。不要の場合はNULL
+	 * @return	確保した領域を返却します。失敗した場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void * ThreadCall::beginPost(size_t len , void (*destroy)(void *))
+	{
+		ThreadMessage_t	probe;
+		void *			ptr;
+		probe.len	= (uint32_t)len;
+		probe.pad	= 0;
+		mutex.lock();
+		if (threadtype == TH_TYP_INTERVAL)
+		{
+			mutex.unlock();
+			threadCondition |= TH_ERR_ILLEGAL_USE_COND;
+			setThreadState(TH_STAT_FAULT);
+			return NULL;
+		}
+		uint64_t total = getMessageSize(&probe);
+		if (len > 0xffffffffUL || total > messageCapacity / 2)
+		{
+			mutex.unlock();
+			return NULL;
+		}
+		if (!messageRing)
+		{
+			if (posix_memalign(&ptr , TH_CACHE_LINE , messageCapacity) != 0)
+			{
+				threadCondition |= TH_ERR_MEMORY_ERR;
+				mutex.unlock();
+				return NULL;
+			}
+			messageRing = (char *)ptr;
+		}
+		uint64_t mask	= messageCapacity - 1;
+		uint64_t tail	= messageTail.load(std::memory_order_relaxed);
+		uint64_t room	= messageCapacity - (tail & mask);
+		uint64_t pad	= room < total ? room : 0;
+		if (messageCapacity - (tail - messageHead.load(std::memory_order_acquire)) < pad + total)
+		{
+			mutex.unlock();
+			return NULL;
+		}
+		if (pad)
+		{
+			ThreadMessage_t * filler = (ThreadMessage_t *)(messageRing + (tail & mask));
+			filler->len		= (uint32_t)pad;
+			filler->pad		= 1;
+			filler->destroy	= NULL;
+			tail += pad;
+		}
+		ThreadMessage_t * message = (ThreadMessage_t *)(messageRing + (tail & mask));
+		message->len		= (uint32_t)len;
+		message->pad		= 0;
+		message->destroy	= destroy;
+		messageReserved	= tail + total;
+		return (char *)message + MessageHeaderSize;
+	}
+	/**
+	 * @brief		endPost
+	 * 				メッセージの公開
+	 * @note		beginPostにて確保した領域を公開してミューテックスを解放します。
+	 * 				取り消した場合は詰め物として公開し、実行されません。
+	 * @param[in]	area：beginPostにて返却された領域
+	 * @param[in]	commit：書き込みが完了したか
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::endPost(void * area , bool commit)
+	{
+		if (!commit)
+		{
+			ThreadMessage_t * message = (ThreadMessage_t *)((char *)area - MessageHeaderSize);
+			message->len	= (uint32_t)getMessageSize(message);
+			message->pad	= 1;
+		}
+		messageTail.store(messageReserved , std::memory_order_release);
+		mutex.unlock();
+		if (commit)
+		{
+			signal();
+		}
+	}
+	/**
+	 * @brief		runMessages
+	 * 				メッセージの逐次実行
+	 * @note		スレッド上で呼び出され、積み上げられた順にonFunctionを
+	 * 				呼び出します。領域は呼び出し完了後に解放します。
+	 * @return	成否を返却します。onFunctionが失敗した場合はfalse
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::runMessages()
+	{
+		uint64_t head = messageHead.load(std::memory_order_relaxed);
+		while (head != messageTail.load(std::memory_order_acquire))
+		{
+			ThreadMessage_t *	message	= (ThreadMessage_t *)(messageRing + (head & (messageCapacity - 1)));
+			uint64_t			size		= getMessageSize(message);
+			bool				result	= true;
+			if (!message->pad)
+			{
+				void * data = (char *)message + MessageHeaderSize;
+				beginBusy();
+				processedFunctions.fetch_add(1 , std::memory_order_relaxed);
+				result = onFunction((const void *)data , (size_t)message->len);
+				if (message->destroy)
+				{
+					message->destroy(data);
+				}
+				endBusy();
+			}
+			head += size;
+			messageHead.store(head , std::memory_order_release);
+			if (!result)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	/**
+	 * @brief		clearMessages
+	 * 				未実行のメッセージの破棄
+	 * @note		破棄処理を持つメッセージは破棄し、リングを解放します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::clearMessages()
+	{
+		uint64_t head = messageHead.load(std::memory_order_relaxed);
+		while (head != messageTail.load(std::memory_order_acquire))
+		{
+			ThreadMessage_t * message = (ThreadMessage_t *)(messageRing + (head & (messageCapacity - 1)));
+			if (!message->pad && message->destroy)
+			{
+				message->destroy((char *)message + MessageHeaderSize);
+			}
+			head += getMessageSize(message);
+		}
+		messageHead.store(head , std::memory_order_release);
+		free(messageRing);
+		messageRing = NULL;
+	}
+	/**
+	 * @brief		isProducerBuffered
+	 * 				生産者毎のバッファの使用可否
+	 * @note		ミューテックス無しで呼び出される為、スケジューリング種別と
+	 * 				ジャーナルは設定時に更新したproducerExcludedにて判定します。
+	 * @param[in]	deadline：積み上げの実行期限
+	 * @return	生産者毎のバッファへ格納する場合はtrue
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::isProducerBuffered(const struct timespec * deadline)
+	{
+		return deadline == NULL
+			&& producerSize.load(std::memory_order_acquire) > 0
+			&& threadtype.load(std::memory_order_relaxed) != TH_TYP_INTERVAL
+			&& !producerExcluded.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		getProducerBuffer
+	 * 				呼び出したスレッドのバッファの取得
+	 * @note		最後に使用したバッファはロック無しで取得します。
+	 * 				破棄済みのThreadCallのバッファは検索時に解放します。
+	 * @param[in]	create：存在しない場合に作成するか
+	 * @return	バッファを返却します。存在しない場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ProducerBuffer_t * ThreadCall::getProducerBuffer(bool create)
+	{
+		ProducerLocal *		local	= &producerLocal;
+		ProducerBuffer_t *	buffer	= local->last;
+		if (buffer && buffer->owner.load(std::memory_order_relaxed) == this)
+		{
+			return buffer;
+		}
+		ProducerBuffer_t ** link = &local->head;
+		while ((buffer = *link) != NULL)
+		{
+			ThreadCall * owner = buffer->owner.load(std::memory_order_acquire);
+			if (owner == this)
+			{
+				local->last = buffer;
+				return buffer;
+			}
+			if (!owner)
+			{
+				*link = buffer->localNext;
+				if (local->last == buffer) local->last = NULL;
+				releaseBuffer(buffer);
+				continue;
+			}
+			link = &buffer->localNext;
+		}
+		if (!create)
+		{
+			return NULL;
+		}
+		/* ***************************************************************
+		 * 作成してThreadCallと生産者スレッドの双方に登録
+		 * ***************************************************************/
+		buffer = new (std::nothrow) ProducerBuffer_t;
+		if (!buffer)
+		{
+			return NULL;
+		}
+		buffer->owner.store(this , std::memory_order_relaxed);
+		buffer->lock.store(0 , std::memory_order_relaxed);
+		buffer->refs.store(2 , std::memory_order_relaxed);
+		buffer->batch	= NULL;
+		buffer->first	= 0;
+		mutex.lock();
+		/* 生産者スレッドが終了したバッファを解放 */
+		link = &producers;
+		while (*link)
+		{
+			ProducerBuffer_t * old = *link;
+			if (old->refs.load(std::memory_order_acquire) == 1)
+			{
+				*link = old->ownerNext;
+				releaseBuffer(old);
+				continue;
+			}
+			link = &old->ownerNext;
+		}
+		buffer->ownerNext	= producers;
+		producers			= buffer;
+		mutex.unlock();
+		buffer->localNext	= local->head;
+		local->head		= buffer;
+		local->last		= buffer;
+		return buffer;
+	}
+	/**
+	 * @brief		bufferFunction
+	 * 				生産者毎のバッファへの格納
+	 * @note		満杯となった場合は公開します。
+	 * 				空のバッファへ格納した場合は時間経過による公開の為に
+	 * 				ワーカースレッドへ通知します。
+	 * @param[in]	item：積み上げるデータ
+	 * @param[in]	function：ThreadFunctionとして積み上げたか
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(公開済みで未実行の数が上限を超えている)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::bufferFunction(void * item , bool function)
+	{
+		if (producerBacklog.load(std::memory_order_relaxed) >= producerLimit)
+		{
+			return false;
+		}
+		ProducerBuffer_t * buffer = getProducerBuffer(true);
+		if (!buffer)
+		{
+			return false;
+		}
+		ProducerBatch_t *	full	= NULL;
+		bool				armed	= false;
+		lockBuffer(buffer);
+		ProducerBatch_t * batch = buffer->batch;
+		if (!batch)
+		{
+			unsigned int size = producerSize.load(std::memory_order_relaxed);
+			if (size == 0) size = 1;
+			batch = (ProducerBatch_t *)malloc(sizeof(ProducerBatch_t) + (size - 1) * sizeof(void *) + size);
+			if (!batch)
+			{
+				unlockBuffer(buffer);
+				return false;
+			}
+			batch->next		= NULL;
+			batch->count		= 0;
+			batch->capacity	= size;
+			batch->functions	= (unsigned char *)(batch->items + size);
+			buffer->batch		= batch;
+		}
+		/* 空のバッファへの格納の場合は公開待ちのバッファとして計上 */
+		if (batch->count == 0)
+		{
+			buffer->first	= GetMonotonicTime();
+			armed			= producerArmed.fetch_add(1 , std::memory_order_acq_rel) == 0;
+		}
+		batch->functions[batch->count]	= function;
+		batch->items[batch->count++]	= item;
+		if (batch->count >= batch->capacity)
+		{
+			full			= batch;
+			buffer->batch	= NULL;
+		}
+		unlockBuffer(buffer);
+		if (full)
+		{
+			publishBatch(full , true);
+		}
+		else if (armed)
+		{
+			signal();
+		}
+		return true;
+	}
+	/**
+	 * @brief		publishBatch
+	 * 				まとまりの公開
+	 * @note		公開済みのまとまりの先頭へCASにて追加します。
+	 * @param[in]	batch：バッファから切り離したまとまり
+	 * @param[in]	notify：ワーカースレッドへ通知するか
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::publishBatch(ProducerBatch_t * batch , bool notify)
+	{
+		producerBacklog.fetch_add(batch->count , std::memory_order_relaxed);
+		ProducerBatch_t * head = producerBatches.load(std::memory_order_relaxed);
+		do
+		{
+			batch->next = head;
+		}
+		while (!producerBatches.compare_exchange_weak(
+					head , batch , std::memory_order_release , std::memory_order_relaxed));
+		producerArmed.fetch_sub(1 , std::memory_order_acq_rel);
+		if (notify)
+		{
+			/* 公開時刻まで待機中の場合は起床 */
+			unpark();
+			signal();
+		}
+	}
+	/**
+	 * @brief		runProducers
+	 * 				公開されたまとまりの実行
+	 * @note		公開済みのまとまりを一度に取り出し、公開順にonFunctionsへ
+	 * 				引き渡します。公開されていないバッファが存在し、実行するものが
+	 * 				無い場合は最も早い公開時刻までの待機を設定します。
+	 * @return	処理の成否を返却
+	 * @retval	true:成功
+	 * @retval	false:失敗(onFunctionsが失敗)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::runProducers()
+	{
+		try
+		{
+			if (producerArmed.load(std::memory_order_acquire) > 0)
+			{
+				long long wait = sweepProducers();
+				if (wait > 0
+				 && currentThreadQueue.load(std::memory_order_relaxed) == 0
+				 && producerBatches.load(std::memory_order_acquire) == NULL)
+				{
+					throttleWait = wait;
+				}
+			}
+			ProducerBatch_t * list = producerBatches.exchange(NULL , std::memory_order_acq_rel);
+			if (!list)
+			{
+				return true;
+			}
+			/* 新しいものが先頭の為、公開順へ並べ替え */
+			ProducerBatch_t * ordered = NULL;
+			while (list)
+			{
+				ProducerBatch_t * next = list->next;
+				list->next	= ordered;
+				ordered		= list;
+				list			= next;
+			}
+			/* 取り出し済みのまとまりは停止する場合も実行 */
+			bool result = true;
+			while (ordered)
+			{
+				ProducerBatch_t * batch = ordered;
+				ordered = batch->next;
+				processedFunctions.fetch_add(batch->count , std::memory_order_relaxed);
+				beginBusy();
+				if (!onFunctions(batch->items , batch->count))
+				{
+					result = false;
+				}
+				endBusy();
+				producerBacklog.fetch_sub(batch->count , std::memory_order_relaxed);
+				free(batch);
+			}
+			return result;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		sweepProducers
+	 * 				公開時刻を経過したバッファの公開
+	 * @note		最初の格納から公開するまでの時間を経過したバッファを公開します。
+	 * 				ワーカースレッドから呼び出されます。
+	 * @return	公開されていないバッファの最も早い公開時刻までの時間(ナノ秒)。
+	 * 			存在しない場合は0
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	long long ThreadCall::sweepProducers()
+	{
+		long long	now		= GetMonotonicTime();
+		long long	wait	= 0;
+		mutex.lock();
+		for (ProducerBuffer_t * buffer = producers ; buffer ; buffer = buffer->ownerNext)
+		{
+			ProducerBatch_t * batch = NULL;
+			lockBuffer(buffer);
+			if (buffer->batch && buffer->batch->count > 0)
+			{
+				long long remain = buffer->first + producerInterval - now;
+				if (remain <= 0)
+				{
+					batch			= buffer->batch;
+					buffer->batch	= NULL;
+				}
+				else if (wait == 0 || remain < wait)
+				{
+					wait = remain;
+				}
+			}
+			unlockBuffer(buffer);
+			if (batch)
+			{
+				publishBatch(batch , false);
+			}
+		}
+		mutex.unlock();
+		return wait;
+	}
+	/**
+	 * @brief		clearProducers
+	 * 				生産者毎のバッファのクリア
+	 * @note		バッファの登録を解除し、未実行のまとまりを破棄します。
+	 * 				終了中の生産者スレッドが公開中の場合はバッファのロックにて
+	 * 				公開の完了を待ちます。
+	 * 				生産者スレッドが保持しているバッファは次回の検索時、
+	 * 				またはスレッドの終了時に解放されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::clearProducers()
+	{
+		mutex.lock();
+		ProducerBuffer_t * buffer = producers;
+		producers = NULL;
+		mutex.unlock();
+		while (buffer)
+		{
+			ProducerBuffer_t * next = buffer->ownerNext;
+			lockBuffer(buffer);
+			buffer->owner.store(NULL , std::memory_order_release);
+			ProducerBatch_t * batch = buffer->batch;
+			buffer->batch = NULL;
+			unlockBuffer(buffer);
+			if (batch)
+			{
+				abandonBatch(batch);
+			}
+			releaseBuffer(buffer);
+			buffer = next;
+		}
+		ProducerBatch_t * batch = producerBatches.exchange(NULL , std::memory_order_acq_rel);
+		while (batch)
+		{
+			ProducerBatch_t * next = batch->next;
+			abandonBatch(batch);
+			batch = next;
+		}
+		producerBacklog.store(0 , std::memory_order_relaxed);
+		producerArmed.store(0 , std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		abandonBatch
+	 * 				未実行のまとまりの破棄
+	 * @note		ThreadFunctionとして積み上げたものは実行期限切れ状態とし、
+	 * 				自動解放が指定されている場合はdeleteします。
+	 * 				データは積み上げ側の所有の為、破棄しません。
+	 * @param[in]	batch：破棄するまとまり
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadCall::abandonBatch(ProducerBatch_t * batch)
+	{
+		for (unsigned int i = 0 ; i < batch->count ; i++)
+		{
+			if (batch->functions[i])
+			{
+				ThreadCall::onExpired(batch->items[i]);
+			}
+		}
+		free(batch);
+	}
+	/**
+	 * @brief		isExpired
+	 * 				実行期限切れの確認
+	 * @param[in]	deadline：確認する実行期限
+	 * @return	確認結果を返却
+	 * @retval	true:実行期限を過ぎている
+	 * @retval	false:実行期限内、もしくは期限無し
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadCall::isExpired(const struct timespec * deadline)
+	{
+		struct timespec now;
+		if (deadline->tv_sec == TH_NO_DEADLINE) return false;
+		clock_gettime(CLOCK_MONOTONIC , &now);
+		if (now.tv_sec != deadline->tv_sec)
+		{
+			return now.tv_sec > deadline->tv_sec;
+		}
+		return now.tv_nsec > deadline->tv_nsec;
+	}
 }
@@ -9,6 +9,23 @@
  * 
  * @par 更新履歴：
  * - 2009/07/16	Sebastian 新規作成
+ * - 2026/10/19	Sebastian デッドライン(EDF)スケジューリングを追加
+ * - 2026/10/19	Sebastian テナント単位の重み付き公平キューイングを追加
+ * - 2026/10/19	Sebastian 型付き実行結果(submit)を追加
+ * - 2026/10/19	Sebastian スタックサイズ指定のコンストラクタを追加
+ * - 2026/10/19	Sebastian レジストリ登録と監視用の統計情報を追加
+ * - 2026/10/19	Sebastian ファイルディスクリプタ監視(TH_TYP_REACTOR)を追加
+ * - 2026/10/19	Sebastian メンバをキャッシュライン毎に分離し状態をatomic化
+ * - 2026/10/19	Sebastian 状態遷移の待機(waitThreadState)を追加
+ * - 2026/10/19	Sebastian 可変長メッセージの複製による積み上げ(post)を追加
+ * - 2026/10/19	Sebastian まとめて取り出して実行するonFunctionsを追加
+ * - 2026/10/19	Sebastian トークンバケットによる取り出しの流量制限を追加
+ * - 2026/10/19	Sebastian 実行待ちのThreadFunctionの積み上げを集約するモードを追加
+ * - 2026/10/19	Sebastian 待ち時間による過負荷時の積み上げ拒否(受付制御)を追加
+ * - 2026/10/19	Sebastian ジャーナルによる待ち行列の永続化と再実行を追加
+ * - 2026/10/19	Sebastian スレッド開始・終了時の処理とスレッド毎のコンテキストを追加
+ * - 2026/10/19	Sebastian 生産者スレッド毎の積み上げバッファ(まとめて公開)を追加
+ * - 2026/10/19	Sebastian ジャーナルの未完了データをワーカースレッドにて補充
  * ***************************************************************************/
 #ifndef THREAD_CLASS
 #define THREAD_CLASS
@@ -22,14 +39,40 @@
 #include <stdlib.h>
 #include <time.h>
 #include <errno.h>
+#include <stdint.h>
 #include <string>
+#include <atomic>
+#include <new>
 #include "VSTDCond.hpp"
 #include "VSTDThreadFunction.hpp"
+#include "VSTDFuture.hpp"
+#include "VSTDReactor.hpp"
+#include "VSTDFutex.hpp"
 
 namespace VSTD
 {
 	/** @brief 登録可能なスレッドの最大数 */
 	#define MAX_THREAD 100
+	/** @brief 登録可能なテナントの最大数 */
+	#define MAX_TENANT 64
+	/** @brief テナント未指定時に使用されるテナントID */
+	#define TH_TENANT_DEFAULT 0
+	/** @brief テナント毎の待ち行列の既定の最大数(全体の上限未満) */
+	#define TH_TENANT_DEPTH (MAX_THREAD / 4)
+	/** @brief キャッシュラインのサイズ(byte) */
+	#define TH_CACHE_LINE 64
+	/** @brief onFunctionsにてまとめて実行する最大数 */
+	#define MAX_BATCH 256
+	/** @brief メッセージ用リングの既定の容量(byte) */
+	#define TH_MESSAGE_RING 65536
+	/** @brief メッセージの配置境界(byte) */
+	#define TH_MESSAGE_ALIGN 16
+	/** @brief 生産者毎のバッファの最大数 */
+	#define MAX_PRODUCER_BUFFER 4096
+	/** @brief 生産者毎のバッファを公開するまでの既定の時間(マイクロ秒) */
+	#define TH_PRODUCER_INTERVAL 50
+	/** @brief 公開済みで未実行の既定の最大数 */
+	#define TH_PRODUCER_BACKLOG 65536
 	/**
 	 * @brief 	スレッドステータス指定用列挙体
 	 * @author	Sebastian
@@ -58,7 +101,9 @@ namespace VSTD
 		/** @brief スレッドの実行種別をイベントドリブンに指定(default) */
 		TH_TYP_EVENTDRIVEN,
 		/** @brief スレッドの実行種別をタイマーインターバルに指定 */
-		TH_TYP_INTERVAL
+		TH_TYP_INTERVAL,
+		/** @brief スレッドの実行種別をファイルディスクリプタ監視(epoll)に指定 */
+		TH_TYP_REACTOR
 	} ThreadType_t;
 	/**
 	 *  @brief スレッド実行時のエラー状態指定用列挙体
@@ -78,8 +123,185 @@ namespace VSTD
 		/** @brief 条件変数の指定に異常がある */
 		TH_ERR_ILLEGAL_USE_COND	= 0x10 ,
 		/** @brief メモリーエラー */
-		TH_ERR_MEMORY_ERR		= 0x20
+		TH_ERR_MEMORY_ERR		= 0x20 ,
+		/** @brief 過負荷により積み上げを拒否中 */
+		TH_ERR_OVERLOADED		= 0x40
 	} threaderror_t;
+	/**
+	 * @brief		待ち行列のスケジューリング種別設定用列挙体
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef enum
+	{
+		/** @brief 最後に積まれたものから実行します(default) */
+		TH_SCHED_LIFO,
+		/** @brief 実行期限の最も早いものから実行します(EDF) */
+		TH_SCHED_DEADLINE,
+		/** @brief テナント毎の重みに従い公平に実行します(DRR) */
+		TH_SCHED_FAIR
+	} ThreadSchedule_t;
+	/**
+	 * @brief		待ち行列の要素
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 積み上げられたデータ */
+		void *			data;
+		/** @brief 実行期限(CLOCK_MONOTONIC)。期限無しの場合はTH_NO_DEADLINE */
+		struct timespec	deadline;
+		/** @brief 待ち行列に追加した時刻(ナノ秒) */
+		long long			enqueued;
+	} ThreadQueue_t;
+	/**
+	 * @brief		メッセージ用リングの要素の先頭
+	 * @note		メッセージ本体は直後にTH_MESSAGE_ALIGN境界で配置されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief メッセージ本体の長さ。領域末尾の詰め物の場合は詰め物の長さ */
+		uint32_t		len;
+		/** @brief 領域末尾の詰め物か */
+		uint32_t		pad;
+		/** @brief 実行後に呼び出す破棄処理。NULLの場合は破棄不要 */
+		void			(*destroy)(void *);
+	} ThreadMessage_t;
+	class TokenBucket;
+	class Journal;
+	class ThreadCall;
+	/**
+	 * @brief		生産者毎にまとめて公開する積み上げ
+	 * @note		itemsは確保時にバッファのサイズ分拡張され、
+	 * 				その後方にfunctionsの領域が確保されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct ProducerBatch
+	{
+		/** @brief 公開済みの次のまとまり */
+		struct ProducerBatch *	next;
+		/** @brief 格納数 */
+		unsigned int			count;
+		/** @brief 格納可能な数 */
+		unsigned int			capacity;
+		/** @brief 各データがThreadFunctionとして積み上げられたか */
+		unsigned char *			functions;
+		/** @brief 積み上げたデータ */
+		void *					items[1];
+	} ProducerBatch_t;
+	/**
+	 * @brief		生産者スレッド毎の積み上げバッファ
+	 * @note		生産者スレッドとThreadCallの双方から参照され、
+	 * 				双方が解放した時点で破棄されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct ProducerBuffer
+	{
+		/** @brief 積み上げ先。ThreadCallの破棄後はNULL */
+		std::atomic<ThreadCall *>	owner;
+		/** @brief 生産者スレッドとワーカースレッドの排他用スピンロック */
+		std::atomic<int>			lock;
+		/** @brief 参照数 */
+		std::atomic<int>			refs;
+		/** @brief 格納中のまとまり。未確保の場合はNULL */
+		ProducerBatch_t *			batch;
+		/** @brief 最初に格納した時刻(ナノ秒) */
+		long long					first;
+		/** @brief ThreadCallに登録されている次のバッファ */
+		struct ProducerBuffer *		ownerNext;
+		/** @brief 生産者スレッドが保持している次のバッファ */
+		struct ProducerBuffer *		localNext;
+	} ProducerBuffer_t;
+	/** @brief スレッド毎のコンテキストの生成処理 */
+	typedef void *	(*ThreadContextCreate_t)(ThreadCall * owner);
+	/** @brief スレッド毎のコンテキストの破棄処理 */
+	typedef void	(*ThreadContextDestroy_t)(void * context);
+	/**
+	 * @brief		テナント毎の待ち行列
+	 * @note		TH_SCHED_FAIR指定時に使用される先入れ先出しのリングです。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief テナントID */
+		int				id;
+		/** @brief 重み(1巡あたりに取り出せる数) */
+		unsigned int		weight;
+		/** @brief 待ち行列の最大数 */
+		unsigned int		depth;
+		/** @brief 待ち行列の先頭位置 */
+		unsigned int		head;
+		/** @brief 現在の待ち行列の数 */
+		unsigned int		count;
+		/** @brief 取り出し可能な残数(Deficit) */
+		unsigned int		deficit;
+		/** @brief 待ち行列 */
+		ThreadQueue_t *	queue;
+		/** @brief 積み上げられた総数 */
+		unsigned long		submitted;
+		/** @brief 取り出された総数 */
+		unsigned long		dispatched;
+		/** @brief 最大数超過により拒否された総数 */
+		unsigned long		rejected;
+		/** @brief 実行期限切れにより破棄された総数 */
+		unsigned long		expired;
+		/** @brief 流量制限。NULLの場合は無制限 */
+		TokenBucket *		bucket;
+		/** @brief 流量制限により取り出しを見送った総数 */
+		unsigned long		throttled;
+	} ThreadTenant_t;
+	/**
+	 * @brief		テナントの統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 重み */
+		unsigned int		weight;
+		/** @brief 待ち行列の最大数 */
+		unsigned int		depth;
+		/** @brief 現在の待ち行列の数 */
+		unsigned int		waiting;
+		/** @brief 積み上げられた総数 */
+		unsigned long		submitted;
+		/** @brief 取り出された総数 */
+		unsigned long		dispatched;
+		/** @brief 最大数超過により拒否された総数 */
+		unsigned long		rejected;
+		/** @brief 実行期限切れにより破棄された総数 */
+		unsigned long		expired;
+		/** @brief 流量制限により取り出しを見送った総数 */
+		unsigned long		throttled;
+	} ThreadTenantStat_t;
+	/**
+	 * @brief		監視用の統計情報
+	 * @note		ミューテックスを取得せずに取得されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 処理された総数 */
+		unsigned long		processed;
+		/** @brief 待ち行列での待ち時間の総計(ナノ秒) */
+		long long			totalWait;
+		/** @brief 待ち行列での待ち時間の最大(ナノ秒) */
+		long long			maxWait;
+		/** @brief 実行中の処理を開始した時刻(ナノ秒)。待機中は0 */
+		long long			busySince;
+	} ThreadMonitorStat_t;
+	/** @brief 実行期限無しを示すtv_secの値 */
+	#define TH_NO_DEADLINE	((time_t)0x7fffffff)
+	void SetDeadline(struct timespec * deadline , long microSecond);
+	long long GetMonotonicTime();
+	class ThreadRegistry;
 	/**
 	 * @brief	ThreadCall
 	 * @note	ThreadCallはThreadCallクラスを継承したクラスを作成し
@@ -99,10 +321,54 @@ namespace VSTD
 			/* ***************************************************************
 			 * プライベートメンバ変数
 			 * ***************************************************************/
-			/* @brief スレッドの条件変数操作用オブジェクト */
-			Condition			condition;
-			/** @brief スレッド実行フラグ */
-			bool				running;
+			/* ---------------------------------------------------------------
+			 * 設定(読み込み主体)
+			 * --------------------------------------------------------------- */
+			/**　@brief 実行されるスレッドの種類 */
+			alignas(TH_CACHE_LINE)
+			std::atomic<ThreadType_t>	threadtype;
+			/** @brief スレッドのアイドリング時間*/
+			std::atomic<long>			threadIdle;
+			/**　@brief 待ち行列のスケジューリング種別 */
+			ThreadSchedule_t	threadschedule;
+			/**　@brief onFunctionsにてまとめて実行する最大数 */
+			unsigned int		batchSize;
+			/**　@brief 取り出しの流量制限。NULLの場合は無制限 */
+			TokenBucket *		rateLimit;
+			/**　@brief 実行待ちのThreadFunctionの積み上げを集約するか */
+			std::atomic<bool>	coalescing;
+			/**　@brief 受付制御の待ち時間の目標(ナノ秒)。0の場合は無効 */
+			std::atomic<long long>	overloadTarget;
+			/**　@brief 受付制御の判定間隔(ナノ秒) */
+			std::atomic<long long>	overloadInterval;
+			/**　@brief 生産者毎のバッファのサイズ。0の場合は使用しない */
+			std::atomic<unsigned int>	producerSize;
+			/**　@brief 生産者毎のバッファを公開するまでの時間(ナノ秒) */
+			long long			producerInterval;
+			/**　@brief 公開済みで未実行の最大数 */
+			unsigned int		producerLimit;
+			/**　@brief 生産者毎のバッファの対象外の設定(TH_SCHED_FAIR、ジャーナル使用時)か */
+			std::atomic<bool>	producerExcluded;
+			/**　@brief スレッド毎のコンテキストの生成処理。NULLの場合は生成しない */
+			ThreadContextCreate_t	contextCreate;
+			/**　@brief スレッド毎のコンテキストの破棄処理 */
+			ThreadContextDestroy_t	contextDestroy;
+			/**　@brief 積み上げたデータを記録するジャーナル。NULLの場合は記録しない */
+			Journal *			journal;
+			/**　@brief ジャーナルに記録するデータのサイズ */
+			size_t				journalPayload;
+			/**　@brief ファイルディスクリプタ監視用オブジェクト。初回使用時に作成 */
+			Reactor *			reactor;
+			/**　@brief スレッド属性のスタックサイズ */
+			long				stacksize;
+			/**　@brief スレッドの状態を保持 */
+			long				threadCondition;
+			/**　@brief レジストリに登録済みか */
+			bool				registered;
+			/**　@brief レジストリでのグループ */
+			int					registryGroup;
+			/** @brief 未回収(pthread_join前)のスレッドが存在するか */
+			bool				joinable;
 			/** @brief 実行スレッド用スレッドID */
 			pthread_t			threadhandle;
 			/** @brief スレッドのID */
@@ -111,61 +377,199 @@ namespace VSTD
 			pthread_attr_t	thread_attr;
 			/** @brief スレッドのスケジュールパラメータ */
 			sched_param		thread_sched_param;
+			/**　@brief 監視にて通知済みのbusySince */
+			std::atomic<long long>		watchdogFlagged;
+			/**　@brief waitThreadStateにて待機中のスレッド数 */
+			std::atomic<int>			stateWaiters;
+			/* ---------------------------------------------------------------
+			 * 待ち行列(生産者・消費者共有。mutexにて保護)
+			 * --------------------------------------------------------------- */
 			/** @brief 条件変数の待ち行列を格納用 */
-			void **			threadQueue;
+			alignas(TH_CACHE_LINE)
+			ThreadQueue_t *	threadQueue;
 			/** @brief シグナル待機中条件変数の最大数 */
 			unsigned int		threadQueDepath;
-			/** @brief 現在の条件変数の数 */
-			unsigned int		currentThreadQueue;
+			/** @brief 現在の条件変数の数。ミューテックス無しで参照可能 */
+			std::atomic<unsigned int>	currentThreadQueue;
+			/**　@brief 集約により積み上げを省略した数 */
+			std::atomic<unsigned long>	coalescedFunctions;
+			/**　@brief 過負荷により積み上げを拒否中か */
+			std::atomic<bool>			overloaded;
+			/**　@brief 過負荷により積み上げを拒否した数 */
+			std::atomic<unsigned long>	shedFunctions;
+			/**　@brief 公開済みのまとまり(新しいものが先頭) */
+			std::atomic<ProducerBatch_t *>	producerBatches;
+			/**　@brief 公開済みで未実行の数 */
+			std::atomic<unsigned int>	producerBacklog;
+			/**　@brief 未公開のデータを保持しているバッファの数 */
+			std::atomic<unsigned int>	producerArmed;
+			/**　@brief 登録されている生産者毎のバッファ(ミューテックスにて保護) */
+			ProducerBuffer_t *	producers;
+			/**　@brief 登録されているテナントの数 */
+			unsigned int		tenantCount;
+			/**　@brief 取り出し中のテナント位置 */
+			unsigned int		tenantCursor;
+			/**　@brief 取り出し中のテナントに今回の巡回分を加算済みか */
+			bool				tenantTurn;
+			/**　@brief テナント毎の待ち行列 */
+			ThreadTenant_t *	tenants[MAX_TENANT];
+			/**　@brief メッセージ用リング。初回のpost時に確保 */
+			char *				messageRing;
+			/**　@brief メッセージ用リングの容量(2のべき乗) */
+			size_t				messageCapacity;
+			/**　@brief メッセージの追加位置 */
+			std::atomic<uint64_t>		messageTail;
+			/**　@brief 構築中のメッセージの次の追加位置 */
+			uint64_t			messageReserved;
+			/* @brief スレッドの条件変数操作用オブジェクト */
+			alignas(TH_CACHE_LINE)
+			Condition			condition;
+			/* ---------------------------------------------------------------
+			 * ワーカースレッド側(ワーカースレッドが書き込み)
+			 * --------------------------------------------------------------- */
+			/**　@brief スレッドステータス保持用 */
+			alignas(TH_CACHE_LINE)
+			std::atomic<ThreadState_t>	threadstatus;
+			/** @brief スレッド実行フラグ */
+			std::atomic<bool>			running;
 			/**　@brief 現在処理されている条件変数　*/
 			void *				ProcessQueue;
-			/**　@brief スレッドステータス保持用 */
-			ThreadState_t		threadstatus;
-			/** @brief スレッドのアイドリング時間*/
-			long				threadIdle;
-			/**　@brief 実行されるスレッドの種類 */
-			ThreadType_t		threadtype;
-			/**　@brief スレッド属性のスタックサイズ */
-			long				stacksize;
-			/**　@brief スレッドの状態を保持 */
-			long				threadCondition;
+			/**　@brief 現在処理されている条件変数の実行期限　*/
+			struct timespec	ProcessDeadline;
+			/**　@brief 現在処理されている条件変数のテナントID */
+			int					ProcessTenant;
+			/**　@brief 現在処理されている条件変数を追加した時刻(ナノ秒) */
+			long long			ProcessEnqueued;
+			/**　@brief 取り出した時点で最も古い要素を追加した時刻(ナノ秒)。受付制御に使用 */
+			long long			ProcessOldest;
+			/**　@brief 実行期限切れにより破棄された数 */
+			unsigned long		expiredFunctions;
+			/**　@brief メッセージの取り出し位置 */
+			std::atomic<uint64_t>		messageHead;
+			/**　@brief 待ち時間が目標を超え続けた場合に過負荷とする時刻(ナノ秒)。目標未満の場合は0 */
+			long long			overloadSince;
+			/**　@brief 流量制限により取り出せない場合の次の補充までの時間(ナノ秒) */
+			long long			throttleWait;
+			/**　@brief 流量制限による待機の起床用futex */
+			std::atomic<int>			throttleSeq;
+			/**　@brief 流量制限により待機中か */
+			std::atomic<bool>			throttleParked;
+			/**　@brief 実行中の処理を開始した時刻(ナノ秒)。待機中は0 */
+			std::atomic<long long>		busySince;
+			/**　@brief 処理された総数 */
+			std::atomic<unsigned long>	processedFunctions;
+			/**　@brief 待ち行列での待ち時間の総計(ナノ秒) */
+			std::atomic<long long>		totalWait;
+			/**　@brief 待ち行列での待ち時間の最大(ナノ秒) */
+			std::atomic<long long>		maxWait;
 			/* ***************************************************************
 			 * プライベートメソッド
 			 * ***************************************************************/
-			bool	push(void * FuncQue);
+			bool	push(
+						void *					FuncQue
+					,	const struct timespec *	deadline=NULL
+					,	int						tenant=TH_TENANT_DEFAULT
+						);
 			bool	pop();
+			bool	popLocked();
+			bool	runBatch(unsigned int num);
+			bool	park();
+			void	unpark();
+			bool	popTenant();
+			ThreadTenant_t *	findTenant(int tenant);
+			ThreadTenant_t *	createTenant(int tenant , unsigned int weight , unsigned int depth);
 			bool	empty();
+			void	heapUp(unsigned int index);
+			void	heapDown(unsigned int index);
+			bool	isExpired(const struct timespec * deadline);
+			void	initialize(int size);
+			void	join();
+			void	beginBusy();
+			void	endBusy();
+			void	updateOverload(long long now , long long wait);
+			unsigned int	moveFunctions(ThreadCall * target , unsigned int num);
+			Reactor *		getReactor();
+			void	signal();
+			bool	dispatch(void * Data);
+			void	setThreadState(ThreadState_t state);
+			bool	waitState(unsigned int mask , long long timeoutNs);
+			void *	beginPost(size_t len , void (*destroy)(void *));
+			void	endPost(void * area , bool commit);
+			bool	runMessages();
+			bool	isProducerBuffered(const struct timespec * deadline);
+			ProducerBuffer_t *	getProducerBuffer(bool create);
+			bool	bufferFunction(void * item , bool function);
+			void	publishBatch(ProducerBatch_t * batch , bool notify);
+			bool	runProducers();
+			bool	refillJournal(Journal * journaled);
+			long long	sweepProducers();
+			void	clearProducers();
+			void	abandonBatch(ProducerBatch_t * batch);
+			friend struct	ProducerLocal;
+			void	clearMessages();
+			/**
+			 * @brief		destroyMessage
+			 * 				型付きメッセージの破棄
+			 * @param[in]	data：post<T>にて構築したメッセージ
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class T>
+			static void	destroyMessage(void * data)
+			{
+				((T *)data)->~T();
+			}
 		public:
 			/* ***************************************************************
 			 * パブリックメンバ変数
 			 * ***************************************************************/
 			/**　@brief ミューテックス管理用オブジェクト */
+			alignas(TH_CACHE_LINE)
 			Mutex	  mutex;
 			/* ***************************************************************
 			 * コンストラクタ/デストラクタ
 			 * ***************************************************************/
 			ThreadCall(void);
+			explicit ThreadCall(int size);
 			virtual ~ThreadCall(void);
+			static void *	operator new(size_t size);
+			static void	operator delete(void * ptr);
 			/* ***************************************************************
 			 * フレンドメソッド
 			 * ***************************************************************/
 			friend void *	callBackFunction(void * lpvData);
+			friend class	ThreadRegistry;
+			friend class	Reactor;
 			/* ***************************************************************
 			 * 仮想メソッド
 			 * ***************************************************************/
 			virtual bool	onFunction(void * Data);
 			virtual bool	onFunction();
+			virtual bool	onFunction(const void * data , size_t len);
+			virtual bool	onFunctions(void ** items , size_t num);
+			virtual bool	onExpired(void * Data);
+			virtual bool	onThreadStart();
+			virtual void	onThreadExit();
 			/* ***************************************************************
 			 * パブリックメソッド
 			 * ***************************************************************/
 			bool			signalRunning();
 			bool			setFunction(void * Data=NULL);
 			bool			setFunction(ThreadFunction *Func);
+			bool			setFunction(
+								void *					Data
+							,	const struct timespec *	deadline
+											);
+			bool			setFunction(
+								ThreadFunction *		Func
+							,	const struct timespec *	deadline
+											);
 			void			stop();
 			bool			start();
 			void			getThreadId(pthread_t *thrteadid);
 			ThreadState_t	getThreadStatus();
 			bool			isThreadRunning(long dwTimeout=0);
+			bool			waitThreadState(ThreadState_t state , long long timeoutNs = 0);
 			long			getObjectCondition();
 			void			setThreadType(
 								ThreadType_t	type = TH_TYP_EVENTDRIVEN
@@ -176,6 +580,175 @@ namespace VSTD
 			int				getStackSize();
 			void			setMaxThread(int maxsize);
 			unsigned int	getThreadFunctions();
+			bool			setScheduleType(ThreadSchedule_t type = TH_SCHED_LIFO);
+			ThreadSchedule_t	getScheduleType();
+			void			setBatchSize(unsigned int size = 1);
+			unsigned int	getBatchSize();
+			void			getMonitorStat(ThreadMonitorStat_t * stat);
+			void			setRegistryGroup(int group);
+			int				getRegistryGroup();
+			unsigned long	getExpiredFunctions();
+			void			setCoalescing(bool enable = true);
+			bool			isCoalescing();
+			unsigned long	getCoalescedFunctions();
+			void			setAdmissionControl(long target , long interval = 100000);
+			bool			isOverloaded();
+			unsigned long	getShedFunctions();
+			bool			setJournal(Journal * target , size_t payloadSize);
+			bool			setProducerBuffer(
+								unsigned int	size
+							,	long			interval = TH_PRODUCER_INTERVAL
+							,	unsigned int	backlog = TH_PRODUCER_BACKLOG
+											);
+			void			flush();
+			void			setThreadContext(
+								ThreadContextCreate_t	create
+							,	ThreadContextDestroy_t	destroy
+											);
+			static void *		getThreadContext();
+			static ThreadCall *	getCurrentThread();
+			size_t			replayJournal();
+			bool			post(const void * data , size_t len);
+			bool			setMessageCapacity(size_t capacity);
+			bool			addWatch(int fd , unsigned int events , ReactorFunction * handler);
+			bool			modifyWatch(int fd , unsigned int events);
+			bool			removeWatch(int fd);
+			int				addTimer(long interval , ReactorFunction * handler , bool repeat = true);
+			bool			removeTimer(int timer);
+			bool			addTenant(
+								int				tenant
+							,	unsigned int	weight = 1
+							,	unsigned int	depth = TH_TENANT_DEPTH
+											);
+			bool			removeTenant(int tenant);
+			bool			getTenantStat(int tenant , ThreadTenantStat_t * stat);
+			void			setRateLimit(TokenBucket * bucket);
+			bool			setTenantRateLimit(int tenant , TokenBucket * bucket);
+			bool			setTenantFunction(
+								int						tenant
+							,	ThreadFunction *		Func
+							,	const struct timespec *	deadline = NULL
+											);
+			bool			setTenantFunction(
+								int						tenant
+							,	void *					Data
+							,	const struct timespec *	deadline = NULL
+											);
+			/**
+			 * @brief		submit
+			 * 				型付き実行結果を返却する関数の積み上げ
+			 * @note		関数オブジェクトをThreadFunctionとして待ち行列に追加し
+			 * 				実行結果を受け取る為のFutureを返却します。
+			 * 				実行結果は共有状態内に直接構築され、ムーブのみ可能な型も
+			 * 				複製無しに受け取る事が出来ます。
+			 * 				積み上げに失敗した場合、実行期限切れとなった場合は
+			 * 				FutureはFUTURE_ABANDONEDとなります。
+			 * 				onFunction(void*)をラッピングしている場合は
+			 * 				基底クラスのonFunctionを呼び出してください。
+			 * @param[in]	func：実行する関数オブジェクトを指定
+			 * @param[in]	deadline：実行期限(CLOCK_MONOTONIC)を指定。NULLの場合は期限無し
+			 * @return	実行結果受け取り用のFutureを返却します。
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class R , class F>
+			Future<R>		submit(F && func , const struct timespec * deadline = NULL)
+			{
+				typedef FutureTask<R , typename std::decay<F>::type>	Task;
+				Task *		task = new Task(std::forward<F>(func));
+				Future<R>	future(task->getState());
+				if (!setFunction(task , deadline))
+				{
+					delete task;
+				}
+				return future;
+			}
+			/**
+			 * @brief		createContext
+			 * 				型付きコンテキストの生成
+			 * @note		setThreadContext<T>、ThreadPoolConfig_tにて使用します。
+			 * @param[in]	owner：コンテキストを使用するThreadCall
+			 * @return	生成したコンテキストを返却します。
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class T>
+			static void *	createContext(ThreadCall * owner)
+			{
+				(void)owner;
+				return new T();
+			}
+			/**
+			 * @brief		destroyContext
+			 * 				型付きコンテキストの破棄
+			 * @param[in]	context：createContext<T>にて生成したコンテキスト
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class T>
+			static void	destroyContext(void * context)
+			{
+				delete (T *)context;
+			}
+			/**
+			 * @brief		setThreadContext
+			 * 				型付きコンテキストの設定
+			 * @note		スレッド毎にTをデフォルトコンストラクタにて生成し、
+			 * 				スレッドの終了時に破棄します。
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class T>
+			void			setThreadContext()
+			{
+				setThreadContext(&ThreadCall::createContext<T> , &ThreadCall::destroyContext<T>);
+			}
+			/**
+			 * @brief		getThreadContext
+			 * 				型付きコンテキストの取得
+			 * @note		実行中のスレッドのコンテキストをロック無しで取得します。
+			 * 				ThreadFunction::Function内からも呼び出せます。
+			 * @return	コンテキストを返却します。ThreadCallのスレッド以外ではNULL
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class T>
+			static T *		getThreadContext()
+			{
+				return (T *)getThreadContext();
+			}
+			/**
+			 * @brief		post
+			 * 				型付きメッセージの積み上げ
+			 * @note		値をメッセージ用リング上に直接ムーブ(コピー)構築して
+			 * 				積み上げます。スレッド上でonFunction(const void*,size_t)に
+			 * 				リング上の値が渡され、呼び出し完了後に破棄されます。
+			 * 				構築はミューテックスを保持した状態で行われる為、
+			 * 				構築中にThreadCallを操作しないでください。
+			 * @param[in]	value：積み上げる値を指定
+			 * @return	成否を返却します。リングに空きが無い場合は失敗します。
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class T>
+			bool			post(T && value)
+			{
+				typedef typename std::decay<T>::type	Type;
+				static_assert(alignof(Type) <= TH_MESSAGE_ALIGN , "alignment exceeds TH_MESSAGE_ALIGN");
+				void * area = beginPost(sizeof(Type) , &ThreadCall::destroyMessage<Type>);
+				if (!area) return false;
+				try
+				{
+					new (area) Type(std::forward<T>(value));
+				}
+				catch(...)
+				{
+					endPost(area , false);
+					throw;
+				}
+				endPost(area , true);
+				return true;
+			}
 	};
 }
 #endif
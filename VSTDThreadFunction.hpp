@@ -7,17 +7,27 @@
  *  
  * @par 更新履歴：
  * - 2009/07/16	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 実行期限切れステータスを追加
+ * - 2026/10/19	Sebastian 処理完了後の自動解放を追加
+ * - 2026/10/19	Sebastian ステータスをatomic化し待機(waitStatus)を追加
+ * - 2026/10/19	Sebastian 積み上げの集約用にmarkWaitingを追加
+ * - 2026/10/19	Sebastian 実行・完了・自動解放をexecuteに集約
  * ***************************************************************************/
 #ifndef VSTDTHREADFUNCTION_H_
 #define VSTDTHREADFUNCTION_H_
 /* ***************************************************************************
  * including library
  * ***************************************************************************/
+#include <atomic>
 #include "VSTDMutex.hpp"
+#include "VSTDFutex.hpp"
 
 namespace VSTD
 {
 	void Sleep( unsigned int mseconds);
+	long long GetMonotonicTime();
+	/** @brief ステータスの待機中のスレッドが存在する事を示すビット */
+	#define THFUNC_STATE_WAITER	0x40000000
 	/**
 	 * @brief		スレッドファンクションの実行状況を定義している列挙体
 	 * @author	Sebastian
@@ -32,7 +42,9 @@ namespace VSTD
 		/** @brief 実行中です */
 		THFUNC_STATE_PROCESSED,
 		/** @brief 実行完了 */
-		THFUNC_STATE_COMLETED
+		THFUNC_STATE_COMLETED,
+		/** @brief 実行期限切れにより破棄されました */
+		THFUNC_STATE_EXPIRED
 	} functionstatus_t;
 	/**
 	 * @brief		ThreadFunction
@@ -46,13 +58,21 @@ namespace VSTD
 	class ThreadFunction
 	{
 	private:
-		/** @brief スレッドファンクションのステータスを示します。  */
-		functionstatus_t	functionstate;
+		/**
+		 * @brief スレッドファンクションのステータスを示します。
+		 * 		  待機中のスレッドが存在する場合はTHFUNC_STATE_WAITERが付加されます。
+		 */
+		std::atomic<int>	functionstate;
+		/** @brief 処理完了後にThreadCallにて破棄するか */
+		bool				autorelease;
 		/** @brief スレッドファンクションのスレッドIDを保持します。  */
 		pthread_t			FunctionId;
 	public:
-		/** @brief スレッドファンクション用のミューテックス管理オブジェクト */
-		Mutex mutex;
+		/**
+		 * @brief スレッドファンクション用のミューテックス管理オブジェクト
+		 * @note  初回のlock時に作成されます。ステータスの操作には使用されません。
+		 */
+		LazyMutex mutex;
 		/**
 		 * @brief		setStatus
 		 * 				ステータスの設定
@@ -63,9 +83,119 @@ namespace VSTD
 		 */
 		void setStatus(functionstatus_t state)
 		{
-			mutex.lock();
-			functionstate=state;
-			mutex.unlock();
+			int old = functionstate.exchange(state , std::memory_order_acq_rel);
+			/* 待機中のスレッドが存在する場合のみ起床 */
+			if (old & THFUNC_STATE_WAITER)
+			{
+				FutexWake(&functionstate);
+			}
+		}
+		/**
+		 * @brief		markWaiting
+		 * 				実行待ちへの遷移
+		 * @note		ステータスが実行待ち(THFUNC_STATE_WAITING)以外の場合のみ
+		 * 				CASにて実行待ちへ変更します。
+		 * 				既に実行待ちの場合は変更せずにfalseを返却する為、
+		 * 				同時に積み上げた場合も待ち行列に入るのは一つのみとなります。
+		 * @param[out]	previous : 変更前のステータスを格納します。NULLの場合は格納しません。
+		 * @return		変更した場合はtrue、既に実行待ちの場合はfalse
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		bool markWaiting(functionstatus_t * previous = NULL)
+		{
+			int current = functionstate.load(std::memory_order_acquire);
+			while (true)
+			{
+				if ((current & ~THFUNC_STATE_WAITER) == THFUNC_STATE_WAITING) return false;
+				if (functionstate.compare_exchange_weak(
+						current , THFUNC_STATE_WAITING , std::memory_order_acq_rel))
+				{
+					break;
+				}
+			}
+			if (previous)
+			{
+				*previous = (functionstatus_t)(current & ~THFUNC_STATE_WAITER);
+			}
+			/* 待機中のスレッドが存在する場合のみ起床 */
+			if (current & THFUNC_STATE_WAITER)
+			{
+				FutexWake(&functionstate);
+			}
+			return true;
+		}
+		/**
+		 * @brief		markCompleted
+		 * 				完了への遷移
+		 * @note		ステータスが実行中(THFUNC_STATE_PROCESSED)の場合のみ
+		 * 				CASにて完了へ変更します。
+		 * 				実行中に再度積み上げられ実行待ちとなっている場合は
+		 * 				変更せずにfalseを返却する為、実行待ちが失われる事はありません。
+		 * @return		変更した場合はtrue、実行中以外の場合はfalse
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		bool markCompleted()
+		{
+			int current = functionstate.load(std::memory_order_acquire);
+			while (true)
+			{
+				if ((current & ~THFUNC_STATE_WAITER) != THFUNC_STATE_PROCESSED) return false;
+				if (functionstate.compare_exchange_weak(
+						current , THFUNC_STATE_COMLETED , std::memory_order_acq_rel))
+				{
+					break;
+				}
+			}
+			/* 待機中のスレッドが存在する場合のみ起床 */
+			if (current & THFUNC_STATE_WAITER)
+			{
+				FutexWake(&functionstate);
+			}
+			return true;
+		}
+		/**
+		 * @brief		execute
+		 * 				実行と完了への遷移
+		 * @note		実行中(THFUNC_STATE_PROCESSED)としてFunctionを呼び出し、
+		 * 				markCompletedにて完了とします。
+		 * 				実行中に再度積み上げられた場合は完了とせず、破棄もしません。
+		 * 				完了とした場合、自動解放が指定されていればdeleteする為、
+		 * 				呼び出し後はオブジェクトを参照しないでください。
+		 * 				Functionが例外を送出した場合も同様に完了とし、例外を再送出します。
+		 * @param[out]	completed : 完了とした場合はtrueを格納します。NULLの場合は格納しません。
+		 * @return		Functionの戻り値を返却します。
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		bool execute(bool * completed = NULL)
+		{
+			bool release = autorelease;
+			bool retVal;
+			setStatus(THFUNC_STATE_PROCESSED);
+			try
+			{
+				retVal = Function();
+			}
+			catch(...)
+			{
+				if (markCompleted() && release)
+				{
+					delete this;
+				}
+				throw;
+			}
+			bool done = markCompleted();
+			if (completed)
+			{
+				*completed = done;
+			}
+			if (done && release)
+			{
+				delete this;
+			}
+			return retVal;
 		}
 		/**
 		 * @brief		getStatus
@@ -77,11 +207,60 @@ namespace VSTD
 		 */
 		functionstatus_t getStatus()
 		{
-			functionstatus_t state ;
-			mutex.lock();
-			state = functionstate;
-			mutex.unlock();
-			return state;
+			return (functionstatus_t)(functionstate.load(std::memory_order_acquire) & ~THFUNC_STATE_WAITER);
+		}
+		/**
+		 * @brief		waitStatus
+		 * 				ステータスの待機
+		 * @note		ステータスが指定した値となるまで待機します。
+		 * 				ステータスの変更時にfutexにて起床されます。
+		 * @param[in]	state : 待機するステータスを指定します。
+		 * @param[in]	timeoutNs : タイムアウトをナノ秒にて指定します。0の場合は無期限
+		 * @return		指定したステータスとなった場合はtrue、タイムアウトの場合はfalse
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		bool waitStatus(functionstatus_t state , long long timeoutNs = 0)
+		{
+			return waitStatus(state , state , timeoutNs);
+		}
+		/**
+		 * @brief		waitStatus
+		 * 				ステータスの待機
+		 * @note		ステータスが指定した何れかの値となるまで待機します。
+		 * @param[in]	state : 待機するステータスを指定します。
+		 * @param[in]	other : 待機するもう一方のステータスを指定します。
+		 * @param[in]	timeoutNs : タイムアウトをナノ秒にて指定します。0の場合は無期限
+		 * @return		指定したステータスとなった場合はtrue、タイムアウトの場合はfalse
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		bool waitStatus(functionstatus_t state , functionstatus_t other , long long timeoutNs)
+		{
+			long long limit = timeoutNs > 0 ? GetMonotonicTime() + timeoutNs : 0;
+			while (true)
+			{
+				int current = functionstate.load(std::memory_order_acquire);
+				if ((current & ~THFUNC_STATE_WAITER) == state) return true;
+				if ((current & ~THFUNC_STATE_WAITER) == other) return true;
+				long long remain = 0;
+				if (timeoutNs > 0)
+				{
+					remain = limit - GetMonotonicTime();
+					if (remain <= 0) return false;
+				}
+				/* 待機中である事を示してから待機 */
+				if (!(current & THFUNC_STATE_WAITER))
+				{
+					if (!functionstate.compare_exchange_weak(
+							current , current | THFUNC_STATE_WAITER , std::memory_order_acq_rel))
+					{
+						continue;
+					}
+					current |= THFUNC_STATE_WAITER;
+				}
+				FutexWait(&functionstate , current , remain);
+			}
 		}
 		/**
 		 * @brief		setThreadId
@@ -107,18 +286,43 @@ namespace VSTD
 		{
 			memcpy(threadId , &FunctionId , sizeof(pthread_t));
 		}
+		/**
+		 * @brief		setAutoRelease
+		 * 				自動解放の設定
+		 * @note		trueを指定した場合、ThreadCallにて処理完了後
+		 * 				(実行期限切れの場合を含む)にdeleteされます。
+		 * 				new にて生成したオブジェクトにのみ指定してください。
+		 * @param[in]	release : 自動解放するかを指定します。
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		void setAutoRelease(bool release)
+		{
+			autorelease = release;
+		}
+		/**
+		 * @brief		isAutoRelease
+		 * 				自動解放の取得
+		 * @return		自動解放が指定されているかを返却します。
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		bool isAutoRelease()
+		{
+			return autorelease;
+		}
 		/**
 		 * @brief		wait
-		 * 				スレッドの一時停止
-		 * @note		一定時間処理を停止します。
-		 * 				実行された場合、指定したタイムアウトを迎えるか
-		 * 				100milli秒経過するまでスレッドファンクションを停止します。
-		 * 				ただし、ステータスが既に完了(THFUNC_STATE_COMLETED)に
-		 * 				ある場合は、停止せずにそのままメソッドを完了します。
+		 * 				スレッドファンクションの完了待機
+		 * @note		指定したタイムアウトを迎えるまで
+		 * 				スレッドファンクションの完了を待機します。
+		 * 				ただし、ステータスが既に完了(THFUNC_STATE_COMLETED)
+		 * 				又は期限切れ(THFUNC_STATE_EXPIRED)にある場合は、
+		 * 				停止せずにそのままメソッドを完了します。
 		 * @param[in]	timeout : タイムアウト時間を秒指定します。
 		 * @return	待機状況をboolにて返却します。
-		 * @retval	true : スレッド完了した場合
-		 * @retval	false : タイムアウト、もしくは一時停止が発生した場合。
+		 * @retval	true : スレッド完了又は期限切れにより破棄された場合
+		 * @retval	false : タイムアウトした場合。
 		 * @author	Sebastian
 		 * @date		2009/7/16
 		 */
@@ -126,26 +330,21 @@ namespace VSTD
 		{
 			/* *******************************************************************
 			 * スレッドファンクションが既に完了済みの場合はそのまま終了します。
+			 * 期限切れにより破棄された場合も以降完了する事はない為終了します。
 			 * *******************************************************************/
-			if (getStatus() == THFUNC_STATE_COMLETED)
+			functionstatus_t status = getStatus();
+			if (status == THFUNC_STATE_COMLETED || status == THFUNC_STATE_EXPIRED)
 			{
 				return true;
 			}
-
-			/* *******************************************************************
-			 * 未完了でありタイムアウトしていない状況の場合は一定時間待機します。
-			 * *******************************************************************/
-			/* MilliSecに変換 */
-			timeout = timeout * 1000;
-			if( getStatus() != THFUNC_STATE_COMLETED
-			 && timeout > 0)
+			if (timeout <= 0)
 			{
-				/* 100milli秒停止 */
-				Sleep(100);
-				/* タイムアウトから100milli秒引く */
-				timeout = timeout - 100;
+				return false;
 			}
-			return false;
+			/* *******************************************************************
+			 * 未完了の場合はタイムアウトまで完了を待機します。
+			 * *******************************************************************/
+			return waitStatus(THFUNC_STATE_COMLETED , THFUNC_STATE_EXPIRED , (long long)timeout * 1000000000LL);
 		}
 		/**
 		 * @brief		ThreadFunctionのコンストラクタ
@@ -155,9 +354,32 @@ namespace VSTD
 		ThreadFunction()
 		{
 			/* ステータスの初期化 */
-			functionstate = THFUNC_STATE_NOTSUBMITTED;
+			functionstate.store(THFUNC_STATE_NOTSUBMITTED , std::memory_order_relaxed);
 			/* スレッドIDの初期化 */
 			memset(&FunctionId , 0 , sizeof(pthread_t));
+			/* 自動解放の初期化 */
+			autorelease = false;
+		}
+		/**
+		 * @brief		ThreadFunctionのコピーコンストラクタ
+		 * @note		ステータスは待機中のスレッドを除いて複製します。
+		 * @author	Sebastian
+		 * @date		2026/10/19
+		 */
+		ThreadFunction(const ThreadFunction & other)
+		{
+			functionstate.store(
+				other.functionstate.load(std::memory_order_acquire) & ~THFUNC_STATE_WAITER
+			,	std::memory_order_relaxed);
+			memcpy(&FunctionId , &other.FunctionId , sizeof(pthread_t));
+			autorelease = other.autorelease;
+		}
+		ThreadFunction & operator=(const ThreadFunction & other)
+		{
+			setStatus((functionstatus_t)(other.functionstate.load(std::memory_order_acquire) & ~THFUNC_STATE_WAITER));
+			memcpy(&FunctionId , &other.FunctionId , sizeof(pthread_t));
+			autorelease = other.autorelease;
+			return *this;
 		}
 		/**
 		 * @brief		ThreadFunctionのデストラクタ
@@ -0,0 +1,812 @@
+/* ***************************************************************************
+ * @file		VSTDThreadPool.cpp
+ * @brief		伸縮型スレッドプール Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian キー毎の直列実行(ストランド)を追加
+ * - 2026/10/19	Sebastian ワーカー毎のコンテキストを追加
+ * ***************************************************************************/
+#include "VSTDThreadPool.hpp"
+
+namespace VSTD
+{
+	/**
+	 * @brief		経過時間の算出
+	 * @param[in]	from：開始時刻
+	 * @param[in]	to：終了時刻
+	 * @return	経過時間をミリ秒にて返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static long elapsedMilli(const struct timespec * from , const struct timespec * to)
+	{
+		return (long)(to->tv_sec - from->tv_sec) * 1000
+			 + (to->tv_nsec - from->tv_nsec) / 1000000;
+	}
+	/* ***********************************************************************
+	 *
+	 * PoolWorker
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		PoolWorkerのコンストラクタ
+	 * @param[in]	owner：所属するプールを指定します。
+	 * @param[in]	size：スタックサイズを指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PoolWorker::PoolWorker(ThreadPool * owner , int size)
+		: ThreadCall(size) , pool(owner) , idle(true)
+	{
+		clock_gettime(CLOCK_MONOTONIC , &idleSince);
+		/* 停止時の確認間隔を短縮 */
+		setIdle(1);
+	}
+	/**
+	 * @brief		PoolWorkerのデストラクタ
+	 * @note		派生クラスの破棄前にスレッドを停止します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PoolWorker::~PoolWorker(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		onFunction
+	 * 				プールの待ち行列の実行
+	 * @note		プールの待ち行列が空になるまでThreadFunctionを取り出して
+	 * 				実行します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool PoolWorker::onFunction()
+	{
+		ThreadFunction * Func;
+		try
+		{
+			while ((Func = pool->take(this)) != NULL)
+			{
+				ThreadCall::onFunction((void *)Func);
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * PoolSupervisor
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		PoolSupervisorのコンストラクタ
+	 * @param[in]	owner：監視するプールを指定します。
+	 * @param[in]	interval：判定間隔をミリ秒にて指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PoolSupervisor::PoolSupervisor(ThreadPool * owner , long interval)
+		: ThreadCall() , pool(owner)
+	{
+		setThreadType(TH_TYP_INTERVAL , interval);
+	}
+	/**
+	 * @brief		PoolSupervisorのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	PoolSupervisor::~PoolSupervisor(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		onFunction
+	 * 				プールの伸縮判定
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool PoolSupervisor::onFunction()
+	{
+		pool->adjust();
+		return true;
+	}
+	/* ***********************************************************************
+	 *
+	 * StrandRunner
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		StrandRunnerのコンストラクタ
+	 * @note		処理完了後に破棄される様に自動解放を指定します。
+	 * @param[in]	owner：所属するプール
+	 * @param[in]	target：実行するストランド
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	StrandRunner::StrandRunner(ThreadPool * owner , Strand_t * target)
+	{
+		pool		= owner;
+		strand	= target;
+		setAutoRelease(true);
+	}
+	/**
+	 * @brief		Function
+	 * 				ストランドの待ち行列の実行
+	 * @note		ミューテックスは取り出し時のみ取得し、実行中は保持しません。
+	 * 				同一ストランドのStrandRunnerは常に一つである為、
+	 * 				同一キーのThreadFunctionが並行して実行される事はありません。
+	 * @return	常にtrueを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool StrandRunner::Function()
+	{
+		StrandNode_t *	node;
+		bool			yield = false;
+		unsigned int	num = 0;
+		try
+		{
+			while ((node = pool->nextStrandFunction(strand , &yield)) != NULL)
+			{
+				ThreadFunction * Func = node->func;
+				delete node;
+				/* 実行中に再度積み上げられた場合はストランドにある為、完了とせず破棄もしない */
+				Func->execute();
+				/* 他のストランドへ譲る */
+				if (++num >= STRAND_BATCH)
+				{
+					yield = true;
+					num = 0;
+				}
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/* ***********************************************************************
+	 *
+	 * ThreadPool
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		ThreadPoolのコンストラクタ
+	 * @note		最小数のワーカーを作成し、伸縮判定を開始します。
+	 * @param[in]	conf：伸縮設定を指定します。NULLの場合は既定値
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadPool::ThreadPool(const ThreadPoolConfig_t * conf)
+	{
+		if (conf)
+		{
+			config = *conf;
+		}
+		else
+		{
+			getDefaultConfig(&config);
+		}
+		if (config.maxWorkers > MAX_POOL_WORKER) config.maxWorkers = MAX_POOL_WORKER;
+		if (config.minWorkers < 1) config.minWorkers = 1;
+		if (config.maxWorkers < config.minWorkers) config.maxWorkers = config.minWorkers;
+		if (config.depth < 1) config.depth = 1;
+		memset(workers , 0 , sizeof(workers));
+		workerCount	= 0;
+		head			= 0;
+		count			= 0;
+		spawned		= 0;
+		retired		= 0;
+		rejected		= 0;
+		stopping		= false;
+		supervisor	= NULL;
+		strandCount	= 0;
+		memset(strands , 0 , sizeof(strands));
+		queue			= new ThreadFunction * [config.depth];
+		enqueued		= new struct timespec [config.depth];
+		for (unsigned int i = 0 ; i < config.minWorkers ; i++)
+		{
+			spawn();
+		}
+		clock_gettime(CLOCK_MONOTONIC , &lastScale);
+		if (config.minWorkers < config.maxWorkers)
+		{
+			supervisor = new PoolSupervisor(this , config.interval);
+		}
+	}
+	/**
+	 * @brief		ThreadPoolのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadPool::~ThreadPool(void)
+	{
+		stop();
+		delete [] queue;
+		delete [] enqueued;
+		/* 実行されなかったストランドの破棄 */
+		for (unsigned int i = 0 ; i < MAX_STRAND_BUCKET ; i++)
+		{
+			while (strands[i])
+			{
+				Strand_t * strand = strands[i];
+				strands[i] = strand->next;
+				while (strand->head)
+				{
+					StrandNode_t * node = strand->head;
+					strand->head = node->next;
+					if (node->func->isAutoRelease())
+					{
+						delete node->func;
+					}
+					delete node;
+				}
+				delete strand;
+			}
+		}
+	}
+	/**
+	 * @brief		getDefaultConfig
+	 * 				既定の伸縮設定の取得
+	 * @param[out]	conf：既定の伸縮設定を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadPool::getDefaultConfig(ThreadPoolConfig_t * conf)
+	{
+		conf->minWorkers	= 1;
+		conf->maxWorkers	= 16;
+		conf->depth		= 4096;
+		conf->growBacklog	= 4;
+		conf->growLatency	= 50;
+		conf->idleTimeout	= 30000;
+		conf->cooldown	= 1000;
+		conf->interval	= 10;
+		conf->stackSize	= 0;
+		conf->contextCreate	= NULL;
+		conf->contextDestroy	= NULL;
+	}
+	/**
+	 * @brief		setFunction
+	 * 				ThreadFunctionの積み上げ
+	 * @note		共有の待ち行列にThreadFunctionを追加し、待機中のワーカーが
+	 * 				存在する場合はシグナルを送信します。
+	 * @param[in]	Func：追加するThreadFunctionを指定
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(待ち行列が最大数に達している、停止中)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadPool::setFunction(ThreadFunction * Func)
+	{
+		PoolWorker * target = NULL;
+		try
+		{
+			if (!Func) return false;
+			Func->setStatus(THFUNC_STATE_WAITING);
+			mutex.lock();
+			if (stopping || count >= config.depth)
+			{
+				rejected++;
+				mutex.unlock();
+				return false;
+			}
+			unsigned int tail = (head + count) % config.depth;
+			queue[tail] = Func;
+			clock_gettime(CLOCK_MONOTONIC , &enqueued[tail]);
+			count++;
+			/* 待機中のワーカーを一つ起床 */
+			for (unsigned int i = 0 ; i < workerCount ; i++)
+			{
+				if (workers[i]->idle)
+				{
+					workers[i]->idle = false;
+					target = workers[i];
+					break;
+				}
+			}
+			mutex.unlock();
+			if (target)
+			{
+				target->setFunction();
+			}
+			return true;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		take
+	 * 				待ち行列の取り出し
+	 * @note		PoolWorkerから呼び出されます。待ち行列が空の場合は
+	 * 				ワーカーを待機中として記録します。
+	 * @param[in]	worker：呼び出し元のワーカー
+	 * @return	取り出したThreadFunctionを返却します。空の場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadFunction * ThreadPool::take(PoolWorker * worker)
+	{
+		ThreadFunction * Func;
+		try
+		{
+			mutex.lock();
+			if (count == 0 || stopping)
+			{
+				worker->idle = true;
+				clock_gettime(CLOCK_MONOTONIC , &worker->idleSince);
+				mutex.unlock();
+				return NULL;
+			}
+			Func = queue[head];
+			head = (head + 1) % config.depth;
+			count--;
+			worker->idle = false;
+			mutex.unlock();
+			return Func;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		adjust
+	 * 				ワーカー数の伸縮
+	 * @note		PoolSupervisorから一定間隔で呼び出されます。
+	 * 				待ち行列の数がワーカー1つあたりgrowBacklogを超えるか、
+	 * 				先頭の待ち時間がgrowLatencyを超えた場合に一つ増員します。
+	 * 				待ち行列が空であり、idleTimeoutを超えて待機している
+	 * 				ワーカーが存在する場合は一つ削減します。
+	 * 				いずれも前回の増減からcooldownが経過するまでは行いません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadPool::adjust()
+	{
+		struct timespec	now;
+		PoolWorker *		victim = NULL;
+		PoolWorker *		kick = NULL;
+		try
+		{
+			clock_gettime(CLOCK_MONOTONIC , &now);
+			mutex.lock();
+			if (stopping)
+			{
+				mutex.unlock();
+				return;
+			}
+			long latency		= count ? elapsedMilli(&enqueued[head] , &now) : 0;
+			long sinceScale	= elapsedMilli(&lastScale , &now);
+			/* *******************************************************************
+			 * 増員判定
+			 * *******************************************************************/
+			if (count > 0
+			 && workerCount < config.maxWorkers
+			 && sinceScale >= config.cooldown
+			 && (count > config.growBacklog * workerCount || latency > config.growLatency))
+			{
+				mutex.unlock();
+				spawn();
+				return;
+			}
+			/* *******************************************************************
+			 * 削減判定
+			 * *******************************************************************/
+			if (count == 0
+			 && workerCount > config.minWorkers
+			 && sinceScale >= config.cooldown)
+			{
+				long longest = config.idleTimeout;
+				unsigned int index = workerCount;
+				for (unsigned int i = 0 ; i < workerCount ; i++)
+				{
+					if (!workers[i]->idle) continue;
+					long idle = elapsedMilli(&workers[i]->idleSince , &now);
+					if (idle >= longest)
+					{
+						longest	= idle;
+						index		= i;
+					}
+				}
+				if (index < workerCount)
+				{
+					victim = workers[index];
+					workers[index] = workers[--workerCount];
+					workers[workerCount] = NULL;
+					lastScale = now;
+					retired++;
+				}
+			}
+			/* *******************************************************************
+			 * 待ち行列が残っている場合は待機中のワーカーを起床
+			 * *******************************************************************/
+			if (count > 0)
+			{
+				for (unsigned int i = 0 ; i < workerCount ; i++)
+				{
+					if (workers[i]->idle)
+					{
+						workers[i]->idle = false;
+						kick = workers[i];
+						break;
+					}
+				}
+			}
+			mutex.unlock();
+			if (kick)
+			{
+				kick->setFunction();
+			}
+			if (victim)
+			{
+				retire(victim);
+			}
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		spawn
+	 * 				ワーカーの増員
+	 * @note		設定されたスタックサイズにてワーカーを作成し、
+	 * 				待ち行列が存在する場合は処理を開始させます。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadPool::spawn()
+	{
+		PoolWorker * worker;
+		try
+		{
+			worker = new PoolWorker(this , config.stackSize);
+		}
+		catch(...)
+		{
+			return false;
+		}
+		mutex.lock();
+		if (stopping || workerCount >= config.maxWorkers)
+		{
+			mutex.unlock();
+			delete worker;
+			return false;
+		}
+		workers[workerCount++] = worker;
+		clock_gettime(CLOCK_MONOTONIC , &lastScale);
+		spawned++;
+		worker->idle = false;
+		mutex.unlock();
+		/* 初回の起床時にワーカー上でコンテキストを生成 */
+		worker->setThreadContext(config.contextCreate , config.contextDestroy);
+		/* 待ち行列の処理を開始 */
+		worker->setFunction();
+		return true;
+	}
+	/**
+	 * @brief		retire
+	 * 				ワーカーの削減
+	 * @param[in]	worker：削減するワーカー
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadPool::retire(PoolWorker * worker)
+	{
+		worker->stop();
+		delete worker;
+	}
+	/**
+	 * @brief		stop
+	 * 				プールの停止
+	 * @note		伸縮判定と全てのワーカーを停止します。
+	 * 				実行されずに残ったThreadFunctionのうち自動解放が
+	 * 				指定されたものは破棄されます。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadPool::stop()
+	{
+		PoolWorker *	stopped[MAX_POOL_WORKER];
+		unsigned int	num;
+		try
+		{
+			mutex.lock();
+			if (stopping)
+			{
+				mutex.unlock();
+				return;
+			}
+			stopping = true;
+			mutex.unlock();
+			/* 伸縮判定の停止 */
+			if (supervisor)
+			{
+				delete supervisor;
+				supervisor = NULL;
+			}
+			/* ワーカーの停止 */
+			mutex.lock();
+			num = workerCount;
+			memcpy(stopped , workers , sizeof(PoolWorker *) * num);
+			workerCount = 0;
+			mutex.unlock();
+			for (unsigned int i = 0 ; i < num ; i++)
+			{
+				retire(stopped[i]);
+			}
+			/* 残った待ち行列の破棄 */
+			mutex.lock();
+			for (; count > 0 ; count--)
+			{
+				ThreadFunction * Func = queue[head];
+				head = (head + 1) % config.depth;
+				if (Func->isAutoRelease())
+				{
+					delete Func;
+				}
+			}
+			mutex.unlock();
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getStat
+	 * 				統計情報の取得
+	 * @param[out]	stat：統計情報を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadPool::getStat(ThreadPoolStat_t * stat)
+	{
+		struct timespec now;
+		try
+		{
+			clock_gettime(CLOCK_MONOTONIC , &now);
+			mutex.lock();
+			stat->workers		= workerCount;
+			stat->idleWorkers	= 0;
+			for (unsigned int i = 0 ; i < workerCount ; i++)
+			{
+				if (workers[i]->idle) stat->idleWorkers++;
+			}
+			stat->backlog		= count;
+			stat->latency		= count ? elapsedMilli(&enqueued[head] , &now) : 0;
+			stat->spawned		= spawned;
+			stat->retired		= retired;
+			stat->rejected	= rejected;
+			mutex.unlock();
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getWorkers
+	 * 				現在のワーカー数の取得
+	 * @return	ワーカー数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int ThreadPool::getWorkers()
+	{
+		unsigned int num;
+		try
+		{
+			mutex.lock();
+			num = workerCount;
+			mutex.unlock();
+			return num;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		setStrandFunction
+	 * 				キーを指定したThreadFunctionの積み上げ
+	 * @note		同一キーのThreadFunctionは積み上げた順に一つずつ実行され、
+	 * 				並行して実行される事はありません。
+	 * 				異なるキーのThreadFunctionはワーカー間で並行して実行されます。
+	 * 				キー毎にThreadCallを作成する代わりに使用します。
+	 * @param[in]	key：直列実行するキーを指定
+	 * @param[in]	Func：追加するThreadFunctionを指定
+	 * @return	成否を返却します。
+	 * @retval	true ： 成功
+	 * @retval	false： 失敗(プールの待ち行列が最大数に達している、停止中)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadPool::setStrandFunction(unsigned long key , ThreadFunction * Func)
+	{
+		try
+		{
+			if (!Func) return false;
+			Func->setStatus(THFUNC_STATE_WAITING);
+			StrandNode_t * node = new StrandNode_t;
+			node->func = Func;
+			node->next = NULL;
+			strandMutex.lock();
+			Strand_t * strand = findStrand(key , true);
+			if (strand->tail)
+			{
+				strand->tail->next = node;
+			}
+			else
+			{
+				strand->head = node;
+			}
+			strand->tail = node;
+			/* 実行中のストランドは追加のみ */
+			if (strand->scheduled)
+			{
+				strandMutex.unlock();
+				return true;
+			}
+			/* *******************************************************************
+			 * 積み上げの判定から取り消しまでを同じ区間で行い、
+			 * 他のスレッドが実行依頼済みとして追加した要素が取り残されない様にする
+			 * *******************************************************************/
+			StrandRunner * runner = new StrandRunner(this , strand);
+			if (setFunction(runner))
+			{
+				strand->scheduled = true;
+				strandMutex.unlock();
+				return true;
+			}
+			delete runner;
+			/* プールに積めなかった場合は追加した要素を取り除く */
+			StrandNode_t ** link = &strand->head;
+			StrandNode_t *  prev = NULL;
+			while (*link && *link != node)
+			{
+				prev = *link;
+				link = &(*link)->next;
+			}
+			if (*link)
+			{
+				*link = node->next;
+				if (strand->tail == node) strand->tail = prev;
+			}
+			if (!strand->head)
+			{
+				removeStrand(strand);
+			}
+			strandMutex.unlock();
+			delete node;
+			return false;
+		}
+		catch(...)
+		{
+			throw;
+		}
+	}
+	/**
+	 * @brief		getStrands
+	 * 				実行中のストランド数の取得
+	 * @return	待ち行列が空でないストランドの数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned long ThreadPool::getStrands()
+	{
+		unsigned long num;
+		strandMutex.lock();
+		num = strandCount;
+		strandMutex.unlock();
+		return num;
+	}
+	/**
+	 * @brief		findStrand
+	 * 				ストランドの検索
+	 * @note		strandMutexを取得した状態で呼び出してください。
+	 * @param[in]	key：検索するキー
+	 * @param[in]	create：存在しない場合に作成するか
+	 * @return	ストランドを返却します。存在しない場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	Strand_t * ThreadPool::findStrand(unsigned long key , bool create)
+	{
+		unsigned int bucket = (unsigned int)(key % MAX_STRAND_BUCKET);
+		for (Strand_t * strand = strands[bucket] ; strand ; strand = strand->next)
+		{
+			if (strand->key == key) return strand;
+		}
+		if (!create) return NULL;
+		Strand_t * strand = new Strand_t;
+		strand->key		= key;
+		strand->head		= NULL;
+		strand->tail		= NULL;
+		strand->scheduled	= false;
+		strand->next		= strands[bucket];
+		strands[bucket]	= strand;
+		strandCount++;
+		return strand;
+	}
+	/**
+	 * @brief		removeStrand
+	 * 				ストランドの破棄
+	 * @note		strandMutexを取得した状態で呼び出してください。
+	 * @param[in]	strand：破棄するストランド
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadPool::removeStrand(Strand_t * strand)
+	{
+		unsigned int bucket = (unsigned int)(strand->key % MAX_STRAND_BUCKET);
+		for (Strand_t ** link = &strands[bucket] ; *link ; link = &(*link)->next)
+		{
+			if (*link == strand)
+			{
+				*link = strand->next;
+				strandCount--;
+				delete strand;
+				return;
+			}
+		}
+	}
+	/**
+	 * @brief		nextStrandFunction
+	 * 				ストランドの待ち行列の取り出し
+	 * @note		StrandRunnerから呼び出されます。
+	 * 				待ち行列が空の場合はストランドを破棄します。
+	 * 				yieldが指定されている場合、残りの実行を新たなStrandRunnerとして
+	 * 				プールへ積み直します。積み直せない場合はそのまま実行を続けます。
+	 * @param[in]	strand：実行中のストランド
+	 * @param[in,out]	yield：他のストランドへ譲るか。積み直した場合はfalseを格納
+	 * @return	取り出した要素を返却します。空の場合、積み直した場合はNULL
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	StrandNode_t * ThreadPool::nextStrandFunction(Strand_t * strand , bool * yield)
+	{
+		StrandNode_t * node;
+		strandMutex.lock();
+		node = strand->head;
+		if (!node)
+		{
+			removeStrand(strand);
+			strandMutex.unlock();
+			return NULL;
+		}
+		if (*yield)
+		{
+			*yield = false;
+			strandMutex.unlock();
+			StrandRunner * runner = new StrandRunner(this , strand);
+			if (setFunction(runner))
+			{
+				return NULL;
+			}
+			delete runner;
+			strandMutex.lock();
+			node = strand->head;
+		}
+		strand->head = node->next;
+		if (!strand->head) strand->tail = NULL;
+		strandMutex.unlock();
+		return node;
+	}
+}
@@ -0,0 +1,298 @@
+/* ***************************************************************************
+ * @file		VSTDThreadPool.hpp
+ * @brief		伸縮型スレッドプール Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian キー毎の直列実行(ストランド)を追加
+ * - 2026/10/19	Sebastian ワーカー毎のコンテキストを追加
+ * ***************************************************************************/
+#ifndef VSTDTHREADPOOL_HPP_
+#define VSTDTHREADPOOL_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <time.h>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief プールに登録可能なワーカーの最大数 */
+	#define MAX_POOL_WORKER 256
+	/** @brief ストランドのハッシュテーブルのバケット数 */
+	#define MAX_STRAND_BUCKET 1024
+	/** @brief ストランドが他のストランドに譲るまでに連続して実行する数 */
+	#define STRAND_BATCH 16
+	class ThreadPool;
+	/**
+	 * @brief		ストランドの待ち行列の要素
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct StrandNode
+	{
+		/** @brief 実行するThreadFunction */
+		ThreadFunction *		func;
+		/** @brief 次の要素 */
+		struct StrandNode *	next;
+	} StrandNode_t;
+	/**
+	 * @brief		ストランド(同一キーの直列実行単位)
+	 * @note		待ち行列が空になった時点で破棄される為、
+	 * 				待機中のストランドは領域を使用しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct Strand
+	{
+		/** @brief キー */
+		unsigned long		key;
+		/** @brief 待ち行列の先頭 */
+		StrandNode_t *		head;
+		/** @brief 待ち行列の末尾 */
+		StrandNode_t *		tail;
+		/** @brief プールに実行を依頼済みか */
+		bool				scheduled;
+		/** @brief 同一バケットの次のストランド */
+		struct Strand *		next;
+	} Strand_t;
+	/**
+	 * @brief		スレッドプールの伸縮設定
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief ワーカーの最小数 */
+		unsigned int		minWorkers;
+		/** @brief ワーカーの最大数 */
+		unsigned int		maxWorkers;
+		/** @brief 待ち行列の最大数 */
+		unsigned int		depth;
+		/** @brief ワーカー1つあたりの待ち行列数がこれを超えた場合に増員 */
+		unsigned int		growBacklog;
+		/** @brief 先頭の待ち時間がこれ(ミリ秒)を超えた場合に増員 */
+		long				growLatency;
+		/** @brief 待機時間がこれ(ミリ秒)を超えたワーカーを削減 */
+		long				idleTimeout;
+		/** @brief 増減後、次の増減を行わない時間(ミリ秒) */
+		long				cooldown;
+		/** @brief 伸縮判定の間隔(ミリ秒) */
+		long				interval;
+		/** @brief ワーカーのスタックサイズ(byte)。0の場合は既定値 */
+		int				stackSize;
+		/** @brief ワーカー毎のコンテキストの生成処理。NULLの場合は生成しない */
+		ThreadContextCreate_t	contextCreate;
+		/** @brief ワーカー毎のコンテキストの破棄処理 */
+		ThreadContextDestroy_t	contextDestroy;
+	} ThreadPoolConfig_t;
+	/**
+	 * @brief		スレッドプールの統計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 現在のワーカー数 */
+		unsigned int		workers;
+		/** @brief 待機中のワーカー数 */
+		unsigned int		idleWorkers;
+		/** @brief 現在の待ち行列の数 */
+		unsigned int		backlog;
+		/** @brief 先頭の待ち時間(ミリ秒) */
+		long				latency;
+		/** @brief 増員した総数 */
+		unsigned long		spawned;
+		/** @brief 削減した総数 */
+		unsigned long		retired;
+		/** @brief 最大数超過により拒否された総数 */
+		unsigned long		rejected;
+	} ThreadPoolStat_t;
+	/**
+	 * @brief	PoolWorker
+	 * @note	スレッドプールのワーカー。
+	 * 			ThreadCallとして作成され、シグナル受信時にプールの待ち行列から
+	 * 			ThreadFunctionを取り出して実行します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class PoolWorker : public ThreadCall
+	{
+		private:
+			/** @brief 所属するプール */
+			ThreadPool *		pool;
+		public:
+			/** @brief 待機中(プールの待ち行列が空)か。プールのミューテックスにて保護 */
+			bool				idle;
+			/** @brief 最後に処理を終えた時刻(CLOCK_MONOTONIC) */
+			struct timespec	idleSince;
+			PoolWorker(ThreadPool * owner , int size);
+			virtual ~PoolWorker(void);
+			virtual bool	onFunction();
+			using ThreadCall::onFunction;
+	};
+	/**
+	 * @brief	StrandRunner
+	 * @note	ストランドの待ち行列をプールのワーカー上で順に実行します。
+	 * 			STRAND_BATCH件実行した時点で残りがある場合は、
+	 * 			新たなStrandRunnerをプールの待ち行列の末尾に積み直します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class StrandRunner : public ThreadFunction
+	{
+		private:
+			/** @brief 所属するプール */
+			ThreadPool *	pool;
+			/** @brief 実行するストランド */
+			Strand_t *		strand;
+		public:
+			StrandRunner(ThreadPool * owner , Strand_t * target);
+			bool	Function();
+	};
+	/**
+	 * @brief	PoolSupervisor
+	 * @note	インターバル型のThreadCallとして一定間隔でプールの伸縮を判定します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class PoolSupervisor : public ThreadCall
+	{
+		private:
+			/** @brief 監視するプール */
+			ThreadPool *		pool;
+		public:
+			PoolSupervisor(ThreadPool * owner , long interval);
+			virtual ~PoolSupervisor(void);
+			virtual bool	onFunction();
+	};
+	/**
+	 * @brief	ThreadPool
+	 * @note	複数のPoolWorkerにて共有の待ち行列を処理するスレッドプールです。
+	 * 			待ち行列の数、もしくは待ち時間が閾値を超えた場合にワーカーを
+	 * 			増員し、一定時間待機したワーカーを最小数まで削減します。
+	 * 			増減の閾値を分け、増減後は一定時間判定を行わない事で
+	 * 			増減の繰り返しを防止します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class ThreadPool
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief 伸縮設定 */
+			ThreadPoolConfig_t	config;
+			/** @brief ワーカー */
+			PoolWorker *			workers[MAX_POOL_WORKER];
+			/** @brief 現在のワーカー数 */
+			unsigned int			workerCount;
+			/** @brief 待ち行列 */
+			ThreadFunction **		queue;
+			/** @brief 待ち行列に追加した時刻 */
+			struct timespec *		enqueued;
+			/** @brief 待ち行列の先頭位置 */
+			unsigned int			head;
+			/** @brief 現在の待ち行列の数 */
+			unsigned int			count;
+			/** @brief 最後に増減を行った時刻 */
+			struct timespec		lastScale;
+			/** @brief 増員した総数 */
+			unsigned long			spawned;
+			/** @brief 削減した総数 */
+			unsigned long			retired;
+			/** @brief 最大数超過により拒否された総数 */
+			unsigned long			rejected;
+			/** @brief 停止中か */
+			bool					stopping;
+			/** @brief 伸縮判定用スレッド */
+			PoolSupervisor *		supervisor;
+			/** @brief 実行中のストランド */
+			Strand_t *			strands[MAX_STRAND_BUCKET];
+			/** @brief 実行中のストランドの数 */
+			unsigned long			strandCount;
+			/** @brief ストランド保護用ミューテックス */
+			Mutex					strandMutex;
+			/* ***************************************************************
+			 * プライベートメソッド
+			 * ***************************************************************/
+			bool	spawn();
+			void	retire(PoolWorker * worker);
+			Strand_t *	findStrand(unsigned long key , bool create);
+			void	removeStrand(Strand_t * strand);
+			StrandNode_t *	nextStrandFunction(Strand_t * strand , bool * yield);
+			friend class StrandRunner;
+		public:
+			/* ***************************************************************
+			 * パブリックメンバ変数
+			 * ***************************************************************/
+			/**　@brief ミューテックス管理用オブジェクト */
+			Mutex	mutex;
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			ThreadPool(const ThreadPoolConfig_t * conf = NULL);
+			virtual ~ThreadPool(void);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			static void		getDefaultConfig(ThreadPoolConfig_t * conf);
+			bool			setFunction(ThreadFunction * Func);
+			ThreadFunction *	take(PoolWorker * worker);
+			void			adjust();
+			void			stop();
+			void			getStat(ThreadPoolStat_t * stat);
+			unsigned int	getWorkers();
+			bool			setStrandFunction(unsigned long key , ThreadFunction * Func);
+			unsigned long	getStrands();
+			/**
+			 * @brief		submit
+			 * 				型付き実行結果を返却する関数の積み上げ
+			 * @see		ThreadCall::submit
+			 * @param[in]	func：実行する関数オブジェクトを指定
+			 * @return	実行結果受け取り用のFutureを返却します。
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class R , class F>
+			Future<R>		submit(F && func)
+			{
+				typedef FutureTask<R , typename std::decay<F>::type>	Task;
+				Task *		task = new Task(std::forward<F>(func));
+				Future<R>	future(task->getState());
+				if (!setFunction(task))
+				{
+					delete task;
+				}
+				return future;
+			}
+			/**
+			 * @brief		submit
+			 * 				キーを指定した型付き実行結果を返却する関数の積み上げ
+			 * @see		setStrandFunction
+			 * @param[in]	key：直列実行するキーを指定
+			 * @param[in]	func：実行する関数オブジェクトを指定
+			 * @return	実行結果受け取り用のFutureを返却します。
+			 * @author	Sebastian
+			 * @date		2026/10/19
+			 */
+			template <class R , class F>
+			Future<R>		submit(unsigned long key , F && func)
+			{
+				typedef FutureTask<R , typename std::decay<F>::type>	Task;
+				Task *		task = new Task(std::forward<F>(func));
+				Future<R>	future(task->getState());
+				if (!setStrandFunction(key , task))
+				{
+					delete task;
+				}
+				return future;
+			}
+	};
+}
+#endif /*VSTDTHREADPOOL_HPP_*/
@@ -0,0 +1,505 @@
+/* ***************************************************************************
+ * @file		VSTDThreadRegistry.cpp
+ * @brief		ThreadCall一括管理・監視用 Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "VSTDThreadRegistry.hpp"
+
+namespace VSTD
+{
+	/** @brief 一括停止にて同時に停止するThreadCallの数 */
+	#define REGISTRY_STOP_BATCH 32
+	/**
+	 * @brief		一括停止用のスレッド
+	 * @param[in]	thread：停止するThreadCall
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void * stopThread(void * thread)
+	{
+		((ThreadCall *)thread)->stop();
+		return (void *)0;
+	}
+	/**
+	 * @brief		既定の監視通知先
+	 * @note		標準エラー出力に長時間実行中のスレッドを出力します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	static void defaultWatchdogHandler(ThreadCall * thread , long busy , void * /* arg */)
+	{
+		pthread_t id;
+		thread->getThreadId(&id);
+		fprintf(stderr , "[ThreadRegistry]:スレッド(%lu)が%ldミリ秒実行中です。\n"
+				, (unsigned long)id , busy);
+	}
+	/* ***********************************************************************
+	 *
+	 * RegistryWatchdog
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		RegistryWatchdogのコンストラクタ
+	 * @param[in]	interval：巡回間隔をミリ秒にて指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	RegistryWatchdog::RegistryWatchdog(long interval) : ThreadCall()
+	{
+		setThreadType(TH_TYP_INTERVAL , interval);
+	}
+	/**
+	 * @brief		RegistryWatchdogのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	RegistryWatchdog::~RegistryWatchdog(void)
+	{
+		stop();
+	}
+	/**
+	 * @brief		onFunction
+	 * 				レジストリの巡回
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool RegistryWatchdog::onFunction()
+	{
+		ThreadRegistry::getInstance()->checkWatchdog();
+		return true;
+	}
+	/* ***********************************************************************
+	 *
+	 * ThreadRegistry
+	 *
+	 *************************************************************************/
+	/**
+	 * @brief		ThreadRegistryのコンストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadRegistry::ThreadRegistry(void)
+	{
+		capacity			= REGISTRY_INITIAL_SIZE;
+		count				= 0;
+		threads			= new ThreadCall * [capacity];
+		enabled			= false;
+		watchdog			= NULL;
+		watchdogThreshold	= 0;
+		watchdogHandler	= defaultWatchdogHandler;
+		watchdogArg		= NULL;
+		watchdogDetected	= 0;
+	}
+	/**
+	 * @brief		ThreadRegistryのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadRegistry::~ThreadRegistry(void)
+	{
+		delete [] threads;
+	}
+	/**
+	 * @brief		getInstance
+	 * 				レジストリの取得
+	 * @note		プロセス内で唯一のレジストリを返却します。
+	 * 				終了時のThreadCallの破棄順序に依存しない様、破棄されません。
+	 * @return	レジストリを返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	ThreadRegistry * ThreadRegistry::getInstance()
+	{
+		static ThreadRegistry * instance = new ThreadRegistry();
+		return instance;
+	}
+	/**
+	 * @brief		enable
+	 * 				登録の有効化
+	 * @note		有効化した後にstartしたThreadCallが登録されます。
+	 * @param[in]	enable：有効にするかを指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::enable(bool enable)
+	{
+		enabled.store(enable , std::memory_order_release);
+	}
+	/**
+	 * @brief		isEnabled
+	 * 				登録が有効かを取得します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadRegistry::isEnabled()
+	{
+		return enabled.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief		add
+	 * 				ThreadCallの登録
+	 * @param[in]	thread：登録するThreadCall
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadRegistry::add(ThreadCall * thread)
+	{
+		try
+		{
+			mutex.lock();
+			if (count >= capacity)
+			{
+				ThreadCall ** grown = new ThreadCall * [capacity * 2];
+				memcpy(grown , threads , sizeof(ThreadCall *) * count);
+				delete [] threads;
+				threads	= grown;
+				capacity	= capacity * 2;
+			}
+			threads[count++] = thread;
+			mutex.unlock();
+			return true;
+		}
+		catch(...)
+		{
+			mutex.unlock();
+			return false;
+		}
+	}
+	/**
+	 * @brief		remove
+	 * 				ThreadCallの登録解除
+	 * @note		ThreadCallのデストラクタから呼び出されます。
+	 * @param[in]	thread：登録解除するThreadCall
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::remove(ThreadCall * thread)
+	{
+		mutex.lock();
+		for (unsigned int i = 0 ; i < count ; i++)
+		{
+			if (threads[i] == thread)
+			{
+				threads[i] = threads[--count];
+				break;
+			}
+		}
+		mutex.unlock();
+	}
+	/**
+	 * @brief		getCount
+	 * 				登録されているThreadCallの数を取得します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int ThreadRegistry::getCount()
+	{
+		unsigned int num;
+		mutex.lock();
+		num = count;
+		mutex.unlock();
+		return num;
+	}
+	/**
+	 * @brief		forEach
+	 * 				登録されているThreadCallの巡回
+	 * @note		レジストリのミューテックスを取得した状態で呼び出される為、
+	 * 				コールバック内でThreadCallを破棄しないでください。
+	 * @param[in]	callback：ThreadCall毎に呼び出すコールバック
+	 * @param[in]	arg：コールバックに引き渡す引数
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::forEach(ThreadRegistryCallback_t callback , void * arg)
+	{
+		try
+		{
+			mutex.lock();
+			for (unsigned int i = 0 ; i < count ; i++)
+			{
+				callback(threads[i] , arg);
+			}
+			mutex.unlock();
+		}
+		catch(...)
+		{
+			mutex.unlock();
+			throw;
+		}
+	}
+	/**
+	 * @brief		getStat
+	 * 				集計情報の取得
+	 * @param[out]	stat：集計情報を格納します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::getStat(ThreadRegistryStat_t * stat)
+	{
+		ThreadMonitorStat_t	monitor;
+		long long			totalWait = 0;
+		long long			now = GetMonotonicTime();
+		long long			threshold = watchdogThreshold.load(std::memory_order_relaxed);
+		memset(stat , 0 , sizeof(ThreadRegistryStat_t));
+		mutex.lock();
+		stat->instances = count;
+		for (unsigned int i = 0 ; i < count ; i++)
+		{
+			ThreadCall * thread = threads[i];
+			thread->getMonitorStat(&monitor);
+			ThreadState_t state = thread->getThreadStatus();
+			if (state == TH_STAT_BUSY || state == TH_STAT_WAIT) stat->running++;
+			if (monitor.busySince)
+			{
+				stat->busy++;
+				if (threshold > 0 && now - monitor.busySince > threshold) stat->stuck++;
+			}
+			stat->queued		+= thread->getThreadFunctions();
+			stat->expired		+= thread->getExpiredFunctions();
+			stat->processed	+= monitor.processed;
+			totalWait			+= monitor.totalWait;
+			if (monitor.maxWait > stat->maxWait) stat->maxWait = monitor.maxWait;
+		}
+		mutex.unlock();
+		if (stat->processed > 0)
+		{
+			stat->averageWait = totalWait / (long long)stat->processed;
+		}
+	}
+	/**
+	 * @brief		stopAll
+	 * 				一括停止
+	 * @note		登録されているThreadCallを並列に停止します。
+	 * 				監視用スレッド、及び呼び出し元のスレッドは停止しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::stopAll()
+	{
+		pthread_t		helpers[REGISTRY_STOP_BATCH];
+		unsigned int	started = 0;
+		pthread_t		self = pthread_self();
+		void *			result;
+		mutex.lock();
+		for (unsigned int i = 0 ; i < count ; i++)
+		{
+			pthread_t id;
+			ThreadCall * thread = threads[i];
+			if (thread == watchdog) continue;
+			thread->getThreadId(&id);
+			if (pthread_equal(id , self)) continue;
+			if (pthread_create(&helpers[started] , NULL , stopThread , (void *)thread) != 0)
+			{
+				thread->stop();
+				continue;
+			}
+			/* 一定数毎に停止を待機 */
+			if (++started == REGISTRY_STOP_BATCH)
+			{
+				for (unsigned int j = 0 ; j < started ; j++)
+				{
+					pthread_join(helpers[j] , &result);
+				}
+				started = 0;
+			}
+		}
+		for (unsigned int j = 0 ; j < started ; j++)
+		{
+			pthread_join(helpers[j] , &result);
+		}
+		mutex.unlock();
+	}
+	/**
+	 * @brief		setIdleAll
+	 * 				アイドリング時間の一括変更
+	 * @param[in]	idle：アイドリング時間をミリ秒にて指定します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::setIdleAll(long idle)
+	{
+		mutex.lock();
+		for (unsigned int i = 0 ; i < count ; i++)
+		{
+			if (threads[i] == watchdog) continue;
+			threads[i]->setIdle(idle);
+		}
+		mutex.unlock();
+	}
+	/**
+	 * @brief		rebalance
+	 * 				待ち行列の再配分
+	 * @note		指定されたグループに属するThreadCallの待ち行列を
+	 * 				平均を超えるものから平均に満たないものへ移動します。
+	 * 				TH_SCHED_FAIRのThreadCallは対象外です。
+	 * 				要素は移動元と移動先のミューテックスを保持したまま移動する為、
+	 * 				移動先が満杯の場合は移動元に残り、失われる事はありません。
+	 * 				呼び出し元のスレッドにて各ThreadCallの処理を実行する事はありません。
+	 * @param[in]	group：対象のグループを指定します。0は指定出来ません。
+	 * @return	移動した数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int ThreadRegistry::rebalance(int group)
+	{
+		unsigned int	moved = 0;
+		unsigned long	total = 0;
+		unsigned int	members = 0;
+		if (group == 0) return 0;
+		/* 登録解除(remove)はミューテックスを待つ為、移動中にメンバーは破棄されない */
+		mutex.lock();
+		ThreadCall **	list	= new ThreadCall * [count];
+		unsigned int *	depth	= new unsigned int [count];
+		for (unsigned int i = 0 ; i < count ; i++)
+		{
+			if (threads[i]->getRegistryGroup() != group) continue;
+			if (threads[i]->getScheduleType() == TH_SCHED_FAIR) continue;
+			list[members]	= threads[i];
+			depth[members]	= threads[i]->getThreadFunctions();
+			total			+= depth[members];
+			members++;
+		}
+		if (members > 1)
+		{
+			unsigned int average = (unsigned int)((total + members - 1) / members);
+			for (unsigned int i = 0 ; i < members ; i++)
+			{
+				/* 平均に満たないThreadCallへ直接移動 */
+				for (unsigned int target = 0 ; target < members && depth[i] > average ; target++)
+				{
+					if (target == i || depth[target] >= average) continue;
+					unsigned int num = depth[i] - average;
+					if (num > average - depth[target]) num = average - depth[target];
+					unsigned int n = list[i]->moveFunctions(list[target] , num);
+					/* 移動出来ない場合は以降の移動先から除外 */
+					depth[target]	= n < num ? average : depth[target] + n;
+					depth[i]		-= n;
+					moved			+= n;
+				}
+			}
+		}
+		mutex.unlock();
+		delete [] list;
+		delete [] depth;
+		return moved;
+	}
+	/**
+	 * @brief		startWatchdog
+	 * 				監視の開始
+	 * @note		一定間隔でレジストリを巡回し、閾値を超えて処理を実行中
+	 * 				(TH_STAT_BUSY)のThreadCallを通知先へ通知します。
+	 * 				同一の処理に対する通知は一度だけ行われます。
+	 * 				巡回は各ThreadCallのミューテックスを取得しません。
+	 * @param[in]	threshold：閾値をミリ秒にて指定します。
+	 * @param[in]	interval：巡回間隔をミリ秒にて指定します。
+	 * @param[in]	handler：通知先を指定します。NULLの場合は標準エラー出力
+	 * @param[in]	arg：通知先に引き渡す引数を指定します。
+	 * @return	成否を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool ThreadRegistry::startWatchdog(
+						long					threshold
+					,	long					interval
+					,	ThreadWatchdogHandler_t	handler
+					,	void *					arg
+									)
+	{
+		RegistryWatchdog * created = NULL;
+		mutex.lock();
+		watchdogThreshold.store((long long)threshold * 1000000LL , std::memory_order_relaxed);
+		watchdogHandler	= handler ? handler : defaultWatchdogHandler;
+		watchdogArg		= arg;
+		bool exists		= (watchdog != NULL);
+		mutex.unlock();
+		if (exists)
+		{
+			watchdog->setIdle(interval);
+			return true;
+		}
+		/* 作成時にレジストリへ登録される為、ミューテックスの外で作成 */
+		try
+		{
+			created = new RegistryWatchdog(interval);
+		}
+		catch(...)
+		{
+			return false;
+		}
+		mutex.lock();
+		if (watchdog)
+		{
+			mutex.unlock();
+			delete created;
+			return true;
+		}
+		watchdog = created;
+		mutex.unlock();
+		return true;
+	}
+	/**
+	 * @brief		stopWatchdog
+	 * 				監視の停止
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::stopWatchdog()
+	{
+		mutex.lock();
+		RegistryWatchdog * stopped = watchdog;
+		watchdog = NULL;
+		mutex.unlock();
+		if (stopped)
+		{
+			delete stopped;
+		}
+	}
+	/**
+	 * @brief		checkWatchdog
+	 * 				長時間実行中のThreadCallの検出
+	 * @note		監視用スレッドから呼び出されます。
+	 * 				各ThreadCallの実行開始時刻のみを参照し、
+	 * 				ThreadCallのミューテックスは取得しません。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void ThreadRegistry::checkWatchdog()
+	{
+		long long threshold = watchdogThreshold.load(std::memory_order_relaxed);
+		if (threshold <= 0) return;
+		mutex.lock();
+		long long now = GetMonotonicTime();
+		for (unsigned int i = 0 ; i < count ; i++)
+		{
+			ThreadCall * thread = threads[i];
+			long long since = thread->busySince.load(std::memory_order_acquire);
+			if (since == 0 || now - since <= threshold) continue;
+			/* 同一の処理に対しては一度だけ通知 */
+			if (thread->watchdogFlagged.exchange(since , std::memory_order_relaxed) == since)
+			{
+				continue;
+			}
+			watchdogDetected.fetch_add(1 , std::memory_order_relaxed);
+			watchdogHandler(thread , (long)((now - since) / 1000000LL) , watchdogArg);
+		}
+		mutex.unlock();
+	}
+	/**
+	 * @brief		getWatchdogDetected
+	 * 				監視にて検出した総数を取得します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned long ThreadRegistry::getWatchdogDetected()
+	{
+		return watchdogDetected.load(std::memory_order_relaxed);
+	}
+}
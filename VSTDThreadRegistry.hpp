@@ -0,0 +1,148 @@
+/* ***************************************************************************
+ * @file		VSTDThreadRegistry.hpp
+ * @brief		ThreadCall一括管理・監視用 Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDTHREADREGISTRY_HPP_
+#define VSTDTHREADREGISTRY_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/** @brief レジストリに登録可能なThreadCallの初期数 */
+	#define REGISTRY_INITIAL_SIZE 256
+	/**
+	 * @brief		レジストリの集計情報
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	typedef struct
+	{
+		/** @brief 登録されているThreadCallの数 */
+		unsigned int		instances;
+		/** @brief 稼働中のThreadCallの数 */
+		unsigned int		running;
+		/** @brief 処理を実行中のThreadCallの数 */
+		unsigned int		busy;
+		/** @brief 監視の閾値を超えて実行中のThreadCallの数 */
+		unsigned int		stuck;
+		/** @brief 待ち行列の総数 */
+		unsigned long		queued;
+		/** @brief 処理された総数 */
+		unsigned long		processed;
+		/** @brief 実行期限切れにより破棄された総数 */
+		unsigned long		expired;
+		/** @brief 待ち行列での平均待ち時間(ナノ秒) */
+		long long			averageWait;
+		/** @brief 待ち行列での最大待ち時間(ナノ秒) */
+		long long			maxWait;
+	} ThreadRegistryStat_t;
+	/**
+	 * @brief		監視にて長時間実行中のThreadCallを検出した際の通知先
+	 * @param[in]	thread：検出したThreadCall
+	 * @param[in]	busy：実行中の時間(ミリ秒)
+	 * @param[in]	arg：登録時に指定した引数
+	 */
+	typedef void (*ThreadWatchdogHandler_t)(ThreadCall * thread , long busy , void * arg);
+	/**
+	 * @brief		一括処理用のコールバック
+	 * @param[in]	thread：対象のThreadCall
+	 * @param[in]	arg：呼び出し時に指定した引数
+	 */
+	typedef void (*ThreadRegistryCallback_t)(ThreadCall * thread , void * arg);
+	/**
+	 * @brief	RegistryWatchdog
+	 * @note	インターバル型のThreadCallとして一定間隔でレジストリを巡回し
+	 * 			長時間実行中のThreadCallを検出します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class RegistryWatchdog : public ThreadCall
+	{
+		public:
+			RegistryWatchdog(long interval);
+			virtual ~RegistryWatchdog(void);
+			virtual bool	onFunction();
+			using ThreadCall::onFunction;
+	};
+	/**
+	 * @brief	ThreadRegistry
+	 * @note	プロセス内のThreadCallを一括管理するレジストリです。
+	 * 			enableにて有効化した後にstartしたThreadCallが登録されます。
+	 * 			集計、一括停止、アイドリング時間の一括変更、待ち行列の再配分、
+	 * 			長時間実行中のThreadCallの監視を提供します。
+	 * 			監視は各ThreadCallのミューテックスを取得せずに行われます。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class ThreadRegistry
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief 登録されているThreadCall */
+			ThreadCall **			threads;
+			/** @brief 登録されているThreadCallの数 */
+			unsigned int			count;
+			/** @brief 登録領域の大きさ */
+			unsigned int			capacity;
+			/** @brief 登録が有効か */
+			std::atomic<bool>		enabled;
+			/** @brief 監視用スレッド */
+			RegistryWatchdog *		watchdog;
+			/** @brief 監視の閾値(ナノ秒) */
+			std::atomic<long long>	watchdogThreshold;
+			/** @brief 監視にて検出した際の通知先 */
+			ThreadWatchdogHandler_t	watchdogHandler;
+			/** @brief 通知先に引き渡す引数 */
+			void *					watchdogArg;
+			/** @brief 監視にて検出した総数 */
+			std::atomic<unsigned long>	watchdogDetected;
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			ThreadRegistry(void);
+			~ThreadRegistry(void);
+		public:
+			/* ***************************************************************
+			 * パブリックメンバ変数
+			 * ***************************************************************/
+			/**　@brief ミューテックス管理用オブジェクト */
+			Mutex	mutex;
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			static ThreadRegistry *	getInstance();
+			void			enable(bool enable = true);
+			bool			isEnabled();
+			bool			add(ThreadCall * thread);
+			void			remove(ThreadCall * thread);
+			unsigned int	getCount();
+			void			forEach(ThreadRegistryCallback_t callback , void * arg);
+			void			getStat(ThreadRegistryStat_t * stat);
+			void			stopAll();
+			void			setIdleAll(long idle);
+			unsigned int	rebalance(int group);
+			bool			startWatchdog(
+								long					threshold
+							,	long					interval = 100
+							,	ThreadWatchdogHandler_t	handler = NULL
+							,	void *					arg = NULL
+											);
+			void			stopWatchdog();
+			void			checkWatchdog();
+			unsigned long	getWatchdogDetected();
+	};
+}
+#endif /*VSTDTHREADREGISTRY_HPP_*/
@@ -0,0 +1,162 @@
+/* ***************************************************************************
+ * @file		VSTDTokenBucket.cpp
+ * @brief		流量制限(トークンバケット)用 Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "VSTDTokenBucket.hpp"
+
+namespace VSTD
+{
+	/**
+	 * @brief		TokenBucketのコンストラクタ
+	 * @param[in]	rate：1秒あたりのトークン数。0以下の場合は無制限
+	 * @param[in]	burstSize：連続して取得可能な数
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	TokenBucket::TokenBucket(double rate , unsigned int burstSize)
+	{
+		tat		= 0;
+		interval	= 0;
+		burst		= 1;
+		setRate(rate , burstSize);
+	}
+	/**
+	 * @brief		TokenBucketのデストラクタ
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	TokenBucket::~TokenBucket(void)
+	{
+	}
+	/**
+	 * @brief		setRate
+	 * 				流量の設定
+	 * @note		変更時は満杯(burst個取得可能)の状態から開始します。
+	 * @param[in]	rate：1秒あたりのトークン数。0以下の場合は無制限
+	 * @param[in]	burstSize：連続して取得可能な数(1以上)
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void TokenBucket::setRate(double rate , unsigned int burstSize)
+	{
+		long long step = 0;
+		if (rate > 0)
+		{
+			step = (long long)(1000000000.0 / rate);
+			if (step < 1) step = 1;
+		}
+		burst.store(burstSize > 0 ? burstSize : 1 , std::memory_order_relaxed);
+		interval.store(step , std::memory_order_relaxed);
+		tat.store(0 , std::memory_order_release);
+	}
+	/**
+	 * @brief		getRate
+	 * 				流量の取得
+	 * @return	1秒あたりのトークン数を返却します。無制限の場合は0
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	double TokenBucket::getRate()
+	{
+		long long step = interval.load(std::memory_order_relaxed);
+		return step > 0 ? 1000000000.0 / step : 0;
+	}
+	/**
+	 * @brief		getBurst
+	 * 				連続して取得可能な数の取得
+	 * @return	連続して取得可能な数を返却します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	unsigned int TokenBucket::getBurst()
+	{
+		return burst.load(std::memory_order_relaxed);
+	}
+	/**
+	 * @brief		tryAcquire
+	 * 				トークンの取得
+	 * @note		理論到着時刻から取得後の時刻を算出し、現在時刻からの
+	 * 				超過がburst個分以内であればCASにて更新して取得します。
+	 * 				取得出来ない場合は待機せずに、取得可能となるまでの時間を返却します。
+	 * @param[out]	waitNs：取得出来ない場合、取得可能となるまでの時間(ナノ秒)を格納します。
+	 * @param[in]	tokens：取得する数
+	 * @return	成否を返却します。
+	 * @retval	true ： 取得した
+	 * @retval	false： トークンが不足している
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	bool TokenBucket::tryAcquire(long long * waitNs , unsigned int tokens)
+	{
+		long long step = interval.load(std::memory_order_relaxed);
+		if (step == 0)
+		{
+			return true;
+		}
+		long long tolerance	= step * burst.load(std::memory_order_relaxed);
+		long long now		= GetMonotonicTime();
+		long long current	= tat.load(std::memory_order_acquire);
+		while (true)
+		{
+			long long next = (current > now ? current : now) + step * tokens;
+			if (next - now > tolerance)
+			{
+				if (waitNs)
+				{
+					*waitNs = next - now - tolerance;
+				}
+				return false;
+			}
+			if (tat.compare_exchange_weak(current , next , std::memory_order_acq_rel))
+			{
+				return true;
+			}
+		}
+	}
+	/**
+	 * @brief		refund
+	 * 				トークンの返却
+	 * @note		tryAcquireにて取得したトークンを使用しなかった場合に
+	 * 				理論到着時刻を取得前まで戻します。
+	 * @param[in]	tokens：返却する数
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	void TokenBucket::refund(unsigned int tokens)
+	{
+		long long step = interval.load(std::memory_order_relaxed);
+		if (step == 0)
+		{
+			return;
+		}
+		tat.fetch_sub(step * tokens , std::memory_order_acq_rel);
+	}
+	/**
+	 * @brief		getWait
+	 * 				取得可能となるまでの時間の取得
+	 * @param[in]	tokens：取得する数
+	 * @return	取得可能となるまでの時間(ナノ秒)を返却します。取得可能な場合は0
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	long long TokenBucket::getWait(unsigned int tokens)
+	{
+		long long step = interval.load(std::memory_order_relaxed);
+		if (step == 0)
+		{
+			return 0;
+		}
+		long long tolerance	= step * burst.load(std::memory_order_relaxed);
+		long long now		= GetMonotonicTime();
+		long long current	= tat.load(std::memory_order_acquire);
+		long long next		= (current > now ? current : now) + step * tokens;
+		return next - now > tolerance ? next - now - tolerance : 0;
+	}
+}
@@ -0,0 +1,64 @@
+/* ***************************************************************************
+ * @file		VSTDTokenBucket.hpp
+ * @brief		流量制限(トークンバケット)用 Class
+ * @see		VSTDThreadCall.hpp
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDTOKENBUCKET_HPP_
+#define VSTDTOKENBUCKET_HPP_
+/* ***************************************************************************
+ * including library
+ * ***************************************************************************/
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+
+namespace VSTD
+{
+	/**
+	 * @brief	TokenBucket
+	 * @note	1秒あたりrate個、最大burst個まで連続して取得可能なトークンを
+	 * 			GCRA(Generic Cell Rate Algorithm)にて管理します。
+	 * 			状態は次のトークンの理論到着時刻(CLOCK_MONOTONIC)のみであり、
+	 * 			取得はCASのみで行う為、複数のスレッド・ThreadCallから
+	 * 			ロック無しに共有出来ます。
+	 * 			ThreadCall::setRateLimit/setTenantRateLimitに指定する事で
+	 * 			待ち行列からの取り出しを制限します。
+	 * @author	Sebastian
+	 * @date	2026/10/19
+	 */
+	class TokenBucket
+	{
+		private:
+			/* ***************************************************************
+			 * プライベートメンバ変数
+			 * ***************************************************************/
+			/** @brief 理論到着時刻(ナノ秒) */
+			alignas(TH_CACHE_LINE)
+			std::atomic<long long>	tat;
+			/** @brief トークン1個あたりの間隔(ナノ秒)。0の場合は無制限 */
+			std::atomic<long long>	interval;
+			/** @brief 連続して取得可能な数 */
+			std::atomic<unsigned int>	burst;
+		public:
+			/* ***************************************************************
+			 * コンストラクタ/デストラクタ
+			 * ***************************************************************/
+			TokenBucket(double rate = 0 , unsigned int burstSize = 1);
+			virtual ~TokenBucket(void);
+			/* ***************************************************************
+			 * パブリックメソッド
+			 * ***************************************************************/
+			void			setRate(double rate , unsigned int burstSize = 1);
+			double			getRate();
+			unsigned int	getBurst();
+			bool			tryAcquire(long long * waitNs = NULL , unsigned int tokens = 1);
+			void			refund(unsigned int tokens = 1);
+			long long		getWait(unsigned int tokens = 1);
+	};
+}
+#endif /*VSTDTOKENBUCKET_HPP_*/
@@ -0,0 +1,138 @@
+/* ***************************************************************************
+ * @file		TestActor.cpp
+ * @brief		アクター(メールボックスの直列処理)の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include "VSTDActor.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 送信者数 */
+	const int SENDERS = 4;
+	/**
+	 * @brief		送信者毎の順序と同時実行の有無を確認するアクター
+	 * @note		メッセージは送信者番号と送信者毎の連番をまとめた値です。
+	 */
+	class OrderCheck : public Actor
+	{
+		public:
+			std::atomic<int>	inside;
+			long				last[SENDERS];
+			long				count;
+			bool				broken;
+			OrderCheck(ActorScheduler * owner) : Actor(owner) , inside(0) , count(0) , broken(false)
+			{
+				for (int i = 0 ; i < SENDERS ; i++) last[i] = -1;
+			}
+			bool onFunction(void * Data)
+			{
+				if (inside.fetch_add(1) != 0) broken = true;
+				long value	= (long)(intptr_t)Data - 1;
+				int sender	= (int)(value % SENDERS);
+				long seq	= value / SENDERS;
+				if (seq != last[sender] + 1) broken = true;
+				last[sender] = seq;
+				count++;
+				inside.fetch_sub(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		指定回数処理した時点で停止するアクター
+	 */
+	class StopAfter : public Actor
+	{
+		public:
+			int		count;
+			StopAfter(ActorScheduler * owner) : Actor(owner) , count(0) {}
+			bool onFunction(void * /* Data */)
+			{
+				return ++count < 3;
+			}
+	};
+	/**
+	 * @brief		複数のスレッドから送信しても1つずつ送信順に処理され、
+	 * 				メッセージが失われない
+	 */
+	int testSerialDelivery()
+	{
+		const long		PER_SENDER = 20000;
+		ActorScheduler	scheduler(4 , 64);
+		OrderCheck *	actors[8];
+		ThreadCall		senders[SENDERS];
+		Future<void>	sent[SENDERS];
+		for (int i = 0 ; i < 8 ; i++)
+		{
+			actors[i] = new OrderCheck(&scheduler);
+		}
+		for (int s = 0 ; s < SENDERS ; s++)
+		{
+			sent[s] = senders[s].submit<void>([&actors , s , PER_SENDER]{
+				for (long i = 0 ; i < PER_SENDER ; i++)
+				{
+					actors[i % 8]->setFunction((void *)(intptr_t)((i / 8) * SENDERS + s + 1));
+				}
+			});
+		}
+		for (int s = 0 ; s < SENDERS ; s++)
+		{
+			sent[s].get();
+			senders[s].stop();
+		}
+		TEST_ASSERT(WaitUntil([&]{
+			for (int i = 0 ; i < 8 ; i++)
+			{
+				if (!actors[i]->isIdle()) return false;
+			}
+			return true;
+		} , 10000));
+		long total = 0;
+		for (int i = 0 ; i < 8 ; i++)
+		{
+			TEST_ASSERT(!actors[i]->broken);
+			total += actors[i]->count;
+			delete actors[i];
+		}
+		TEST_ASSERT(total == PER_SENDER * SENDERS);
+		ActorSchedulerStat_t stat;
+		scheduler.getStat(&stat);
+		TEST_ASSERT(stat.processed == (unsigned long)total);
+		scheduler.stop();
+		return 0;
+	}
+	/**
+	 * @brief		onFunctionがfalseを返却したアクターは停止し、以降の送信を拒否する
+	 */
+	int testStop()
+	{
+		ActorScheduler	scheduler(2 , 64);
+		StopAfter		actor(&scheduler);
+		for (int i = 0 ; i < 10 ; i++)
+		{
+			actor.setFunction((void *)1);
+		}
+		TEST_ASSERT(WaitUntil([&]{ return actor.isIdle(); }));
+		TEST_ASSERT(actor.count == 3);
+		TEST_ASSERT(actor.getState() == ACTOR_STOPPED);
+		TEST_ASSERT(!actor.setFunction((void *)1));
+		scheduler.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testSerialDelivery);
+	TEST_RUN(testStop);
+	return failed;
+}
@@ -0,0 +1,119 @@
+/* ***************************************************************************
+ * @file		TestAdmission.cpp
+ * @brief		滞留時間による受け付け制御の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		1件あたり1msを要する受信スレッド
+	 */
+	class Busy : public ThreadCall
+	{
+		public:
+			~Busy(void)
+			{
+				stop();
+			}
+			using ThreadCall::onFunction;
+			bool onFunction(void * /* Data */)
+			{
+				long long start = GetMonotonicTime();
+				while (GetMonotonicTime() - start < 1000000LL)
+				{
+				}
+				return true;
+			}
+	};
+	/**
+	 * @brief		積み上げの結果
+	 */
+	typedef struct
+	{
+		long	accepted;
+		long	shed;
+		long	full;
+	} Offered_t;
+	/**
+	 * @brief		一定間隔で4件ずつ積み上げ、処理が終わるまで待機
+	 * @param[in]	periodUs：積み上げ間隔(マイクロ秒)
+	 * @param[in]	ms：積み上げる時間(ミリ秒)
+	 */
+	Offered_t Offer(Busy & thread , int periodUs , int ms)
+	{
+		Offered_t	result = { 0 , 0 , 0 };
+		long long	start = GetMonotonicTime();
+		while (GetMonotonicTime() - start < ms * 1000000LL)
+		{
+			for (int k = 0 ; k < 4 ; k++)
+			{
+				if (thread.setFunction((void *)1)) result.accepted++;
+				else if (thread.getObjectCondition() & TH_ERR_OVERLOADED) result.shed++;
+				else result.full++;
+			}
+			usleep(periodUs);
+		}
+		WaitUntil([&]{ return thread.getThreadFunctions() == 0; });
+		return result;
+	}
+	/**
+	 * @brief		処理能力の2倍を積み上げた場合は待ち行列が溢れる前に拒否する
+	 */
+	int testOverload()
+	{
+		Busy thread;
+		thread.setAdmissionControl(5000 , 50000);
+		Offered_t offered = Offer(thread , 2000 , 600);
+		TEST_ASSERT(offered.shed > 0);
+		TEST_ASSERT(offered.accepted > 0);
+		TEST_ASSERT((unsigned long)offered.shed == thread.getShedFunctions());
+		/* 待ち行列の上限に達する前に拒否する */
+		TEST_ASSERT(offered.full == 0);
+		return 0;
+	}
+	/**
+	 * @brief		処理能力に余裕がある場合は拒否しない
+	 */
+	int testLightLoad()
+	{
+		Busy thread;
+		thread.setAdmissionControl(5000 , 50000);
+		Offered_t offered = Offer(thread , 8000 , 300);
+		TEST_ASSERT(offered.shed == 0);
+		TEST_ASSERT(offered.full == 0);
+		TEST_ASSERT(thread.getShedFunctions() == 0);
+		TEST_ASSERT(!thread.isOverloaded());
+		return 0;
+	}
+	/**
+	 * @brief		受け付け制御を指定しない場合は待ち行列の上限でのみ拒否する
+	 */
+	int testDisabled()
+	{
+		Busy thread;
+		Offered_t offered = Offer(thread , 2000 , 300);
+		TEST_ASSERT(offered.shed == 0);
+		TEST_ASSERT(offered.full > 0);
+		TEST_ASSERT(thread.getShedFunctions() == 0);
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testOverload);
+	TEST_RUN(testLightLoad);
+	TEST_RUN(testDisabled);
+	return failed;
+}
@@ -0,0 +1,180 @@
+/* ***************************************************************************
+ * @file		TestAsyncIO.cpp
+ * @brief		非同期入出力(io_uring及びスレッドプールによる代替)の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 拒否時のステータスの確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include "VSTDAsyncIO.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 1回の入出力の大きさ */
+	const size_t BLOCK = 4096;
+	/** @brief 書き込むブロック数 */
+	const int BLOCKS = 64;
+	/**
+	 * @brief		完了結果と完了処理を実行したスレッドを記録するAsyncIOFunction
+	 */
+	class RecordResult : public AsyncIOFunction
+	{
+		public:
+			std::atomic<int> *	done;
+			std::atomic<long> *	bytes;
+			std::atomic<int> *	errors;
+			pthread_t			expect;
+			std::atomic<int> *	foreign;
+			RecordResult(
+				std::atomic<int> * count , std::atomic<long> * total
+			,	std::atomic<int> * error , std::atomic<int> * other , pthread_t thread
+				) : done(count) , bytes(total) , errors(error) , expect(thread) , foreign(other)
+			{
+				setAutoRelease(true);
+			}
+			bool Function()
+			{
+				if (getResult() < 0) errors->fetch_add(1);
+				else bytes->fetch_add(getResult());
+				if (!pthread_equal(pthread_self() , expect)) foreign->fetch_add(1);
+				done->fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		完了数を数えるAsyncIOFunction(自動解放しない)
+	 */
+	class Probe : public AsyncIOFunction
+	{
+		public:
+			std::atomic<int> *	done;
+			bool Function()
+			{
+				done->fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		書き込み・同期・読み込みを行い、完了処理が指定したスレッドで実行される
+	 * @param[in]	entries：リングの大きさ。0の場合はスレッドプールによる代替
+	 */
+	int runReadWrite(unsigned int entries)
+	{
+		char path[] = "/tmp/VSTDTestAsyncIO.XXXXXX";
+		int fd = mkstemp(path);
+		TEST_ASSERT(fd >= 0);
+		unlink(path);
+		ThreadCall			target;
+		pthread_t			targetId;
+		std::atomic<int>	done(0);
+		std::atomic<long>	bytes(0);
+		std::atomic<int>	errors(0);
+		std::atomic<int>	foreign(0);
+		static char			blocks[BLOCKS][BLOCK];
+		static char			readBack[BLOCK];
+		TEST_ASSERT(target.isThreadRunning());
+		target.getThreadId(&targetId);
+		{
+			AsyncIO io(entries);
+			for (int i = 0 ; i < BLOCKS ; i++)
+			{
+				memset(blocks[i] , 'a' + (i % 26) , BLOCK);
+				TEST_ASSERT(io.write(fd , blocks[i] , BLOCK , (off_t)i * BLOCK
+					, new RecordResult(&done , &bytes , &errors , &foreign , targetId)
+					, &target , (i % 16) == 15));
+			}
+			TEST_ASSERT(io.submit());
+			TEST_ASSERT(WaitUntil([&]{ return done.load() == BLOCKS; }));
+			TEST_ASSERT(bytes.load() == (long)(BLOCKS * BLOCK));
+			TEST_ASSERT(io.fsync(fd , new RecordResult(&done , &bytes , &errors , &foreign , targetId) , &target));
+			TEST_ASSERT(WaitUntil([&]{ return done.load() == BLOCKS + 1; }));
+			TEST_ASSERT(io.read(fd , readBack , BLOCK , (off_t)7 * BLOCK
+				, new RecordResult(&done , &bytes , &errors , &foreign , targetId) , &target));
+			TEST_ASSERT(WaitUntil([&]{ return done.load() == BLOCKS + 2; }));
+			TEST_ASSERT(memcmp(readBack , blocks[7] , BLOCK) == 0);
+			TEST_ASSERT(errors.load() == 0);
+			TEST_ASSERT(foreign.load() == 0);
+			AsyncIOStat_t stat;
+			io.getStat(&stat);
+			TEST_ASSERT(stat.completed == (unsigned long)(BLOCKS + 2));
+			TEST_ASSERT(stat.inflight == 0);
+			if (entries == 0) TEST_ASSERT(!stat.uring);
+		}
+		target.stop();
+		close(fd);
+		return 0;
+	}
+	int testUring()
+	{
+		return runReadWrite(256);
+	}
+	int testFallback()
+	{
+		return runReadWrite(0);
+	}
+	/**
+	 * @brief		拒否された場合はステータスが元に戻り、受け付けた分は全て完了する
+	 */
+	int testRejected()
+	{
+		const int			PROBES = 1024;
+		char				path[] = "/tmp/VSTDTestAsyncIO.XXXXXX";
+		static char			block[BLOCK];
+		int fd = mkstemp(path);
+		TEST_ASSERT(fd >= 0);
+		unlink(path);
+		ThreadPoolConfig_t	config;
+		ThreadPool::getDefaultConfig(&config);
+		config.minWorkers	= 1;
+		config.maxWorkers	= 1;
+		config.depth		= 4;
+		std::atomic<int>	done(0);
+		Probe *				probes = new Probe[PROBES];
+		int					accepted = 0;
+		bool				rejected = false;
+		{
+			AsyncIO io(4 , &config);
+			for (; accepted < PROBES ; accepted++)
+			{
+				probes[accepted].done = &done;
+				if (!io.write(fd , block , BLOCK , 0 , &probes[accepted] , NULL , false))
+				{
+					rejected = true;
+					break;
+				}
+			}
+			if (io.isUring()) TEST_ASSERT(rejected);
+			if (rejected)
+			{
+				TEST_ASSERT(probes[accepted].getStatus() == THFUNC_STATE_NOTSUBMITTED);
+			}
+			TEST_ASSERT(io.submit());
+			TEST_ASSERT(WaitUntil([&]{ return done.load() == accepted; }));
+		}
+		for (int i = 0 ; i < accepted ; i++)
+		{
+			TEST_ASSERT(probes[i].getStatus() == THFUNC_STATE_COMLETED);
+		}
+		delete [] probes;
+		close(fd);
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testUring);
+	TEST_RUN(testFallback);
+	TEST_RUN(testRejected);
+	return failed;
+}
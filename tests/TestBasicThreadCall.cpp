@@ -0,0 +1,244 @@
+/* ***************************************************************************
+ * @file		TestBasicThreadCall.cpp
+ * @brief		ポリシー指定型のBasicThreadCallの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 停止時に未実行の要素が残る事の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include "VSTDBasicThreadCall.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		受け取った値の合計と順序を記録するハンドラ
+	 */
+	struct OrderSum
+	{
+		long *	sum;
+		long *	last;
+		long *	broken;
+		bool operator()(long value)
+		{
+			*sum += value;
+			if (value != *last + 1) (*broken)++;
+			*last = value;
+			return true;
+		}
+	};
+	/**
+	 * @brief		受け取った値の合計のみを記録するハンドラ
+	 */
+	struct Sum
+	{
+		long *	sum;
+		bool operator()(long value)
+		{
+			*sum += value;
+			return true;
+		}
+	};
+	/**
+	 * @brief		指定値を受け取った時点で停止するハンドラ
+	 */
+	struct StopAt
+	{
+		int *	count;
+		bool operator()(int value)
+		{
+			(*count)++;
+			return value != 3;
+		}
+	};
+	/**
+	 * @brief		実行回数を数えるThreadFunction
+	 */
+	class Count : public ThreadFunction
+	{
+		public:
+			std::atomic<long> *	count;
+			bool Function()
+			{
+				count->fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		falseを返却してスレッドを停止させるThreadFunction
+	 */
+	class Halt : public ThreadFunction
+	{
+		public:
+			bool Function()
+			{
+				return false;
+			}
+	};
+	/**
+	 * @brief		全件を処理するまで待機し、処理数を確認する
+	 */
+	template <class B>
+	bool PushAll(B & thread , long count)
+	{
+		for (long i = 1 ; i <= count ; i++)
+		{
+			while (!thread.push(i)) sched_yield();
+		}
+		return WaitUntil([&]{ return thread.getProcessed() == (unsigned long)count; } , 10000);
+	}
+	/**
+	 * @brief		既定のポリシー(futex/ミューテックス/FIFO)では投入順に全件処理される
+	 */
+	int testDefaultPolicies()
+	{
+		const long	COUNT	= 200000;
+		long		sum		= 0;
+		long		last	= 0;
+		long		broken	= 0;
+		OrderSum	handler	= { &sum , &last , &broken };
+		BasicThreadCall<OrderSum , FifoQueuePolicy<long , 4096> > thread(handler);
+		TEST_ASSERT(PushAll(thread , COUNT));
+		thread.stop();
+		TEST_ASSERT(broken == 0);
+		TEST_ASSERT(sum == COUNT * (COUNT + 1) / 2);
+		return 0;
+	}
+	/**
+	 * @brief		条件変数/スピンロック/LIFO及びスピン待機の組み合わせでも失われない
+	 */
+	int testOtherPolicies()
+	{
+		const long	COUNT	= 200000;
+		long		sum		= 0;
+		Sum			handler	= { &sum };
+		{
+			BasicThreadCall<Sum , LifoQueuePolicy<long , 4096> , ConditionWaitPolicy , SpinLockPolicy> thread(handler);
+			TEST_ASSERT(PushAll(thread , COUNT));
+			thread.stop();
+		}
+		TEST_ASSERT(sum == COUNT * (COUNT + 1) / 2);
+		sum = 0;
+		BasicThreadCall<Sum , FifoQueuePolicy<long , 4096> , SpinWaitPolicy , SpinLockPolicy> * spin
+			= new BasicThreadCall<Sum , FifoQueuePolicy<long , 4096> , SpinWaitPolicy , SpinLockPolicy>(handler);
+		TEST_ASSERT(PushAll(*spin , COUNT));
+		delete spin;
+		TEST_ASSERT(sum == COUNT * (COUNT + 1) / 2);
+		return 0;
+	}
+	/**
+	 * @brief		停止中に積み上げた分は再開後に処理される
+	 */
+	int testRestartDrain()
+	{
+		long	sum		= 0;
+		Sum		handler	= { &sum };
+		BasicThreadCall<Sum , FifoQueuePolicy<long , 64> > thread(handler);
+		thread.stop();
+		TEST_ASSERT(!thread.isRunning());
+		for (long i = 1 ; i <= 64 ; i++)
+		{
+			TEST_ASSERT(thread.push(i));
+		}
+		TEST_ASSERT(!thread.push(65));
+		TEST_ASSERT(thread.start());
+		TEST_ASSERT(WaitUntil([&]{ return thread.getProcessed() == 64; }));
+		thread.stop();
+		TEST_ASSERT(sum == 64 * 65 / 2);
+		return 0;
+	}
+	/**
+	 * @brief		ハンドラがfalseを返却した時点で停止し、未実行の分は再開後に実行される
+	 */
+	int testStopOnFalse()
+	{
+		int		count	= 0;
+		StopAt	handler	= { &count };
+		BasicThreadCall<StopAt , FifoQueuePolicy<int , 16> > thread(handler);
+		thread.stop();
+		for (int i = 1 ; i <= 5 ; i++)
+		{
+			TEST_ASSERT(thread.push(i));
+		}
+		TEST_ASSERT(thread.start());
+		TEST_ASSERT(WaitUntil([&]{ return !thread.isRunning(); }));
+		TEST_ASSERT(count == 3);
+		TEST_ASSERT(thread.size() == 2);
+		TEST_ASSERT(thread.start());
+		TEST_ASSERT(WaitUntil([&]{ return count == 5; }));
+		TEST_ASSERT(thread.size() == 0);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		停止させたThreadFunctionの後続は実行待ちのまま残り、再開後に完了する
+	 */
+	int testFunctionStopOnFalse()
+	{
+		std::atomic<long>	count(0);
+		FunctionThreadCall	thread;
+		Halt				halt;
+		Count				funcs[10];
+		thread.stop();
+		TEST_ASSERT(thread.setFunction(&halt));
+		for (int i = 0 ; i < 10 ; i++)
+		{
+			funcs[i].count = &count;
+			TEST_ASSERT(thread.setFunction(&funcs[i]));
+		}
+		TEST_ASSERT(thread.start());
+		TEST_ASSERT(halt.waitStatus(THFUNC_STATE_COMLETED , 1000000000LL));
+		TEST_ASSERT(WaitUntil([&]{ return !thread.isRunning(); }));
+		TEST_ASSERT(thread.size() == 10);
+		TEST_ASSERT(funcs[0].getStatus() == THFUNC_STATE_WAITING);
+		TEST_ASSERT(thread.start());
+		for (int i = 0 ; i < 10 ; i++)
+		{
+			TEST_ASSERT(funcs[i].waitStatus(THFUNC_STATE_COMLETED , 1000000000LL));
+		}
+		TEST_ASSERT(count.load() == 10);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		FunctionThreadCallはThreadFunctionを実行して完了とする
+	 */
+	int testFunctionThreadCall()
+	{
+		std::atomic<long>	count(0);
+		FunctionThreadCall	thread;
+		Count				funcs[100];
+		for (int round = 0 ; round < 10 ; round++)
+		{
+			for (int i = 0 ; i < 100 ; i++)
+			{
+				funcs[i].count = &count;
+				TEST_ASSERT(thread.setFunction(&funcs[i]));
+			}
+			for (int i = 0 ; i < 100 ; i++)
+			{
+				TEST_ASSERT(funcs[i].waitStatus(THFUNC_STATE_COMLETED , 1000000000LL));
+			}
+		}
+		TEST_ASSERT(count.load() == 1000);
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testDefaultPolicies);
+	TEST_RUN(testOtherPolicies);
+	TEST_RUN(testRestartDrain);
+	TEST_RUN(testStopOnFalse);
+	TEST_RUN(testFunctionStopOnFalse);
+	TEST_RUN(testFunctionThreadCall);
+	return failed;
+}
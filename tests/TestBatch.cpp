@@ -0,0 +1,126 @@
+/* ***************************************************************************
+ * @file		TestBatch.cpp
+ * @brief		まとめて取り出して実行するonFunctionsの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		受け取った数と呼び出し回数を記録する受信スレッド
+	 */
+	class BatchSum : public ThreadCall
+	{
+		public:
+			std::atomic<long>	items;
+			long				sum;
+			int					calls;
+			size_t				largest;
+			BatchSum(void) : items(0) , sum(0) , calls(0) , largest(0) {}
+			~BatchSum(void)
+			{
+				stop();
+			}
+			using ThreadCall::onFunction;
+			bool onFunctions(void ** data , size_t num)
+			{
+				calls++;
+				if (num > largest) largest = num;
+				for (size_t i = 0 ; i < num ; i++)
+				{
+					sum += (long)(intptr_t)data[i];
+				}
+				items.fetch_add((long)num);
+				return true;
+			}
+	};
+	/**
+	 * @brief		onFunctionsを上書きしない受信スレッド
+	 */
+	class Single : public ThreadCall
+	{
+		public:
+			std::atomic<long>	processed;
+			std::atomic<long>	expired;
+			Single(void) : processed(0) , expired(0) {}
+			~Single(void)
+			{
+				stop();
+			}
+			using ThreadCall::onFunction;
+			bool onFunction(void * /* Data */)
+			{
+				processed.fetch_add(1);
+				return true;
+			}
+			bool onExpired(void * /* Data */)
+			{
+				expired.fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		溜まった待ち行列がバッチサイズ単位でまとめて渡され、失われない
+	 */
+	int testBatchDrain()
+	{
+		const long	COUNT	= 96;
+		BatchSum *	thread	= new BatchSum();
+		thread->setBatchSize(32);
+		thread->stop();
+		for (long i = 1 ; i <= COUNT ; i++)
+		{
+			TEST_ASSERT(thread->setFunction((void *)(intptr_t)i));
+		}
+		TEST_ASSERT(thread->start());
+		TEST_ASSERT(WaitUntil([&]{ return thread->items.load() == COUNT; }));
+		TEST_ASSERT(thread->sum == COUNT * (COUNT + 1) / 2);
+		TEST_ASSERT(thread->largest == 32);
+		TEST_ASSERT(thread->calls <= 4);
+		ThreadMonitorStat_t stat;
+		thread->getMonitorStat(&stat);
+		TEST_ASSERT(stat.processed == (unsigned long)COUNT);
+		delete thread;
+		return 0;
+	}
+	/**
+	 * @brief		既定のonFunctionsは期限切れを除いてonFunctionを1件ずつ呼び出す
+	 */
+	int testDefaultHandler()
+	{
+		Single *		thread = new Single();
+		struct timespec	past;
+		thread->setBatchSize(16);
+		TEST_ASSERT(thread->setScheduleType(TH_SCHED_DEADLINE));
+		thread->stop();
+		SetDeadline(&past , -1000);
+		for (long i = 1 ; i <= 50 ; i++)
+		{
+			TEST_ASSERT(thread->setFunction((void *)(intptr_t)i , (i % 2) ? &past : (const struct timespec *)NULL));
+		}
+		TEST_ASSERT(thread->start());
+		TEST_ASSERT(WaitUntil([&]{ return thread->processed.load() + thread->expired.load() == 50; }));
+		TEST_ASSERT(thread->processed.load() == 25);
+		TEST_ASSERT(thread->expired.load() == 25);
+		TEST_ASSERT(thread->getExpiredFunctions() == 25);
+		delete thread;
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testBatchDrain);
+	TEST_RUN(testDefaultHandler);
+	return failed;
+}
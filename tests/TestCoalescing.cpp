@@ -0,0 +1,106 @@
+/* ***************************************************************************
+ * @file		TestCoalescing.cpp
+ * @brief		同一ThreadFunctionの積み上げの集約の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 更新の版数 */
+	std::atomic<long> version(0);
+	/**
+	 * @brief		実行時点の版数を記録するThreadFunction
+	 */
+	class Snapshot : public ThreadFunction
+	{
+		public:
+			std::atomic<long>	runs;
+			std::atomic<long>	seen;
+			Snapshot(void) : runs(0) , seen(-1) {}
+			bool Function()
+			{
+				seen.store(version.load());
+				runs.fetch_add(1);
+				usleep(200);
+				return true;
+			}
+	};
+	/**
+	 * @brief		実行中・実行待ちに積み上げても最後の更新が反映され、完了となる
+	 */
+	int testNoLostUpdate()
+	{
+		const int		SENDERS		= 4;
+		const int		PER_SENDER	= 5000;
+		ThreadCall		thread;
+		Snapshot		func;
+		ThreadCall		senders[SENDERS];
+		Future<int>		rejected[SENDERS];
+		thread.setCoalescing(true);
+		TEST_ASSERT(thread.isCoalescing());
+		for (int s = 0 ; s < SENDERS ; s++)
+		{
+			rejected[s] = senders[s].submit<int>([&thread , &func , PER_SENDER]{
+				int count = 0;
+				for (int i = 0 ; i < PER_SENDER ; i++)
+				{
+					version.fetch_add(1);
+					if (!thread.setFunction(&func)) count++;
+					if (i % 500 == 0) usleep(300);
+				}
+				return count;
+			});
+		}
+		for (int s = 0 ; s < SENDERS ; s++)
+		{
+			TEST_ASSERT(rejected[s].get() == 0);
+			senders[s].stop();
+		}
+		long last = version.load();
+		TEST_ASSERT(WaitUntil([&]{
+			return func.getStatus() == THFUNC_STATE_COMLETED && thread.getThreadFunctions() == 0;
+		}));
+		TEST_ASSERT(func.seen.load() == last);
+		TEST_ASSERT(func.runs.load() < SENDERS * PER_SENDER);
+		TEST_ASSERT(thread.getCoalescedFunctions() > 0);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		集約しない場合は実行待ちの積み上げも個別に実行される
+	 */
+	int testDisabled()
+	{
+		ThreadCall	thread;
+		TestGate	gate;
+		Snapshot	func;
+		TEST_ASSERT(!thread.isCoalescing());
+		TEST_ASSERT(thread.setFunction(&gate));
+		TEST_ASSERT(gate.waitEntered());
+		bool first	= thread.setFunction(&func);
+		bool second	= thread.setFunction(&func);
+		gate.open();
+		TEST_ASSERT(first && second);
+		TEST_ASSERT(WaitUntil([&]{ return func.runs.load() == 2; }));
+		TEST_ASSERT(thread.getCoalescedFunctions() == 0);
+		thread.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testNoLostUpdate);
+	TEST_RUN(testDisabled);
+	return failed;
+}
@@ -0,0 +1,110 @@
+/* ***************************************************************************
+ * @file		TestCommon.hpp
+ * @brief		動作確認用の共通定義
+ * @note		各動作確認は単独の実行ファイルとしてビルドされ、
+ * 				失敗した場合は0以外を返却します。
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#ifndef VSTDTESTCOMMON_HPP_
+#define VSTDTESTCOMMON_HPP_
+
+#include <stdio.h>
+#include <unistd.h>
+#include <atomic>
+#include "VSTDThreadCall.hpp"
+
+/**
+ * @brief		条件の確認
+ * @note		条件を満たさない場合は位置を出力し、呼び出し元の関数から1を返却します。
+ */
+#define TEST_ASSERT(cond)															\
+	do																				\
+	{																				\
+		if (!(cond))																\
+		{																			\
+			fprintf(stderr , "%s:%d: TEST_ASSERT(%s)\n" , __FILE__ , __LINE__ , #cond);	\
+			return 1;																\
+		}																			\
+	} while (0)
+
+/**
+ * @brief		動作確認の実行
+ * @note		mainから呼び出し、失敗した動作確認の名前を出力します。
+ */
+#define TEST_RUN(func)																\
+	do																				\
+	{																				\
+		if (func() != 0)															\
+		{																			\
+			fprintf(stderr , "  %s failed\n" , #func);								\
+			failed++;																\
+		}																			\
+	} while (0)
+
+namespace VSTDTest
+{
+	/**
+	 * @brief		TestGate
+	 * @note		開くまで実行中のワーカーを停止させるThreadFunctionです。
+	 * 				ワーカーを停止させた状態で待ち行列を積み上げる為に使用します。
+	 * @author	Sebastian
+	 * @date		2026/10/19
+	 */
+	class TestGate : public VSTD::ThreadFunction
+	{
+		public:
+			std::atomic<bool>	entered;
+			std::atomic<bool>	opened;
+			TestGate(void) : entered(false) , opened(false) {}
+			bool Function()
+			{
+				entered.store(true);
+				while (!opened.load())
+				{
+					usleep(1000);
+				}
+				return true;
+			}
+			/** @brief ワーカーが停止するまで待機 */
+			bool waitEntered(long timeout = 5000)
+			{
+				return waitFor(entered , timeout);
+			}
+			void open()
+			{
+				opened.store(true);
+			}
+			/** @brief 値がtrueとなるまでミリ秒単位で待機 */
+			static bool waitFor(std::atomic<bool> & flag , long timeout)
+			{
+				for (long i = 0 ; i < timeout && !flag.load() ; i++)
+				{
+					usleep(1000);
+				}
+				return flag.load();
+			}
+	};
+	/**
+	 * @brief		条件を満たすまでミリ秒単位で待機
+	 * @param[in]	pred：条件(引数無しで呼び出し可能なもの)
+	 * @param[in]	timeout：タイムアウト(ミリ秒)
+	 * @return	条件を満たした場合はtrue
+	 */
+	template <class P>
+	bool WaitUntil(P pred , long timeout = 5000)
+	{
+		for (long i = 0 ; i < timeout ; i++)
+		{
+			if (pred()) return true;
+			usleep(1000);
+		}
+		return pred();
+	}
+}
+
+#endif /*VSTDTESTCOMMON_HPP_*/
@@ -0,0 +1,101 @@
+/* ***************************************************************************
+ * @file		TestDeadline.cpp
+ * @brief		デッドライン(EDF)スケジューリングの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 実行順を記録するThreadFunction */
+	class OrderFunction : public ThreadFunction
+	{
+		public:
+			int					id;
+			int *				order;
+			std::atomic<int> *	count;
+			bool Function()
+			{
+				order[count->fetch_add(1)] = id;
+				return true;
+			}
+	};
+	/**
+	 * @brief		実行期限の早い順に実行され、期限切れは実行されない
+	 */
+	int testEarliestDeadlineFirst()
+	{
+		ThreadCall			thread;
+		TestGate			gate;
+		OrderFunction		funcs[5];
+		struct timespec		deadline[5];
+		long				offset[5] = { 500000 , 100000 , -1000 , 300000 , 200000 };
+		int					order[5] = { -1 , -1 , -1 , -1 , -1 };
+		std::atomic<int>	count(0);
+		TEST_ASSERT(thread.setScheduleType(TH_SCHED_DEADLINE));
+		thread.setFunction(&gate);
+		TEST_ASSERT(gate.waitEntered());
+		for (int i = 0 ; i < 5 ; i++)
+		{
+			funcs[i].id		= i;
+			funcs[i].order	= order;
+			funcs[i].count	= &count;
+			SetDeadline(&deadline[i] , offset[i]);
+			TEST_ASSERT(thread.setFunction(&funcs[i] , &deadline[i]));
+		}
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return count.load() == 4 && thread.getExpiredFunctions() == 1; }));
+		TEST_ASSERT(order[0] == 1);
+		TEST_ASSERT(order[1] == 4);
+		TEST_ASSERT(order[2] == 3);
+		TEST_ASSERT(order[3] == 0);
+		TEST_ASSERT(funcs[2].getStatus() == THFUNC_STATE_EXPIRED);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		期限切れにより破棄されたThreadFunctionのwaitは即座に完了する
+	 */
+	int testWaitReturnsOnExpired()
+	{
+		ThreadCall			thread;
+		TestGate			gate;
+		OrderFunction		func;
+		struct timespec		deadline;
+		int					order[1];
+		std::atomic<int>	count(0);
+		func.id		= 0;
+		func.order	= order;
+		func.count	= &count;
+		thread.setScheduleType(TH_SCHED_DEADLINE);
+		thread.setFunction(&gate);
+		TEST_ASSERT(gate.waitEntered());
+		SetDeadline(&deadline , 1000);
+		TEST_ASSERT(thread.setFunction(&func , &deadline));
+		usleep(5000);
+		gate.open();
+		long long start = GetMonotonicTime();
+		TEST_ASSERT(func.wait(5));
+		TEST_ASSERT(GetMonotonicTime() - start < 1000000000LL);
+		TEST_ASSERT(func.getStatus() == THFUNC_STATE_EXPIRED);
+		TEST_ASSERT(count.load() == 0);
+		thread.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testEarliestDeadlineFirst);
+	TEST_RUN(testWaitReturnsOnExpired);
+	return failed;
+}
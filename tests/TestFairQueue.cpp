@@ -0,0 +1,138 @@
+/* ***************************************************************************
+ * @file		TestFairQueue.cpp
+ * @brief		テナント単位の重み付き公平キューイングの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 実行したテナントを記録するThreadFunction */
+	class TenantFunction : public ThreadFunction
+	{
+		public:
+			int					tenant;
+			int *				order;
+			std::atomic<int> *	count;
+			bool Function()
+			{
+				order[count->fetch_add(1)] = tenant;
+				return true;
+			}
+	};
+	/**
+	 * @brief		重みに従った割合で取り出される(Deficit Round Robin)
+	 */
+	int testWeightedShare()
+	{
+		ThreadCall			thread;
+		TestGate			gate;
+		TenantFunction		funcs[40];
+		int					order[40];
+		std::atomic<int>	count(0);
+		TEST_ASSERT(thread.setScheduleType(TH_SCHED_FAIR));
+		TEST_ASSERT(thread.addTenant(1 , 3));
+		TEST_ASSERT(thread.addTenant(2 , 1));
+		thread.setFunction(&gate);
+		TEST_ASSERT(gate.waitEntered());
+		for (int i = 0 ; i < 40 ; i++)
+		{
+			funcs[i].tenant	= i < 20 ? 1 : 2;
+			funcs[i].order	= order;
+			funcs[i].count	= &count;
+			TEST_ASSERT(thread.setTenantFunction(funcs[i].tenant , &funcs[i]));
+		}
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return count.load() == 40; }));
+		/* 両方のテナントに残りがある間は3:1で取り出される */
+		int first = 0;
+		for (int i = 0 ; i < 24 ; i++)
+		{
+			if (order[i] == 1) first++;
+		}
+		TEST_ASSERT(first == 18);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		テナントの上限は全体の上限より先に判定され、拒否はテナントへ計上される
+	 */
+	int testTenantQuota()
+	{
+		ThreadCall			thread;
+		TestGate			gate;
+		TenantFunction		funcs[MAX_THREAD];
+		int					order[MAX_THREAD];
+		std::atomic<int>	count(0);
+		ThreadTenantStat_t	stat;
+		TEST_ASSERT(thread.setScheduleType(TH_SCHED_FAIR));
+		TEST_ASSERT(thread.addTenant(1));
+		thread.setFunction(&gate);
+		TEST_ASSERT(gate.waitEntered());
+		int accepted = 0;
+		for (int i = 0 ; i < MAX_THREAD ; i++)
+		{
+			funcs[i].tenant	= 1;
+			funcs[i].order	= order;
+			funcs[i].count	= &count;
+			if (thread.setTenantFunction(1 , &funcs[i])) accepted++;
+		}
+		/* 既定の上限は全体の上限未満 */
+		TEST_ASSERT(TH_TENANT_DEPTH < MAX_THREAD);
+		TEST_ASSERT(accepted == TH_TENANT_DEPTH);
+		TEST_ASSERT(thread.getTenantStat(1 , &stat));
+		TEST_ASSERT(stat.rejected == (unsigned long)(MAX_THREAD - TH_TENANT_DEPTH));
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return count.load() == accepted; }));
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		積まれているデータが既定のテナントに収まらない場合は切り替えに失敗する
+	 */
+	int testScheduleSwitchFailure()
+	{
+		ThreadCall			thread;
+		TestGate			gate;
+		TenantFunction		funcs[30];
+		int					order[30];
+		std::atomic<int>	count(0);
+		thread.setFunction(&gate);
+		TEST_ASSERT(gate.waitEntered());
+		for (int i = 0 ; i < 30 ; i++)
+		{
+			funcs[i].tenant	= TH_TENANT_DEFAULT;
+			funcs[i].order	= order;
+			funcs[i].count	= &count;
+			TEST_ASSERT(thread.setFunction(&funcs[i]));
+		}
+		TEST_ASSERT(thread.addTenant(TH_TENANT_DEFAULT , 1 , 2));
+		TEST_ASSERT(!thread.setScheduleType(TH_SCHED_FAIR));
+		TEST_ASSERT(thread.getScheduleType() == TH_SCHED_LIFO);
+		/* 既定のテナントが無い場合は積まれている数まで拡張して切り替える */
+		TEST_ASSERT(thread.removeTenant(TH_TENANT_DEFAULT));
+		TEST_ASSERT(thread.setScheduleType(TH_SCHED_FAIR));
+		TEST_ASSERT(thread.getScheduleType() == TH_SCHED_FAIR);
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return count.load() == 30; }));
+		thread.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testWeightedShare);
+	TEST_RUN(testTenantQuota);
+	TEST_RUN(testScheduleSwitchFailure);
+	return failed;
+}
@@ -0,0 +1,174 @@
+/* ***************************************************************************
+ * @file		TestFiber.cpp
+ * @brief		ファイバー及びファイバー用同期オブジェクトの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <stdexcept>
+#include "VSTDFiber.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	FiberMutex			fiberMutex;
+	FiberCondition		fiberCondition;
+	long				counter	= 0;
+	int					turn	= 0;
+	std::atomic<int>	inside(0);
+	std::atomic<int>	broken(0);
+	std::atomic<int>	done(0);
+	/**
+	 * @brief		保持中に譲りながらカウンターを加算するThreadFunction
+	 */
+	class Increment : public ThreadFunction
+	{
+		public:
+			Increment(void)
+			{
+				setAutoRelease(true);
+			}
+			bool Function()
+			{
+				for (int i = 0 ; i < 100 ; i++)
+				{
+					fiberMutex.lock();
+					if (inside.fetch_add(1) != 0) broken.fetch_add(1);
+					counter++;
+					if (i % 10 == 0) Fiber::yield();
+					inside.fetch_sub(1);
+					fiberMutex.unlock();
+				}
+				done.fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		自身の順番となるまで待機するThreadFunction
+	 */
+	class TakeTurn : public ThreadFunction
+	{
+		private:
+			int		index;
+			int		total;
+		public:
+			TakeTurn(int position , int count) : index(position) , total(count)
+			{
+				setAutoRelease(true);
+			}
+			bool Function()
+			{
+				fiberMutex.lock();
+				while (turn % total != index)
+				{
+					fiberCondition.wait(fiberMutex);
+				}
+				turn++;
+				fiberCondition.broadcast();
+				fiberMutex.unlock();
+				done.fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		例外を送出するThreadFunction
+	 */
+	class Throw : public ThreadFunction
+	{
+		public:
+			bool Function()
+			{
+				throw std::runtime_error("fiber");
+			}
+	};
+	/**
+	 * @brief		ファイバー同士がFiberMutexにて排他され、譲っても保持が維持される
+	 */
+	int testMutex()
+	{
+		FiberScheduler scheduler(4);
+		counter = 0;
+		done.store(0);
+		for (int i = 0 ; i < 1000 ; i++)
+		{
+			TEST_ASSERT(scheduler.spawn(new Increment()));
+		}
+		TEST_ASSERT(WaitUntil([]{ return done.load() == 1000; } , 10000));
+		TEST_ASSERT(broken.load() == 0);
+		TEST_ASSERT(counter == 100000);
+		scheduler.stop();
+		return 0;
+	}
+	/**
+	 * @brief		FiberConditionにて逆順に生成したファイバーが順番に処理される
+	 */
+	int testCondition()
+	{
+		const int		COUNT = 200;
+		FiberScheduler	scheduler(2);
+		turn = 0;
+		done.store(0);
+		for (int i = COUNT - 1 ; i >= 0 ; i--)
+		{
+			TEST_ASSERT(scheduler.spawn(new TakeTurn(i , COUNT)));
+		}
+		TEST_ASSERT(WaitUntil([]{ return done.load() == COUNT; } , 10000));
+		TEST_ASSERT(turn == COUNT);
+		scheduler.stop();
+		return 0;
+	}
+	/**
+	 * @brief		ワーカー数を超えるファイバーが実行結果を待機しても停止しない
+	 */
+	int testFutureWait()
+	{
+		const int		COUNT = 500;
+		FiberScheduler	scheduler(2);
+		Future<int> *	outer = new Future<int>[COUNT];
+		for (int i = 0 ; i < COUNT ; i++)
+		{
+			Future<int> inner = scheduler.submit<int>([i]{ Fiber::yield(); return i; });
+			outer[i] = scheduler.submit<int>([inner]() mutable { return inner.get() * 2; });
+		}
+		long sum = 0;
+		for (int i = 0 ; i < COUNT ; i++)
+		{
+			sum += outer[i].get();
+		}
+		delete[] outer;
+		TEST_ASSERT(sum == (long)(COUNT - 1) * COUNT);
+		scheduler.stop();
+		return 0;
+	}
+	/**
+	 * @brief		例外を送出したファイバーも完了となり、ワーカーは処理を継続する
+	 */
+	int testException()
+	{
+		FiberScheduler	scheduler(1);
+		Throw			func;
+		TEST_ASSERT(scheduler.spawn(&func));
+		TEST_ASSERT(func.wait(2));
+		TEST_ASSERT(func.getStatus() == THFUNC_STATE_COMLETED);
+		Future<int> result = scheduler.submit<int>([]{ return 5; });
+		TEST_ASSERT(result.get() == 5);
+		scheduler.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testMutex);
+	TEST_RUN(testCondition);
+	TEST_RUN(testFutureWait);
+	TEST_RUN(testException);
+	return failed;
+}
@@ -0,0 +1,148 @@
+/* ***************************************************************************
+ * @file		TestFuture.cpp
+ * @brief		型付き実行結果(submit/Future)の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 積み上げ直後の解放の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		実行結果と例外が呼び出し元へ引き渡される
+	 */
+	int testResultAndException()
+	{
+		ThreadCall thread;
+		Future<std::unique_ptr<std::string> > text = thread.submit<std::unique_ptr<std::string> >(
+			[]{ return std::unique_ptr<std::string>(new std::string("hello")); });
+		Future<int>		number	= thread.submit<int>([]{ return 42; });
+		Future<void>	failure	= thread.submit<void>([]{ throw std::runtime_error("boom"); });
+		TEST_ASSERT(whenAll(text , number , failure));
+		TEST_ASSERT(*text.get() == "hello");
+		TEST_ASSERT(number.get() == 42);
+		bool caught = false;
+		try
+		{
+			failure.get();
+		}
+		catch (std::runtime_error & e)
+		{
+			caught = (std::string(e.what()) == "boom");
+		}
+		TEST_ASSERT(caught);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		期限切れにより破棄された場合はgetが例外を送出する
+	 */
+	int testAbandoned()
+	{
+		ThreadCall		thread;
+		struct timespec	deadline;
+		SetDeadline(&deadline , -10);
+		Future<int> expired = thread.submit<int>([]{ return 1; } , &deadline);
+		TEST_ASSERT(expired.wait(5000));
+		TEST_ASSERT(expired.getStatus() == FUTURE_ABANDONED);
+		bool caught = false;
+		try
+		{
+			expired.get();
+		}
+		catch (std::runtime_error &)
+		{
+			caught = true;
+		}
+		TEST_ASSERT(caught);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		共有状態を保持していないFutureのgetは例外を送出する
+	 */
+	int testInvalidFuture()
+	{
+		Future<int>		number;
+		Future<void>	nothing;
+		TEST_ASSERT(!number.valid());
+		int caught = 0;
+		try
+		{
+			number.get();
+		}
+		catch (std::runtime_error &)
+		{
+			caught++;
+		}
+		try
+		{
+			nothing.get();
+		}
+		catch (std::runtime_error &)
+		{
+			caught++;
+		}
+		TEST_ASSERT(caught == 2);
+		return 0;
+	}
+	/**
+	 * @brief		積み上げ直後にワーカーが実行・解放しても全ての結果が引き渡される
+	 */
+	int testSubmitRace()
+	{
+		ThreadCall	thread;
+		Future<int>	results[90];
+		for (int round = 0 ; round < 1000 ; round++)
+		{
+			for (int i = 0 ; i < 90 ; i++)
+			{
+				results[i] = thread.submit<int>([i]{ return i; });
+			}
+			for (int i = 0 ; i < 90 ; i++)
+			{
+				TEST_ASSERT(results[i].get() == i);
+			}
+		}
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		whenAnyは最初に完了したものの位置を返却する
+	 */
+	int testWhenAny()
+	{
+		ThreadCall		slow;
+		ThreadCall		fast;
+		Future<int> first	= slow.submit<int>([]{ Sleep(200); return 1; });
+		Future<int> second	= fast.submit<int>([]{ return 2; });
+		TEST_ASSERT(whenAny(first , second) == 1);
+		TEST_ASSERT(second.get() == 2);
+		TEST_ASSERT(first.get() == 1);
+		slow.stop();
+		fast.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testResultAndException);
+	TEST_RUN(testAbandoned);
+	TEST_RUN(testInvalidFuture);
+	TEST_RUN(testWhenAny);
+	TEST_RUN(testSubmitRace);
+	return failed;
+}
@@ -0,0 +1,147 @@
+/* ***************************************************************************
+ * @file		TestJournal.cpp
+ * @brief		ジャーナルによる未完了データの再実行の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 再実行の補充をワーカースレッドに任せる様に変更
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <dirent.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <string>
+#include "VSTDJournal.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		記録するデータ
+	 */
+	typedef struct
+	{
+		long	id;
+		char	pad[56];
+	} Record_t;
+	/**
+	 * @brief		受け取ったデータの合計を記録する受信スレッド
+	 */
+	class Worker : public ThreadCall
+	{
+		public:
+			std::atomic<long>	sum;
+			std::atomic<long>	count;
+			Worker(void) : sum(0) , count(0) {}
+			~Worker(void)
+			{
+				stop();
+			}
+			using ThreadCall::onFunction;
+			bool onFunction(void * Data)
+			{
+				sum.fetch_add(((Record_t *)Data)->id);
+				count.fetch_add(1);
+				return true;
+			}
+	};
+	/** @brief ディレクトリ内のファイルを削除してディレクトリを削除 */
+	void RemoveDirectory(const std::string & path)
+	{
+		DIR * dir = opendir(path.c_str());
+		if (!dir) return;
+		struct dirent * entry;
+		while ((entry = readdir(dir)) != NULL)
+		{
+			if (strcmp(entry->d_name , ".") == 0 || strcmp(entry->d_name , "..") == 0) continue;
+			unlink((path + "/" + entry->d_name).c_str());
+		}
+		closedir(dir);
+		rmdir(path.c_str());
+	}
+	/**
+	 * @brief		異常終了したプロセスの未完了データのみが再実行され、
+	 * 				処理後は再実行対象として残らない
+	 */
+	int testCrashReplay()
+	{
+		const int	COUNT = 5000;
+		char		temp[] = "/tmp/VSTDTestJournal.XXXXXX";
+		TEST_ASSERT(mkdtemp(temp) != NULL);
+		std::string	path = std::string(temp) + "/journal";
+		pid_t pid = fork();
+		TEST_ASSERT(pid >= 0);
+		if (pid == 0)
+		{
+			Journal * journal = new Journal();
+			if (!journal->open(path.c_str() , JOURNAL_SYNC_INTERVAL , 5 , 1 << 16)) _exit(1);
+			Record_t record;
+			memset(&record , 0 , sizeof(record));
+			for (int i = 0 ; i < COUNT ; i++)
+			{
+				record.id = i;
+				void * payload = journal->append(&record , sizeof(record));
+				if (!payload) _exit(2);
+				if (i % 10) journal->complete(payload);
+			}
+			journal->sync();
+			/* 閉じずに終了 */
+			_exit(0);
+		}
+		int status;
+		TEST_ASSERT(waitpid(pid , &status , 0) == pid);
+		TEST_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+		long expect = 0;
+		for (int i = 0 ; i < COUNT ; i += 10) expect += i;
+		Journal *		journal = new Journal();
+		JournalStat_t	stat;
+		TEST_ASSERT(journal->open(path.c_str() , JOURNAL_SYNC_INTERVAL , 5 , 1 << 16));
+		journal->getStat(&stat);
+		TEST_ASSERT(stat.recovered == (unsigned long)(COUNT / 10));
+		Worker * worker = new Worker();
+		TEST_ASSERT(worker->setJournal(journal , sizeof(Record_t)));
+		/* 待ち行列を超える分もワーカースレッドが補充して実行する */
+		TEST_ASSERT(WaitUntil([&]{ return worker->count.load() == COUNT / 10; }));
+		TEST_ASSERT(journal->getReplayCount() == 0);
+		TEST_ASSERT(worker->sum.load() == expect);
+		/* 以降の積み上げも記録され、処理後に完了となる */
+		Record_t record;
+		memset(&record , 0 , sizeof(record));
+		record.id = 1;
+		for (int i = 0 ; i < 50 ; i++)
+		{
+			while (!worker->setFunction(&record)) usleep(100);
+		}
+		TEST_ASSERT(WaitUntil([&]{ return worker->count.load() == COUNT / 10 + 50; }));
+		/* 完了数には再実行した分も含まれる */
+		TEST_ASSERT(WaitUntil([&]{
+			journal->getStat(&stat);
+			return stat.completed == stat.recovered + stat.appended;
+		}));
+		TEST_ASSERT(stat.appended == 50);
+		delete worker;
+		delete journal;
+		/* 全て完了した後は再実行の対象が無い */
+		journal = new Journal();
+		TEST_ASSERT(journal->open(path.c_str()));
+		journal->getStat(&stat);
+		TEST_ASSERT(stat.recovered == 0);
+		delete journal;
+		RemoveDirectory(path);
+		rmdir(temp);
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testCrashReplay);
+	return failed;
+}
@@ -0,0 +1,202 @@
+/* ***************************************************************************
+ * @file		TestLockProfiler.cpp
+ * @brief		ロック競合の計測の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 終了したスレッドの集計、及びMutex/Conditionの計測の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <string.h>
+#include <pthread.h>
+#include "VSTDLockProfiler.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	pthread_mutex_t		target = PTHREAD_MUTEX_INITIALIZER;
+	long				counter = 0;
+	/** @brief 計測対象のロックとして記録するアドレス */
+	int					lockKey;
+	/** @brief 呼び出し元として記録するアドレス */
+	int					siteKey;
+	/** @brief 計測付きでロックを繰り返し取得 */
+	void Bump(int count)
+	{
+		for (int i = 0 ; i < count ; i++)
+		{
+			LockProfileHold_t hold;
+			LockProfiler::lock(&target , &lockKey , &siteKey , &hold);
+			counter++;
+			LockProfiler::unlock(&hold);
+			pthread_mutex_unlock(&target);
+		}
+	}
+	/** @brief 100回取得して終了するスレッド */
+	void * BumpAndExit(void *)
+	{
+		Bump(100);
+		return NULL;
+	}
+	/**
+	 * @brief		レポートから計測対象の取得回数・競合回数を読み取る
+	 * @note		呼び出し元が複数の場合は合計します。
+	 * @param[in]	key：計測対象のロックのアドレス
+	 * @return	計測対象の行が存在した場合はtrue
+	 */
+	bool ReadReport(unsigned long * acquisitions , unsigned long * contended , const void * key = &lockKey)
+	{
+		FILE *	fp = tmpfile();
+		char	prefix[32];
+		char	line[512];
+		bool	found = false;
+		unsigned long	acquired;
+		unsigned long	waited;
+		if (!fp) return false;
+		*acquisitions	= 0;
+		*contended		= 0;
+		LockProfiler::report(fp);
+		rewind(fp);
+		snprintf(prefix , sizeof(prefix) , "%-18p " , key);
+		while (fgets(line , sizeof(line) , fp))
+		{
+			if (strncmp(line , prefix , strlen(prefix)) == 0
+			&&	sscanf(line + strlen(prefix) , "%lu %lu" , &acquired , &waited) == 2)
+			{
+				*acquisitions	+= acquired;
+				*contended		+= waited;
+				found = true;
+			}
+		}
+		fclose(fp);
+		return found;
+	}
+	/**
+	 * @brief		計測中のみ、複数スレッドからの取得回数と競合回数が集計される
+	 */
+	int testCountAcrossThreads()
+	{
+		const int		THREADS		= 4;
+		const int		PER_THREAD	= 20000;
+		unsigned long	acquisitions	= 0;
+		unsigned long	contended		= 0;
+		/* 計測前の取得は記録されない */
+		LockProfiler::enable(false);
+		Bump(100);
+		TEST_ASSERT(!ReadReport(&acquisitions , &contended));
+		LockProfiler::enable(true);
+		TEST_ASSERT(LockProfiler::isEnabled());
+		ThreadCall		threads[THREADS];
+		Future<void>	results[THREADS];
+		for (int i = 0 ; i < THREADS ; i++)
+		{
+			results[i] = threads[i].submit<void>([PER_THREAD]{ Bump(PER_THREAD); });
+		}
+		for (int i = 0 ; i < THREADS ; i++)
+		{
+			results[i].get();
+			threads[i].stop();
+		}
+		TEST_ASSERT(counter == 100 + THREADS * PER_THREAD);
+		TEST_ASSERT(ReadReport(&acquisitions , &contended));
+		TEST_ASSERT(acquisitions == (unsigned long)(THREADS * PER_THREAD));
+		TEST_ASSERT(contended <= acquisitions);
+		/* 初期化後は記録が残らない */
+		LockProfiler::reset();
+		TEST_ASSERT(!ReadReport(&acquisitions , &contended) || acquisitions == 0);
+		LockProfiler::enable(false);
+		return 0;
+	}
+	/**
+	 * @brief		終了したスレッドの記録は集計に残り、記録領域は再利用される
+	 */
+	int testRetiredThreads()
+	{
+		const int		THREADS		= 50;
+		unsigned long	acquisitions	= 0;
+		unsigned long	contended		= 0;
+		LockProfiler::reset();
+		LockProfiler::enable(true);
+		pthread_t first;
+		TEST_ASSERT(pthread_create(&first , NULL , BumpAndExit , NULL) == 0);
+		pthread_join(first , NULL);
+		unsigned long created = LockProfiler::getTableCount();
+		for (int i = 1 ; i < THREADS ; i++)
+		{
+			pthread_t thread;
+			TEST_ASSERT(pthread_create(&thread , NULL , BumpAndExit , NULL) == 0);
+			pthread_join(thread , NULL);
+		}
+		TEST_ASSERT(LockProfiler::getTableCount() == created);
+		TEST_ASSERT(ReadReport(&acquisitions , &contended));
+		TEST_ASSERT(acquisitions == (unsigned long)(THREADS * 100));
+		LockProfiler::reset();
+		TEST_ASSERT(!ReadReport(&acquisitions , &contended) || acquisitions == 0);
+		LockProfiler::enable(false);
+		return 0;
+	}
+#ifdef VSTD_LOCK_PROFILE
+	/**
+	 * @brief		VSTD_LOCK_PROFILEを定義したビルドではMutex/Conditionの取得が記録される
+	 */
+	int testMutexAndCondition()
+	{
+		const int		THREADS		= 4;
+		const int		PER_THREAD	= 10000;
+		unsigned long	acquisitions	= 0;
+		unsigned long	contended		= 0;
+		Mutex			mutex;
+		Condition		condition;
+		long			shared = 0;
+		LockProfiler::reset();
+		LockProfiler::enable(true);
+		ThreadCall		threads[THREADS];
+		Future<void>	results[THREADS];
+		for (int i = 0 ; i < THREADS ; i++)
+		{
+			results[i] = threads[i].submit<void>([&mutex , &shared , PER_THREAD]{
+				for (int j = 0 ; j < PER_THREAD ; j++)
+				{
+					mutex.lock();
+					shared++;
+					mutex.unlock();
+				}
+			});
+		}
+		for (int i = 0 ; i < 100 ; i++)
+		{
+			condition.set();
+			condition.wait();
+		}
+		for (int i = 0 ; i < THREADS ; i++)
+		{
+			results[i].get();
+			threads[i].stop();
+		}
+		TEST_ASSERT(shared == THREADS * PER_THREAD);
+		TEST_ASSERT(ReadReport(&acquisitions , &contended , &mutex));
+		TEST_ASSERT(acquisitions == (unsigned long)(THREADS * PER_THREAD));
+		TEST_ASSERT(contended <= acquisitions);
+		TEST_ASSERT(ReadReport(&acquisitions , &contended , &condition));
+		TEST_ASSERT(acquisitions == 200);
+		LockProfiler::enable(false);
+		return 0;
+	}
+#endif
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testCountAcrossThreads);
+	TEST_RUN(testRetiredThreads);
+#ifdef VSTD_LOCK_PROFILE
+	TEST_RUN(testMutexAndCondition);
+#endif
+	return failed;
+}
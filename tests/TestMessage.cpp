@@ -0,0 +1,167 @@
+/* ***************************************************************************
+ * @file		TestMessage.cpp
+ * @brief		可変長メッセージの複製による積み上げ(post)の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <string>
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 送信スレッド数 */
+	const int SENDERS = 4;
+	/** @brief 生存しているTrackedの数 */
+	std::atomic<int> live(0);
+	/**
+	 * @brief		生成と破棄を数えるメッセージ
+	 */
+	class Tracked
+	{
+		public:
+			std::string		text;
+			int				seq;
+			Tracked(const std::string & value , int number) : text(value) , seq(number)
+			{
+				live.fetch_add(1);
+			}
+			Tracked(Tracked && other) : text(std::move(other.text)) , seq(other.seq)
+			{
+				live.fetch_add(1);
+			}
+			~Tracked(void)
+			{
+				live.fetch_sub(1);
+			}
+	};
+	/** @brief Trackedに格納する文字列(複製時にヒープを使用する長さ) */
+	const char * const TEXT = "a message long enough to use the heap";
+	/**
+	 * @brief		送信者毎の順序と内容を確認する受信スレッド
+	 * @note		先頭に送信者番号と連番を格納し、以降は連番から求めた値で埋めます。
+	 */
+	class Receiver : public ThreadCall
+	{
+		public:
+			std::atomic<long>	messages;
+			std::atomic<long>	objects;
+			std::atomic<int>	broken;
+			int					last[SENDERS];
+			Receiver(void) : messages(0) , objects(0) , broken(0)
+			{
+				for (int i = 0 ; i < SENDERS ; i++) last[i] = -1;
+			}
+			~Receiver(void)
+			{
+				stop();
+			}
+			using ThreadCall::onFunction;
+			bool onFunction(const void * data , size_t len)
+			{
+				if (len == sizeof(Tracked))
+				{
+					if (((const Tracked *)data)->text != TEXT) broken.fetch_add(1);
+					objects.fetch_add(1);
+					return true;
+				}
+				const int * head = (const int *)data;
+				int sender	= head[0];
+				int seq		= head[1];
+				if (sender < 0 || sender >= SENDERS || seq != last[sender] + 1)
+				{
+					broken.fetch_add(1);
+					return true;
+				}
+				last[sender] = seq;
+				for (size_t i = 2 * sizeof(int) ; i < len ; i++)
+				{
+					if (((const unsigned char *)data)[i] != (unsigned char)(seq + i))
+					{
+						broken.fetch_add(1);
+						break;
+					}
+				}
+				messages.fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		複数スレッドからの可変長メッセージが送信者毎の順序と内容を保って受信される
+	 */
+	int testOrderAndContent()
+	{
+		const int		PER_SENDER = 10000;
+		Receiver *		receiver = new Receiver();
+		ThreadCall		senders[SENDERS + 1];
+		Future<void>	sent[SENDERS + 1];
+		TEST_ASSERT(receiver->setMessageCapacity(4096));
+		for (int s = 0 ; s < SENDERS ; s++)
+		{
+			sent[s] = senders[s].submit<void>([receiver , s , PER_SENDER]{
+				unsigned char buffer[300];
+				for (int seq = 0 ; seq < PER_SENDER ; seq++)
+				{
+					size_t len = 2 * sizeof(int) + (seq * 7) % 250;
+					if (len == sizeof(Tracked)) len++;
+					((int *)buffer)[0] = s;
+					((int *)buffer)[1] = seq;
+					for (size_t i = 2 * sizeof(int) ; i < len ; i++) buffer[i] = (unsigned char)(seq + i);
+					while (!receiver->post(buffer , len)) usleep(50);
+				}
+			});
+		}
+		sent[SENDERS] = senders[SENDERS].submit<void>([receiver , PER_SENDER]{
+			for (int seq = 0 ; seq < PER_SENDER ; seq++)
+			{
+				while (!receiver->post(Tracked(TEXT , seq))) usleep(50);
+			}
+		});
+		for (int s = 0 ; s <= SENDERS ; s++)
+		{
+			sent[s].get();
+			senders[s].stop();
+		}
+		TEST_ASSERT(WaitUntil([&]{
+			return receiver->messages.load() + receiver->broken.load() == SENDERS * PER_SENDER
+				&& receiver->objects.load() == PER_SENDER;
+		} , 10000));
+		TEST_ASSERT(receiver->broken.load() == 0);
+		delete receiver;
+		TEST_ASSERT(live.load() == 0);
+		return 0;
+	}
+	/**
+	 * @brief		未処理のまま破棄されたメッセージもデストラクタが呼び出される
+	 */
+	int testDestroyPending()
+	{
+		Receiver *	receiver = new Receiver();
+		TestGate	gate;
+		TEST_ASSERT(receiver->setFunction(&gate));
+		TEST_ASSERT(gate.waitEntered());
+		for (int seq = 0 ; seq < 10 ; seq++)
+		{
+			TEST_ASSERT(receiver->post(Tracked(TEXT , seq)));
+		}
+		TEST_ASSERT(live.load() == 10);
+		gate.open();
+		delete receiver;
+		TEST_ASSERT(live.load() == 0);
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testOrderAndContent);
+	TEST_RUN(testDestroyPending);
+	return failed;
+}
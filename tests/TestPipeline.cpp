@@ -0,0 +1,152 @@
+/* ***************************************************************************
+ * @file		TestPipeline.cpp
+ * @brief		多段パイプラインの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include "VSTDPipeline.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		パイプラインを流れる要素
+	 */
+	typedef struct
+	{
+		long	seq;
+		long	value;
+	} Item_t;
+	/**
+	 * @brief		要素毎に処理時間を変え、一部の要素を破棄する段
+	 */
+	class Parse : public PipelineStage
+	{
+		public:
+			void * onStage(void * data)
+			{
+				Item_t * item = (Item_t *)data;
+				volatile long spin = 0;
+				for (long i = 0 ; i < (item->seq % 7) * 200 ; i++) spin += i;
+				item->value = item->seq * 2;
+				if (item->seq % 10 == 3)
+				{
+					delete item;
+					return NULL;
+				}
+				return item;
+			}
+	};
+	/**
+	 * @brief		値を加算する段
+	 */
+	class Add : public PipelineStage
+	{
+		public:
+			void * onStage(void * data)
+			{
+				((Item_t *)data)->value += 1;
+				return data;
+			}
+	};
+	/**
+	 * @brief		投入順に届いているかを確認する最終段
+	 */
+	class Sink : public PipelineStage
+	{
+		public:
+			long	next;
+			long	received;
+			long	broken;
+			Sink(void) : next(0) , received(0) , broken(0) {}
+			void * onStage(void * data)
+			{
+				Item_t * item = (Item_t *)data;
+				while (next % 10 == 3) next++;
+				if (item->seq != next || item->value != item->seq * 2 + 1) broken++;
+				next = item->seq + 1;
+				received++;
+				delete item;
+				return NULL;
+			}
+	};
+	/**
+	 * @brief		並列段の幅を変えても、投入順に最終段へ届き破棄された要素のみ欠ける
+	 */
+	int runOrdering(unsigned int parseWidth , unsigned int addWidth)
+	{
+		const long	COUNT = 20000;
+		Pipeline	pipeline(64);
+		Parse		parse;
+		Add			add;
+		Sink		sink;
+		TEST_ASSERT(pipeline.addStage(&parse , parseWidth));
+		TEST_ASSERT(pipeline.addStage(&add , addWidth));
+		TEST_ASSERT(pipeline.addStage(&sink , 1));
+		TEST_ASSERT(pipeline.start());
+		for (long i = 0 ; i < COUNT ; i++)
+		{
+			Item_t * item = new Item_t;
+			item->seq	= i;
+			item->value	= 0;
+			TEST_ASSERT(pipeline.push(item));
+		}
+		pipeline.close();
+		TEST_ASSERT(sink.broken == 0);
+		TEST_ASSERT(sink.received == COUNT - COUNT / 10);
+		PipelineStageStat_t stat;
+		TEST_ASSERT(pipeline.getStageStat(0 , &stat));
+		TEST_ASSERT(stat.width == parseWidth);
+		TEST_ASSERT(stat.processed == (unsigned long)COUNT);
+		TEST_ASSERT(stat.dropped == (unsigned long)(COUNT / 10));
+		TEST_ASSERT(stat.occupancy == 0);
+		return 0;
+	}
+	int testSameWidth()
+	{
+		return runOrdering(4 , 4);
+	}
+	int testFanOut()
+	{
+		return runOrdering(1 , 3);
+	}
+	int testFanIn()
+	{
+		return runOrdering(2 , 1);
+	}
+	/**
+	 * @brief		並列段から幅の異なる並列段へは接続出来ず、終了後は投入出来ない
+	 */
+	int testRejects()
+	{
+		Pipeline	pipeline;
+		Parse		parse;
+		Add			add;
+		Sink		sink;
+		TEST_ASSERT(pipeline.addStage(&parse , 2));
+		TEST_ASSERT(!pipeline.addStage(&add , 3));
+		TEST_ASSERT(pipeline.addStage(&sink , 1));
+		TEST_ASSERT(pipeline.start());
+		pipeline.close();
+		Item_t item = { 0 , 0 };
+		TEST_ASSERT(!pipeline.push(&item , 0));
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testSameWidth);
+	TEST_RUN(testFanOut);
+	TEST_RUN(testFanIn);
+	TEST_RUN(testRejects);
+	return failed;
+}
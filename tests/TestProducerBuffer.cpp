@@ -0,0 +1,185 @@
+/* ***************************************************************************
+ * @file		TestProducerBuffer.cpp
+ * @brief		積み上げ側スレッド毎のバッファの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 破棄時の未公開分及び生産者スレッドの終了の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <pthread.h>
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		受け取った値の合計を記録する受信スレッド
+	 */
+	class Sink : public ThreadCall
+	{
+		public:
+			std::atomic<long>	count;
+			std::atomic<long>	sum;
+			Sink(void) : count(0) , sum(0) {}
+			~Sink(void)
+			{
+				stop();
+			}
+			using ThreadCall::onFunction;
+			bool onFunction(void * Data)
+			{
+				sum.fetch_add((long)(intptr_t)Data);
+				count.fetch_add(1);
+				return true;
+			}
+	};
+	/** @brief 1から指定数までを積み上げる */
+	void Produce(Sink * sink , long count)
+	{
+		for (long i = 1 ; i <= count ; i++)
+		{
+			while (!sink->setFunction((void *)(intptr_t)i)) sched_yield();
+		}
+	}
+	/** @brief 10件積み上げて終了するスレッド */
+	void * ProduceAndExit(void * arg)
+	{
+		Produce((Sink *)arg , 10);
+		return NULL;
+	}
+	/** @brief 積み上げを終えた事を示すフラグ */
+	std::atomic<bool>	produced(false);
+	/** @brief 10件積み上げ、フラグを立てて終了するスレッド */
+	void * ProduceAndSignal(void * arg)
+	{
+		Produce((Sink *)arg , 10);
+		produced.store(true);
+		return NULL;
+	}
+	/**
+	 * @brief		複数スレッドからバッファ経由で積み上げても失われない
+	 */
+	int testManyProducers()
+	{
+		const int		PRODUCERS		= 8;
+		const long		PER_PRODUCER	= 20000;
+		Sink			sink;
+		ThreadCall		producers[PRODUCERS];
+		Future<void>	done[PRODUCERS];
+		TEST_ASSERT(sink.setProducerBuffer(64 , 50 , 1 << 20));
+		for (int p = 0 ; p < PRODUCERS ; p++)
+		{
+			done[p] = producers[p].submit<void>([&sink , PER_PRODUCER]{ Produce(&sink , PER_PRODUCER); });
+		}
+		for (int p = 0 ; p < PRODUCERS ; p++)
+		{
+			done[p].get();
+		}
+		TEST_ASSERT(WaitUntil([&]{ return sink.count.load() == PRODUCERS * PER_PRODUCER; } , 10000));
+		TEST_ASSERT(sink.sum.load() == PRODUCERS * PER_PRODUCER * (PER_PRODUCER + 1) / 2);
+		for (int p = 0 ; p < PRODUCERS ; p++)
+		{
+			producers[p].stop();
+		}
+		return 0;
+	}
+	/**
+	 * @brief		公開までの時間が長い場合もflush・積み上げ側スレッドの終了にて公開される
+	 */
+	int testFlushAndExit()
+	{
+		Sink sink;
+		TEST_ASSERT(sink.setProducerBuffer(64 , 1000000));
+		TEST_ASSERT(sink.setFunction((void *)1));
+		TEST_ASSERT(sink.setFunction((void *)2));
+		Sleep(20);
+		TEST_ASSERT(sink.count.load() == 0);
+		sink.flush();
+		TEST_ASSERT(WaitUntil([&]{ return sink.count.load() == 2; }));
+		pthread_t producer;
+		TEST_ASSERT(pthread_create(&producer , NULL , ProduceAndExit , &sink) == 0);
+		pthread_join(producer , NULL);
+		TEST_ASSERT(WaitUntil([&]{ return sink.count.load() == 12; }));
+		TEST_ASSERT(sink.sum.load() == 3 + 55);
+		return 0;
+	}
+	/**
+	 * @brief		バッファ経由でもThreadFunctionは実行され完了となる
+	 */
+	int testThreadFunction()
+	{
+		ThreadCall		thread;
+		TestGate		funcs[40];
+		TEST_ASSERT(thread.setProducerBuffer(16));
+		for (int i = 0 ; i < 40 ; i++)
+		{
+			funcs[i].open();
+			TEST_ASSERT(thread.setFunction(&funcs[i]));
+		}
+		for (int i = 0 ; i < 40 ; i++)
+		{
+			TEST_ASSERT(funcs[i].waitStatus(THFUNC_STATE_COMLETED , 1000000000LL));
+		}
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		未公開のまま破棄された場合、ThreadFunctionは期限切れとして解放される
+	 */
+	int testAbandonOnDestroy()
+	{
+		ThreadCall * thread = new ThreadCall();
+		TEST_ASSERT(thread->setProducerBuffer(64 , 1000000));
+		Future<int> result = thread->submit<int>([]{ return 1; });
+		delete thread;
+		TEST_ASSERT(result.wait(1000));
+		TEST_ASSERT(result.getStatus() == FUTURE_ABANDONED);
+		return 0;
+	}
+	/**
+	 * @brief		生産者スレッドの終了と受信スレッドの破棄が重なっても失敗しない
+	 */
+	int testExitDuringDestroy()
+	{
+		for (int i = 0 ; i < 200 ; i++)
+		{
+			Sink * sink = new Sink();
+			TEST_ASSERT(sink->setProducerBuffer(64 , 1000000));
+			produced.store(false);
+			pthread_t producer;
+			TEST_ASSERT(pthread_create(&producer , NULL , ProduceAndSignal , sink) == 0);
+			/* 積み上げ後、生産者スレッドの終了処理と並行して破棄する */
+			while (!produced.load()) sched_yield();
+			delete sink;
+			pthread_join(producer , NULL);
+		}
+		return 0;
+	}
+	/**
+	 * @brief		不正なサイズは拒否される
+	 */
+	int testInvalidSize()
+	{
+		Sink sink;
+		TEST_ASSERT(!sink.setProducerBuffer(MAX_PRODUCER_BUFFER + 1));
+		TEST_ASSERT(sink.setProducerBuffer(0));
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testManyProducers);
+	TEST_RUN(testFlushAndExit);
+	TEST_RUN(testThreadFunction);
+	TEST_RUN(testAbandonOnDestroy);
+	TEST_RUN(testExitDuringDestroy);
+	TEST_RUN(testInvalidSize);
+	return failed;
+}
@@ -0,0 +1,140 @@
+/* ***************************************************************************
+ * @file		TestReactor.cpp
+ * @brief		リアクター型スレッド(ファイルディスクリプタ・タイマー監視)の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 実行中の解除の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <sys/epoll.h>
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		読み込み可能となったパイプから読み込むReactorFunction
+	 */
+	class PipeReader : public ReactorFunction
+	{
+		public:
+			std::atomic<int>	bytes;
+			PipeReader(void) : bytes(0) {}
+			bool Function()
+			{
+				char	buffer[64];
+				ssize_t	size = read(getFd() , buffer , sizeof(buffer));
+				if (size > 0) bytes.fetch_add((int)size);
+				return size != 0;
+			}
+	};
+	/**
+	 * @brief		タイマーの満了回数を数えるReactorFunction
+	 */
+	class TickCount : public ReactorFunction
+	{
+		public:
+			std::atomic<unsigned long long>	ticks;
+			TickCount(void) : ticks(0) {}
+			bool Function()
+			{
+				ticks.fetch_add(getExpirations());
+				return true;
+			}
+	};
+	/**
+	 * @brief		実行に時間を要するタイマーのReactorFunction
+	 */
+	class SlowTick : public ReactorFunction
+	{
+		public:
+			std::atomic<bool>	inside;
+			std::atomic<int>	runs;
+			SlowTick(void) : inside(false) , runs(0) {}
+			bool Function()
+			{
+				inside.store(true);
+				Sleep(50);
+				runs.fetch_add(1);
+				inside.store(false);
+				return true;
+			}
+	};
+	/**
+	 * @brief		他のスレッドからの解除は実行中のReactorFunctionの完了を待ち、
+	 * 				以降は実行されない
+	 */
+	int testRemoveWhileRunning()
+	{
+		ThreadCall	thread;
+		SlowTick *	tick = new SlowTick();
+		thread.setThreadType(TH_TYP_REACTOR);
+		int timer = thread.addTimer(1 , tick);
+		TEST_ASSERT(timer >= 0);
+		TEST_ASSERT(WaitUntil([&]{ return tick->inside.load(); }));
+		TEST_ASSERT(thread.removeTimer(timer));
+		TEST_ASSERT(!tick->inside.load());
+		int runs = tick->runs.load();
+		delete tick;
+		Sleep(100);
+		TEST_ASSERT(runs >= 1);
+		/* 解除後もスレッドは動作している */
+		Future<int> result = thread.submit<int>([]{ return 7; });
+		TEST_ASSERT(result.get() == 7);
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		ファイルディスクリプタ・タイマー・積み上げられた関数を
+	 * 				同一のスレッドにて処理する
+	 */
+	int testWatchTimerAndQueue()
+	{
+		ThreadCall	thread;
+		int			pipes[2];
+		PipeReader	reader;
+		TickCount	tick;
+		thread.setThreadType(TH_TYP_REACTOR);
+		TEST_ASSERT(pipe(pipes) == 0);
+		TEST_ASSERT(thread.addWatch(pipes[0] , EPOLLIN , &reader));
+		int timer = thread.addTimer(10 , &tick);
+		TEST_ASSERT(timer >= 0);
+		std::atomic<int> tasks(0);
+		Future<void> last;
+		for (int i = 0 ; i < 50 ; i++)
+		{
+			last = thread.submit<void>([&tasks]{ tasks.fetch_add(1); });
+			if (i % 10 == 0)
+			{
+				TEST_ASSERT(write(pipes[1] , "abcd" , 4) == 4);
+			}
+		}
+		last.get();
+		TEST_ASSERT(tasks.load() == 50);
+		TEST_ASSERT(WaitUntil([&]{ return reader.bytes.load() == 20; }));
+		TEST_ASSERT(WaitUntil([&]{ return tick.ticks.load() >= 3; }));
+		TEST_ASSERT(thread.removeTimer(timer));
+		TEST_ASSERT(thread.removeWatch(pipes[0]));
+		/* 通常のスレッドに戻しても積み上げた関数は処理される */
+		thread.setThreadType(TH_TYP_EVENTDRIVEN);
+		Future<int> result = thread.submit<int>([]{ return 42; });
+		TEST_ASSERT(result.get() == 42);
+		thread.stop();
+		close(pipes[0]);
+		close(pipes[1]);
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testWatchTimerAndQueue);
+	TEST_RUN(testRemoveWhileRunning);
+	return failed;
+}
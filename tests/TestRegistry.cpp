@@ -0,0 +1,188 @@
+/* ***************************************************************************
+ * @file		TestRegistry.cpp
+ * @brief		スレッドレジストリ(再配分・ウォッチドッグ)の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 移動出来ない場合及びメンバーの破棄と並行する再配分の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include "VSTDThreadRegistry.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		実行したスレッドを記録するThreadFunction
+	 */
+	class RecordThread : public ThreadFunction
+	{
+		public:
+			std::atomic<int> *	done;
+			pthread_t			thread;
+			RecordThread(void) : done(NULL) {}
+			bool Function()
+			{
+				thread = pthread_self();
+				done->fetch_add(1);
+				return true;
+			}
+	};
+	/** @brief 検出されたスレッド */
+	std::atomic<ThreadCall *> detectedThread(NULL);
+	void OnStuck(ThreadCall * thread , long /* busy */ , void * /* arg */)
+	{
+		detectedThread.store(thread);
+	}
+	/**
+	 * @brief		停止したメンバーの待ち行列が同一グループの他のメンバーに再配分され、
+	 * 				ウォッチドッグが停止したメンバーを検出する
+	 */
+	int testRebalanceAndWatchdog()
+	{
+		ThreadRegistry * registry = ThreadRegistry::getInstance();
+		registry->enable();
+		TEST_ASSERT(registry->startWatchdog(100 , 20 , OnStuck));
+		ThreadCall		busy;
+		ThreadCall		spare;
+		pthread_t		spareId;
+		TEST_ASSERT(busy.isThreadRunning());
+		TEST_ASSERT(spare.isThreadRunning());
+		busy.setRegistryGroup(1);
+		spare.setRegistryGroup(1);
+		spare.getThreadId(&spareId);
+		TestGate			gate;
+		std::atomic<int>	done(0);
+		RecordThread		funcs[40];
+		TEST_ASSERT(busy.setFunction(&gate));
+		TEST_ASSERT(gate.waitEntered());
+		for (int i = 0 ; i < 40 ; i++)
+		{
+			funcs[i].done = &done;
+			TEST_ASSERT(busy.setFunction(&funcs[i]));
+		}
+		unsigned int moved = registry->rebalance(1);
+		TEST_ASSERT(moved > 0);
+		/* 再配分された分は停止中のメンバーを待たずに完了する */
+		TEST_ASSERT(WaitUntil([&]{
+			int onSpare = 0;
+			for (int i = 0 ; i < 40 ; i++)
+			{
+				if (funcs[i].getStatus() == THFUNC_STATE_COMLETED
+				&&	pthread_equal(funcs[i].thread , spareId))
+				{
+					onSpare++;
+				}
+			}
+			return onSpare == (int)moved;
+		}));
+		TEST_ASSERT(WaitUntil([&]{ return detectedThread.load() == &busy; }));
+		TEST_ASSERT(registry->getWatchdogDetected() > 0);
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return done.load() == 40; }));
+		registry->stopWatchdog();
+		registry->stopAll();
+		ThreadRegistryStat_t stat;
+		registry->getStat(&stat);
+		TEST_ASSERT(stat.running == 0);
+		return 0;
+	}
+	/**
+	 * @brief		移動先が受け付けない場合は移動元に残り、
+	 * 				呼び出し元のスレッドでは実行されない
+	 */
+	int testRebalanceRefused()
+	{
+		ThreadRegistry * registry = ThreadRegistry::getInstance();
+		registry->enable();
+		ThreadCall		busy;
+		ThreadCall		spare;
+		pthread_t		busyId;
+		TEST_ASSERT(busy.isThreadRunning());
+		TEST_ASSERT(spare.isThreadRunning());
+		busy.setRegistryGroup(2);
+		spare.setRegistryGroup(2);
+		spare.setThreadType(TH_TYP_INTERVAL);
+		busy.getThreadId(&busyId);
+		TestGate			gate;
+		std::atomic<int>	done(0);
+		RecordThread		funcs[40];
+		TEST_ASSERT(busy.setFunction(&gate));
+		TEST_ASSERT(gate.waitEntered());
+		for (int i = 0 ; i < 40 ; i++)
+		{
+			funcs[i].done = &done;
+			TEST_ASSERT(busy.setFunction(&funcs[i]));
+		}
+		TEST_ASSERT(registry->rebalance(2) == 0);
+		TEST_ASSERT(busy.getThreadFunctions() == 40);
+		TEST_ASSERT(done.load() == 0);
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return done.load() == 40; }));
+		for (int i = 0 ; i < 40 ; i++)
+		{
+			TEST_ASSERT(pthread_equal(funcs[i].thread , busyId));
+		}
+		busy.stop();
+		spare.stop();
+		return 0;
+	}
+	/**
+	 * @brief		メンバーの破棄と並行して再配分しても失われず、破棄済みのメンバーを参照しない
+	 */
+	int testRebalanceDuringDestroy()
+	{
+		const int			ROUNDS		= 100;
+		const int			PER_ROUND	= 20;
+		ThreadRegistry *	registry	= ThreadRegistry::getInstance();
+		registry->enable();
+		ThreadCall			spare;
+		ThreadCall			caller;
+		std::atomic<bool>	finished(false);
+		std::atomic<int>	done(0);
+		RecordThread *		funcs = new RecordThread[ROUNDS * PER_ROUND];
+		TEST_ASSERT(spare.isThreadRunning());
+		spare.setRegistryGroup(3);
+		Future<void> loop = caller.submit<void>([registry , &finished]{
+			while (!finished.load())
+			{
+				registry->rebalance(3);
+			}
+		});
+		for (int round = 0 ; round < ROUNDS ; round++)
+		{
+			ThreadCall * member = new ThreadCall();
+			TEST_ASSERT(member->isThreadRunning());
+			member->setRegistryGroup(3);
+			for (int i = 0 ; i < PER_ROUND ; i++)
+			{
+				RecordThread * func = &funcs[round * PER_ROUND + i];
+				func->done = &done;
+				TEST_ASSERT(member->setFunction(func));
+			}
+			TEST_ASSERT(WaitUntil([&]{ return member->getThreadFunctions() == 0; }));
+			delete member;
+		}
+		finished.store(true);
+		loop.get();
+		TEST_ASSERT(WaitUntil([&]{ return done.load() == ROUNDS * PER_ROUND; }));
+		spare.stop();
+		caller.stop();
+		delete [] funcs;
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testRebalanceAndWatchdog);
+	TEST_RUN(testRebalanceRefused);
+	TEST_RUN(testRebalanceDuringDestroy);
+	return failed;
+}
@@ -0,0 +1,129 @@
+/* ***************************************************************************
+ * @file		TestSharedQueue.cpp
+ * @brief		プロセス間共有キューの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <signal.h>
+#include <sys/wait.h>
+#include "VSTDSharedQueue.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 生産者プロセス数 */
+	const int PRODUCERS = 4;
+	/**
+	 * @brief		送信するメッセージ
+	 */
+	typedef struct
+	{
+		int		producer;
+		int		seq;
+		char	pad[40];
+	} Message_t;
+	/**
+	 * @brief		生産者毎の順序を確認する受信スレッド
+	 */
+	class OrderReader : public SharedQueueReader
+	{
+		public:
+			std::atomic<long>	received;
+			std::atomic<int>	broken;
+			int					last[PRODUCERS + 1];
+			OrderReader(SharedQueue * source) : SharedQueueReader(source) , received(0) , broken(0)
+			{
+				for (int i = 0 ; i <= PRODUCERS ; i++) last[i] = -1;
+			}
+			bool onMessage(const void * data , size_t len)
+			{
+				const Message_t * message = (const Message_t *)data;
+				if (len != sizeof(Message_t) || message->producer < 0 || message->producer > PRODUCERS)
+				{
+					broken.fetch_add(1);
+				}
+				else
+				{
+					if (message->seq != last[message->producer] + 1) broken.fetch_add(1);
+					last[message->producer] = message->seq;
+				}
+				received.fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		複数プロセスからの送信が順序を保って受信され、
+	 * 				書き込み中に異常終了したプロセスの領域が回収される
+	 */
+	int testProducersAndRecovery()
+	{
+		const int	PER_PRODUCER = 5000;
+		SharedQueue	queue;
+		pid_t		pids[PRODUCERS + 1];
+		TEST_ASSERT(queue.create(NULL , 8192));
+		OrderReader	reader(&queue);
+		for (int p = 0 ; p < PRODUCERS ; p++)
+		{
+			pids[p] = fork();
+			TEST_ASSERT(pids[p] >= 0);
+			if (pids[p] == 0)
+			{
+				for (int i = 0 ; i < PER_PRODUCER ; i++)
+				{
+					Message_t * message = (Message_t *)queue.reserve(sizeof(Message_t) , -1);
+					if (!message) _exit(1);
+					message->producer	= p;
+					message->seq		= i;
+					queue.commit(message);
+				}
+				_exit(0);
+			}
+		}
+		/* 領域を確保したまま強制終了するプロセス */
+		pids[PRODUCERS] = fork();
+		TEST_ASSERT(pids[PRODUCERS] >= 0);
+		if (pids[PRODUCERS] == 0)
+		{
+			queue.reserve(sizeof(Message_t) , -1);
+			pause();
+			_exit(0);
+		}
+		usleep(50000);
+		kill(pids[PRODUCERS] , SIGKILL);
+		for (int p = 0 ; p <= PRODUCERS ; p++)
+		{
+			int status;
+			TEST_ASSERT(waitpid(pids[p] , &status , 0) == pids[p]);
+			if (p < PRODUCERS) TEST_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+		}
+		TEST_ASSERT(WaitUntil([&]{ return reader.received.load() == PRODUCERS * PER_PRODUCER; } , 10000));
+		TEST_ASSERT(reader.broken.load() == 0);
+		SharedQueueStat_t stat;
+		TEST_ASSERT(WaitUntil([&]{
+			queue.getStat(&stat);
+			return stat.recovered >= 1 && stat.used == 0;
+		}));
+		/* 送信数には回収された領域の確保も含まれる */
+		TEST_ASSERT(stat.consumed == (unsigned long)(PRODUCERS * PER_PRODUCER));
+		TEST_ASSERT(stat.posted == stat.consumed + stat.recovered);
+		/* 容量を超えるメッセージは送信出来ない */
+		static char large[16384];
+		TEST_ASSERT(!queue.post(large , sizeof(large)));
+		reader.close();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testProducersAndRecovery);
+	return failed;
+}
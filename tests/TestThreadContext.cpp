@@ -0,0 +1,148 @@
+/* ***************************************************************************
+ * @file		TestThreadContext.cpp
+ * @brief		スレッドの開始・終了処理及びワーカー毎のコンテキストの動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include "VSTDThreadPool.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	std::atomic<int>	created(0);
+	std::atomic<int>	destroyed(0);
+	/**
+	 * @brief		生成と破棄を数えるコンテキスト
+	 */
+	class Context
+	{
+		public:
+			int		uses;
+			Context(void) : uses(0)
+			{
+				created.fetch_add(1);
+			}
+			~Context(void)
+			{
+				destroyed.fetch_add(1);
+			}
+	};
+	/**
+	 * @brief		開始・終了処理の呼び出しを数えるスレッド
+	 */
+	class Hooked : public ThreadCall
+	{
+		public:
+			std::atomic<int>	starts;
+			std::atomic<int>	exits;
+			Hooked(void) : starts(0) , exits(0) {}
+			~Hooked(void)
+			{
+				stop();
+			}
+			bool onThreadStart()
+			{
+				starts.fetch_add(1);
+				return ThreadCall::onThreadStart();
+			}
+			void onThreadExit()
+			{
+				exits.fetch_add(1);
+				ThreadCall::onThreadExit();
+			}
+	};
+	/** @brief 実行中のスレッドのコンテキストを使用 */
+	Context * UseContext()
+	{
+		Context * context = ThreadCall::getThreadContext<Context>();
+		if (context) context->uses++;
+		return context;
+	}
+	/**
+	 * @brief		スレッドの開始毎にコンテキストが生成され、終了時に破棄される
+	 */
+	int testHooksAndContext()
+	{
+		created.store(0);
+		destroyed.store(0);
+		Hooked thread;
+		thread.setThreadContext<Context>();
+		Context * first = NULL;
+		for (int i = 0 ; i < 10 ; i++)
+		{
+			Future<Context *> result = thread.submit<Context *>([]{ return UseContext(); });
+			Context * context = result.get();
+			TEST_ASSERT(context != NULL);
+			if (!first) first = context;
+			TEST_ASSERT(context == first);
+		}
+		TEST_ASSERT(first->uses == 10);
+		Future<ThreadCall *> current = thread.submit<ThreadCall *>([]{ return ThreadCall::getCurrentThread(); });
+		TEST_ASSERT(current.get() == &thread);
+		thread.stop();
+		TEST_ASSERT(thread.starts.load() == 1);
+		TEST_ASSERT(thread.exits.load() == 1);
+		TEST_ASSERT(created.load() == 1);
+		TEST_ASSERT(destroyed.load() == 1);
+		/* 再開時には新たに生成される */
+		TEST_ASSERT(thread.start());
+		Future<Context *> again = thread.submit<Context *>([]{ return UseContext(); });
+		TEST_ASSERT(again.get() != NULL);
+		thread.stop();
+		TEST_ASSERT(thread.starts.load() == 2);
+		TEST_ASSERT(thread.exits.load() == 2);
+		TEST_ASSERT(created.load() == 2);
+		TEST_ASSERT(destroyed.load() == 2);
+		/* ThreadCall以外のスレッド、及び未指定のスレッドにはコンテキストが無い */
+		TEST_ASSERT(ThreadCall::getThreadContext() == NULL);
+		TEST_ASSERT(ThreadCall::getCurrentThread() == NULL);
+		ThreadCall plain;
+		Future<Context *> none = plain.submit<Context *>([]{ return UseContext(); });
+		TEST_ASSERT(none.get() == NULL);
+		plain.stop();
+		TEST_ASSERT(created.load() == 2);
+		return 0;
+	}
+	/**
+	 * @brief		プールのワーカー毎にコンテキストが生成され、停止時に全て破棄される
+	 */
+	int testPoolContext()
+	{
+		created.store(0);
+		destroyed.store(0);
+		ThreadPoolConfig_t config;
+		ThreadPool::getDefaultConfig(&config);
+		config.minWorkers		= 3;
+		config.maxWorkers		= 3;
+		config.contextCreate	= &ThreadCall::createContext<Context>;
+		config.contextDestroy	= &ThreadCall::destroyContext<Context>;
+		ThreadPool			pool(&config);
+		std::atomic<int>	missing(0);
+		Future<void>		last;
+		for (int i = 0 ; i < 300 ; i++)
+		{
+			last = pool.submit<void>([&missing]{ if (!UseContext()) missing.fetch_add(1); });
+		}
+		last.get();
+		pool.stop();
+		TEST_ASSERT(missing.load() == 0);
+		TEST_ASSERT(created.load() == 3);
+		TEST_ASSERT(destroyed.load() == 3);
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testHooksAndContext);
+	TEST_RUN(testPoolContext);
+	return failed;
+}
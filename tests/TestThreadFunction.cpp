@@ -0,0 +1,196 @@
+/* ***************************************************************************
+ * @file		TestThreadFunction.cpp
+ * @brief		ThreadFunctionのステータス管理及び完了待機の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian executeによる完了・自動解放の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <stdexcept>
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		一定時間停止した後に実行回数を加算するThreadFunction
+	 */
+	class SlowCount : public ThreadFunction
+	{
+		public:
+			int		count;
+			SlowCount(void) : count(0) {}
+			bool Function()
+			{
+				Sleep(30);
+				count++;
+				return true;
+			}
+	};
+	/**
+	 * @brief		何もしないThreadFunction
+	 */
+	class Empty : public ThreadFunction
+	{
+		public:
+			bool Function()
+			{
+				return true;
+			}
+	};
+	/** @brief 破棄されたThreadFunctionの数 */
+	std::atomic<int>	released(0);
+	/**
+	 * @brief		破棄を数え、指定された場合は例外を送出するThreadFunction
+	 */
+	class Releasable : public ThreadFunction
+	{
+		public:
+			bool	fail;
+			Releasable(bool f) : fail(f)
+			{
+				setAutoRelease(true);
+			}
+			~Releasable()
+			{
+				released.fetch_add(1);
+			}
+			bool Function()
+			{
+				if (fail) throw std::runtime_error("fail");
+				return false;
+			}
+	};
+	/**
+	 * @brief		実行中に再度積み上げるThreadFunction
+	 */
+	class Resubmit : public ThreadFunction
+	{
+		public:
+			bool Function()
+			{
+				setStatus(THFUNC_STATE_WAITING);
+				return true;
+			}
+	};
+	/**
+	 * @brief		executeは完了とし自動解放する。例外の場合も同様で、
+	 * 				実行中に再度積み上げられた場合は完了としない
+	 */
+	int testExecute()
+	{
+		released.store(0);
+		bool completed = false;
+		TEST_ASSERT(!(new Releasable(false))->execute(&completed));
+		TEST_ASSERT(completed);
+		TEST_ASSERT(released.load() == 1);
+		bool caught = false;
+		try
+		{
+			(new Releasable(true))->execute();
+		}
+		catch (std::runtime_error &)
+		{
+			caught = true;
+		}
+		TEST_ASSERT(caught);
+		TEST_ASSERT(released.load() == 2);
+		Resubmit again;
+		TEST_ASSERT(again.execute(&completed));
+		TEST_ASSERT(!completed);
+		TEST_ASSERT(again.getStatus() == THFUNC_STATE_WAITING);
+		return 0;
+	}
+	/**
+	 * @brief		waitが完了時点で戻り、処理結果が参照出来る
+	 */
+	int testWaitCompletion()
+	{
+		ThreadCall	thread;
+		SlowCount	func;
+		TEST_ASSERT(func.getStatus() == THFUNC_STATE_NOTSUBMITTED);
+		TEST_ASSERT(!func.wait(0));
+		TEST_ASSERT(thread.setFunction(&func));
+		long long start = GetMonotonicTime();
+		TEST_ASSERT(func.wait(2));
+		TEST_ASSERT(GetMonotonicTime() - start < 1000000000LL);
+		TEST_ASSERT(func.count == 1);
+		TEST_ASSERT(func.getStatus() == THFUNC_STATE_COMLETED);
+		/* 完了済みの場合は待機しない */
+		TEST_ASSERT(func.wait(0));
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		積み上げていない場合はwaitStatusがタイムアウトする
+	 */
+	int testWaitStatusTimeout()
+	{
+		SlowCount func;
+		long long start = GetMonotonicTime();
+		TEST_ASSERT(!func.waitStatus(THFUNC_STATE_COMLETED , 20000000LL));
+		TEST_ASSERT(GetMonotonicTime() - start >= 15000000LL);
+		return 0;
+	}
+	/**
+	 * @brief		複数のスレッドから同時に完了を待機出来る
+	 */
+	int testConcurrentWaiters()
+	{
+		ThreadCall			thread;
+		TestGate			gate;
+		Empty				func;
+		std::atomic<int>	woken(0);
+		ThreadCall			waiters[4];
+		TEST_ASSERT(thread.setFunction(&gate));
+		TEST_ASSERT(gate.waitEntered());
+		TEST_ASSERT(thread.setFunction(&func));
+		for (int i = 0 ; i < 4 ; i++)
+		{
+			waiters[i].submit<void>([&]{
+				if (func.wait(5)) woken.fetch_add(1);
+			});
+		}
+		Sleep(20);
+		TEST_ASSERT(woken.load() == 0);
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return woken.load() == 4; }));
+		for (int i = 0 ; i < 4 ; i++)
+		{
+			waiters[i].stop();
+		}
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		複製は待機中のスレッドを引き継がずにステータスを複製する
+	 */
+	int testCopy()
+	{
+		ThreadCall	thread;
+		Empty		func;
+		TEST_ASSERT(thread.setFunction(&func));
+		TEST_ASSERT(func.wait(2));
+		Empty		copy(func);
+		TEST_ASSERT(copy.getStatus() == THFUNC_STATE_COMLETED);
+		TEST_ASSERT(!copy.mutex.isCreated());
+		thread.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testWaitCompletion);
+	TEST_RUN(testWaitStatusTimeout);
+	TEST_RUN(testConcurrentWaiters);
+	TEST_RUN(testCopy);
+	TEST_RUN(testExecute);
+	return failed;
+}
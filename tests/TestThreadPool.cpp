@@ -0,0 +1,190 @@
+/* ***************************************************************************
+ * @file		TestThreadPool.cpp
+ * @brief		伸縮型スレッドプール及び関連する修正の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian ストランドの確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <pthread.h>
+#include <time.h>
+#include "VSTDThreadPool.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/** @brief 経過時間(ミリ秒)の取得 */
+	long ElapsedMs(const struct timespec & start)
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC , &now);
+		return (now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000;
+	}
+	/**
+	 * @brief		一定時間停止した後に完了数を加算するThreadFunction
+	 */
+	class SleepCount : public ThreadFunction
+	{
+		public:
+			std::atomic<int> *	done;
+			SleepCount(void) : done(NULL) {}
+			bool Function()
+			{
+				Sleep(5);
+				done->fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		待ち行列が滞留した場合に増員し、待機後に最小数まで削減する
+	 */
+	int testGrowAndShrink()
+	{
+		ThreadPoolConfig_t	config;
+		ThreadPool::getDefaultConfig(&config);
+		config.minWorkers	= 2;
+		config.maxWorkers	= 8;
+		config.idleTimeout	= 100;
+		config.cooldown		= 20;
+		ThreadPool			pool(&config);
+		std::atomic<int>	done(0);
+		SleepCount *		funcs = new SleepCount[400];
+		for (int i = 0 ; i < 400 ; i++)
+		{
+			funcs[i].done = &done;
+			TEST_ASSERT(pool.setFunction(&funcs[i]));
+		}
+		ThreadPoolStat_t	stat;
+		unsigned int		peak = 0;
+		TEST_ASSERT(WaitUntil([&]{
+			pool.getStat(&stat);
+			if (stat.workers > peak) peak = stat.workers;
+			return done.load() == 400;
+		} , 10000));
+		TEST_ASSERT(peak > config.minWorkers);
+		TEST_ASSERT(peak <= config.maxWorkers);
+		TEST_ASSERT(WaitUntil([&]{
+			pool.getStat(&stat);
+			return stat.workers == config.minWorkers;
+		} , 5000));
+		TEST_ASSERT(stat.spawned > config.minWorkers);
+		TEST_ASSERT(stat.retired == stat.spawned - config.minWorkers);
+		Future<int> result = pool.submit<int>([]{ return 7; });
+		TEST_ASSERT(result.get() == 7);
+		pool.stop();
+		delete[] funcs;
+		return 0;
+	}
+	/** @brief 待機側が起床しなかった場合の救済用 */
+	void * RescueCondition(void * arg)
+	{
+		Sleep(2000);
+		static_cast<Condition *>(arg)->set();
+		return NULL;
+	}
+	/**
+	 * @brief		wait前に送信されたシグナルが失われない
+	 */
+	int testConditionLatch()
+	{
+		Condition		condition;
+		pthread_t		rescue;
+		struct timespec	start;
+		condition.set();
+		TEST_ASSERT(pthread_create(&rescue , NULL , RescueCondition , &condition) == 0);
+		clock_gettime(CLOCK_MONOTONIC , &start);
+		condition.wait();
+		long elapsed = ElapsedMs(start);
+		pthread_join(rescue , NULL);
+		TEST_ASSERT(elapsed < 1000);
+		return 0;
+	}
+	/**
+	 * @brief		1秒以上の指定でも指定時間停止する
+	 */
+	int testSleepOverOneSecond()
+	{
+		struct timespec start;
+		clock_gettime(CLOCK_MONOTONIC , &start);
+		Sleep(1200);
+		TEST_ASSERT(ElapsedMs(start) >= 1190);
+		return 0;
+	}
+	/**
+	 * @brief		停止したスレッドを再開して処理を継続出来る
+	 */
+	int testRestart()
+	{
+		ThreadCall thread;
+		for (int i = 0 ; i < 3 ; i++)
+		{
+			Future<int> result = thread.submit<int>([i]{ return i; });
+			TEST_ASSERT(result.get() == i);
+			thread.stop();
+			TEST_ASSERT(thread.getThreadStatus() == TH_STAT_DOWN);
+			TEST_ASSERT(thread.start());
+		}
+		thread.stop();
+		return 0;
+	}
+	/**
+	 * @brief		同一キーの関数は積み上げた順に1つずつ実行される
+	 */
+	int testStrandOrder()
+	{
+		const int			KEYS	= 4;
+		const int			PER_KEY	= 200;
+		ThreadPoolConfig_t	config;
+		ThreadPool::getDefaultConfig(&config);
+		config.minWorkers	= 4;
+		config.maxWorkers	= 4;
+		config.depth		= KEYS * PER_KEY;
+		ThreadPool			pool(&config);
+		int					next[KEYS]		= { 0 };
+		std::atomic<int>	active[KEYS];
+		std::atomic<int>	errors(0);
+		Future<void>		last[KEYS];
+		for (int k = 0 ; k < KEYS ; k++)
+		{
+			active[k].store(0);
+		}
+		for (int i = 0 ; i < PER_KEY ; i++)
+		{
+			for (int k = 0 ; k < KEYS ; k++)
+			{
+				last[k] = pool.submit<void>((unsigned long)k , [&next , &active , &errors , k , i]{
+					if (active[k].fetch_add(1) != 0) errors.fetch_add(1);
+					if (next[k] != i) errors.fetch_add(1);
+					next[k] = i + 1;
+					active[k].fetch_sub(1);
+				});
+			}
+		}
+		for (int k = 0 ; k < KEYS ; k++)
+		{
+			last[k].get();
+			TEST_ASSERT(next[k] == PER_KEY);
+		}
+		TEST_ASSERT(errors.load() == 0);
+		TEST_ASSERT(WaitUntil([&]{ return pool.getStrands() == 0; }));
+		pool.stop();
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testGrowAndShrink);
+	TEST_RUN(testConditionLatch);
+	TEST_RUN(testSleepOverOneSecond);
+	TEST_RUN(testRestart);
+	TEST_RUN(testStrandOrder);
+	return failed;
+}
@@ -0,0 +1,96 @@
+/* ***************************************************************************
+ * @file		TestThreadState.cpp
+ * @brief		スレッドの状態管理の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * - 2026/10/19	Sebastian 状態遷移の待機の確認を追加
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include <stdint.h>
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		動的に確保したThreadCallがキャッシュライン境界に配置される
+	 */
+	int testCacheLineAlignment()
+	{
+		ThreadCall * threads[8];
+		for (int i = 0 ; i < 8 ; i++)
+		{
+			threads[i] = new ThreadCall();
+			TEST_ASSERT((uintptr_t)threads[i] % TH_CACHE_LINE == 0);
+		}
+		for (int i = 0 ; i < 8 ; i++)
+		{
+			delete threads[i];
+		}
+		return 0;
+	}
+	/**
+	 * @brief		他のスレッドから処理中・待機中の状態を参照出来る
+	 */
+	int testStateVisibility()
+	{
+		ThreadCall	thread;
+		TestGate	gate;
+		TEST_ASSERT(thread.isThreadRunning());
+		TEST_ASSERT(thread.setFunction(&gate));
+		TEST_ASSERT(gate.waitEntered());
+		TEST_ASSERT(thread.getThreadStatus() == TH_STAT_BUSY);
+		gate.open();
+		TEST_ASSERT(WaitUntil([&]{ return thread.getThreadStatus() == TH_STAT_WAIT; }));
+		thread.stop();
+		TEST_ASSERT(thread.getThreadStatus() == TH_STAT_DOWN);
+		return 0;
+	}
+	/**
+	 * @brief		waitThreadStateが状態遷移で起床し、遷移しない場合はタイムアウトする
+	 */
+	int testWaitThreadState()
+	{
+		ThreadCall	thread;
+		TestGate	gate;
+		TEST_ASSERT(thread.isThreadRunning(1000));
+		TEST_ASSERT(thread.setFunction(&gate));
+		TEST_ASSERT(thread.waitThreadState(TH_STAT_BUSY , 5000000000LL));
+		long long start = GetMonotonicTime();
+		TEST_ASSERT(!thread.waitThreadState(TH_STAT_DOWN , 50000000LL));
+		TEST_ASSERT(GetMonotonicTime() - start >= 45000000LL);
+		gate.open();
+		TEST_ASSERT(thread.waitThreadState(TH_STAT_WAIT , 5000000000LL));
+		thread.stop();
+		TEST_ASSERT(thread.waitThreadState(TH_STAT_DOWN , 1000000LL));
+		return 0;
+	}
+	/**
+	 * @brief		生成直後のスレッドの起動待ちと停止を繰り返しても失敗しない
+	 */
+	int testStartStopCycle()
+	{
+		for (int i = 0 ; i < 100 ; i++)
+		{
+			ThreadCall * thread = new ThreadCall();
+			TEST_ASSERT(thread->isThreadRunning(1000));
+			delete thread;
+		}
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testCacheLineAlignment);
+	TEST_RUN(testStateVisibility);
+	TEST_RUN(testWaitThreadState);
+	TEST_RUN(testStartStopCycle);
+	return failed;
+}
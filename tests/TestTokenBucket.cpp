@@ -0,0 +1,127 @@
+/* ***************************************************************************
+ * @file		TestTokenBucket.cpp
+ * @brief		トークンバケットによる流量制限の動作確認
+ * @author	Sebastian
+ * @date		2026/10/19
+ * @version	1.0
+ *
+ * @par 更新履歴：
+ * - 2026/10/19	Sebastian 新規作成
+ * ***************************************************************************/
+#include "TestCommon.hpp"
+#include "VSTDTokenBucket.hpp"
+
+using namespace VSTD;
+using namespace VSTDTest;
+
+namespace
+{
+	/**
+	 * @brief		テナント毎の処理数を数える受信スレッド
+	 */
+	class TenantCount : public ThreadCall
+	{
+		public:
+			std::atomic<long>	total;
+			std::atomic<long>	tenants[3];
+			TenantCount(void) : total(0)
+			{
+				for (int i = 0 ; i < 3 ; i++) tenants[i].store(0);
+			}
+			~TenantCount(void)
+			{
+				stop();
+			}
+			using ThreadCall::onFunction;
+			bool onFunction(void * Data)
+			{
+				tenants[(intptr_t)Data % 3].fetch_add(1);
+				total.fetch_add(1);
+				return true;
+			}
+	};
+	/**
+	 * @brief		バースト分は直ちに取得でき、以降は待機時間が通知され、返却分は再取得出来る
+	 */
+	int testBurstAndRefund()
+	{
+		TokenBucket	bucket(10 , 5);
+		long long	wait = 0;
+		for (int i = 0 ; i < 5 ; i++)
+		{
+			TEST_ASSERT(bucket.tryAcquire());
+		}
+		TEST_ASSERT(!bucket.tryAcquire(&wait));
+		TEST_ASSERT(wait > 0 && wait <= 100000000LL);
+		bucket.refund();
+		TEST_ASSERT(bucket.tryAcquire());
+		TEST_ASSERT(!bucket.tryAcquire());
+		TEST_ASSERT(bucket.getBurst() == 5);
+		return 0;
+	}
+	/**
+	 * @brief		流量制限を指定したスレッドは指定した速度で処理し、停止は待たされない
+	 */
+	int testThreadRate()
+	{
+		TokenBucket		bucket(1000 , 10);
+		TenantCount *	thread = new TenantCount();
+		thread->setRateLimit(&bucket);
+		long long start = GetMonotonicTime();
+		for (long i = 0 ; i < 60 ; i++)
+		{
+			TEST_ASSERT(thread->setFunction((void *)(intptr_t)((i + 1) * 3)));
+		}
+		TEST_ASSERT(WaitUntil([&]{ return thread->total.load() == 60; }));
+		/* バースト10件を除く50件に50ms */
+		TEST_ASSERT(GetMonotonicTime() - start >= 40000000LL);
+		/* 1件/秒に絞った状態で停止しても待たされない */
+		bucket.setRate(1 , 1);
+		for (long i = 0 ; i < 20 ; i++)
+		{
+			thread->setFunction((void *)(intptr_t)((i + 1) * 3));
+		}
+		Sleep(20);
+		start = GetMonotonicTime();
+		delete thread;
+		TEST_ASSERT(GetMonotonicTime() - start < 500000000LL);
+		return 0;
+	}
+	/**
+	 * @brief		テナント毎の流量制限は他のテナントの処理を遅らせない
+	 */
+	int testTenantRate()
+	{
+		TokenBucket		slow(100 , 1);
+		TenantCount *	thread = new TenantCount();
+		TEST_ASSERT(thread->setScheduleType(TH_SCHED_FAIR));
+		TEST_ASSERT(thread->addTenant(1 , 1 , 40));
+		TEST_ASSERT(thread->addTenant(2 , 1 , 40));
+		TEST_ASSERT(thread->setTenantRateLimit(1 , &slow));
+		long long start = GetMonotonicTime();
+		for (long i = 0 ; i < 30 ; i++)
+		{
+			TEST_ASSERT(thread->setTenantFunction(1 , (void *)(intptr_t)(3 * i + 1)));
+			TEST_ASSERT(thread->setTenantFunction(2 , (void *)(intptr_t)(3 * i + 2)));
+		}
+		TEST_ASSERT(WaitUntil([&]{ return thread->tenants[2].load() == 30; }));
+		TEST_ASSERT(thread->tenants[1].load() < 30);
+		TEST_ASSERT(WaitUntil([&]{ return thread->tenants[1].load() == 30; }));
+		/* 100件/秒にて29件分の間隔 */
+		TEST_ASSERT(GetMonotonicTime() - start >= 250000000LL);
+		ThreadTenantStat_t stat;
+		TEST_ASSERT(thread->getTenantStat(1 , &stat));
+		TEST_ASSERT(stat.throttled > 0);
+		delete thread;
+		return 0;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	TEST_RUN(testBurstAndRefund);
+	TEST_RUN(testThreadRate);
+	TEST_RUN(testTenantRate);
+	return failed;
+}